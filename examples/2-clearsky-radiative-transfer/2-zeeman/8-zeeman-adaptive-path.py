@@ -43,7 +43,7 @@ ws.ray_pointBackground()
 ws.spectral_rad_bkgAgendasAtEndOfPath()
 ws.atm_pathFromPath()
 ws.freq_grid_pathFromPath()
-ws.spectral_propmat_pathFromPath()
+ws.spectral_pathFromPath()
 ws.spectral_radSetToBackground()
 ws.spectral_radSinglePathEmissionFrequencyLoop()
 ws.spectral_radApplyUnitFromSpectralRadiance()
@@ -53,6 +53,7 @@ path0 = copy(ws.ray_path)
 
 ws.spectral_propmat_pathAdaptiveHalfPath(
     max_stepsize=100., max_tau=0.05, cutoff_tau=3.0)
+ws.spectral_pathFromPropmatPath()
 ws.spectral_radSetToBackground()
 ws.spectral_radSinglePathEmissionFrequencyLoop()
 ws.spectral_radApplyUnitFromSpectralRadiance()
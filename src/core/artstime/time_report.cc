@@ -1,12 +1,18 @@
 #include "time_report.h"
 
 #include <arts_conversions.h>
-#include <arts_omp.h>
 #include <mystring.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <format>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <print>
+#include <shared_mutex>
 #include <unordered_map>
 
 namespace arts {
@@ -24,33 +30,206 @@ std::string short_name(const std::string& name) {
   return join(s2, " ");
 }
 
-TimeReport profile_report;
-std::mutex mprofile_report;
+//! The monotonic clock and the wall clock at the first use of the profiler
+struct epochs {
+  std::chrono::steady_clock::time_point steady{
+      std::chrono::steady_clock::now()};
+  time_t wall{std::chrono::system_clock::now()};
+};
+
+const epochs& epoch() {
+  static const epochs e;
+  return e;
+}
+
+//! Nanoseconds since the epoch on the monotonic clock
+std::int64_t now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - epoch().steady)
+      .count();
+}
+
+time_t to_wall(std::int64_t ns) {
+  return epoch().wall +
+         std::chrono::duration_cast<std::chrono::system_clock::duration>(
+             std::chrono::nanoseconds{ns});
+}
+
+//! All span names, ids index into names
+struct name_table {
+  std::shared_mutex mtx;
+  std::deque<std::string> names;
+  std::unordered_map<std::string_view, std::uint32_t> ids;
+
+  std::uint32_t intern(std::string_view name) {
+    {
+      std::shared_lock lock{mtx};
+      if (auto it = ids.find(name); it != ids.end()) return it->second;
+    }
+
+    std::unique_lock lock{mtx};
+    if (auto it = ids.find(name); it != ids.end()) return it->second;
+
+    const auto id = static_cast<std::uint32_t>(names.size());
+    ids.emplace(names.emplace_back(name), id);
+    return id;
+  }
+};
+
+name_table& span_names() {
+  static name_table n;
+  return n;
+}
+
+struct span {
+  std::uint32_t name;
+  std::uint32_t depth;
+  std::int64_t start;
+  std::int64_t end;
+};
+
+/*! The spans of one thread
+
+  Only the owning thread writes spans and advances head.  The reader copies
+  the spans in [max(cleared, head - size), head) and then discards those
+  that the owning thread may have overwritten while they were copied.
+*/
+struct thread_log {
+  static constexpr std::uint64_t size = 1 << 16;
+
+  int thread;
+  std::uint32_t depth{0};
+  std::atomic<std::uint64_t> head{0};
+  std::uint64_t cleared{0};
+  std::array<span, size> spans;
+
+  explicit thread_log(int t) : thread(t) {}
+
+  void push(const span& s) {
+    const std::uint64_t h = head.load(std::memory_order_relaxed);
+    spans[h % size]       = s;
+    head.store(h + 1, std::memory_order_release);
+  }
+
+  std::vector<span> collect(bool clear) {
+    const std::uint64_t h     = head.load(std::memory_order_acquire);
+    const std::uint64_t first = std::max(cleared, h > size ? h - size : 0);
+
+    std::vector<span> out;
+    out.reserve(h - first);
+    for (std::uint64_t i = first; i < h; i++) out.push_back(spans[i % size]);
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const std::uint64_t h2 = head.load(std::memory_order_relaxed);
+    if (h2 > size and h2 - size > first) {
+      out.erase(out.begin(),
+                out.begin() + static_cast<std::ptrdiff_t>(
+                                  std::min(h2 - size - first, out.size())));
+    }
+
+    if (clear) cleared = h;
+    return out;
+  }
+};
+
+//! Owns the logs of all threads that have recorded spans
+struct thread_logs {
+  std::mutex mtx;
+  std::vector<std::unique_ptr<thread_log>> logs;
+
+  thread_log* add() {
+    std::scoped_lock lock{mtx};
+    const auto t = static_cast<int>(logs.size());
+    return logs.emplace_back(std::make_unique<thread_log>(t)).get();
+  }
+};
+
+thread_logs& all_logs() {
+  static thread_logs l;
+  return l;
+}
+
+thread_log& this_thread_log() {
+  thread_local thread_log* log = all_logs().add();
+  return *log;
+}
+
+//! The spans of all threads, per thread
+std::vector<std::pair<int, std::vector<span>>> collect(bool clear) {
+  auto& logs = all_logs();
+  std::scoped_lock lock{logs.mtx};
+
+  std::vector<std::pair<int, std::vector<span>>> out;
+  out.reserve(logs.logs.size());
+  for (auto& log : logs.logs) {
+    out.emplace_back(log->thread, log->collect(clear));
+  }
+  return out;
+}
+
+//! Spans by start time, outer spans before the inner spans they contain
+void sort_by_start(std::vector<span>& spans) {
+  std::ranges::sort(spans, [](const span& a, const span& b) {
+    return a.start < b.start or (a.start == b.start and a.depth < b.depth);
+  });
+}
+
+std::string json_escape(std::string_view s) {
+  std::string out;
+  out.reserve(s.size());
+  for (const char c : s) {
+    switch (c) {
+      case '"':  out += "\\\""; break;
+      case '\\': out += "\\\\"; break;
+      case '\n': out += "\\n"; break;
+      case '\t': out += "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          out += std::format("\\u{:04x}", static_cast<int>(c));
+        } else {
+          out += c;
+        }
+    }
+  }
+  return out;
+}
 }  // namespace
 
-profiler::profiler(std::string&& key)
-    : name(std::move(key)), start(std::chrono::system_clock::now()) {}
+profile_key::profile_key(std::string_view name)
+    : id(span_names().intern(name)) {}
+
+profile_key::profile_key(std::source_location loc)
+    : profile_key(short_name(loc.function_name())) {}
+
+profiler::profiler(const profile_key& key)
+    : name(key.id), depth(this_thread_log().depth++), start(now()) {}
+
+profiler::profiler(std::string&& key) : profiler(profile_key{key}) {}
 
-profiler::profiler(std::source_location loc)
-    : profiler(short_name(loc.function_name())) {}
+profiler::profiler(std::source_location loc) : profiler(profile_key{loc}) {}
 
 profiler::~profiler() {
-  const time_t end{std::chrono::system_clock::now()};
-  const int core = arts_omp_get_thread_num();
+  const std::int64_t end = now();
 
-  // Lock might add extra pause inbetween thread calls, but it is safe
-  std::scoped_lock lock{mprofile_report};
-  profile_report[core][name].emplace_back(start, end);
+  thread_log& log = this_thread_log();
+  log.depth       = depth;
+  log.push({.name = name, .depth = depth, .start = start, .end = end});
 }
 
 TimeReport get_report(bool clear) {
-  std::scoped_lock lock{mprofile_report};
+  const auto spans = collect(clear);
 
-  TimeReport copy = profile_report;
+  auto& names = span_names();
+  std::shared_lock lock{names.mtx};
 
-  if (clear)
-    for (auto& [key, value] : profile_report) value.clear();
-  return copy;
+  TimeReport report;
+  for (const auto& [thread, thread_spans] : spans) {
+    auto& core = report[thread];
+    for (const auto& s : thread_spans) {
+      core[names.names[s.name]].emplace_back(to_wall(s.start), to_wall(s.end));
+    }
+  }
+  return report;
 }
 
 void print_report() {
@@ -95,4 +274,69 @@ void print_report() {
         times.size());
   }
 }
-}  // namespace arts
\ No newline at end of file
+
+std::string trace_report(bool clear) {
+  auto spans = collect(clear);
+
+  auto& names = span_names();
+  std::shared_lock lock{names.mtx};
+
+  std::string out = R"({"displayTimeUnit": "ns", "traceEvents": [)";
+  bool first      = true;
+  for (auto& [thread, thread_spans] : spans) {
+    sort_by_start(thread_spans);
+    for (const auto& s : thread_spans) {
+      out += std::format(
+          R"({}
+{{"name": "{}", "ph": "X", "pid": 0, "tid": {}, "ts": {:.3f}, "dur": {:.3f}}})",
+          first ? "" : ",",
+          json_escape(names.names[s.name]),
+          thread,
+          1e-3 * static_cast<Numeric>(s.start),
+          1e-3 * static_cast<Numeric>(s.end - s.start));
+      first = false;
+    }
+  }
+  out += "\n]}\n";
+  return out;
+}
+
+std::string flame_graph_report(bool clear) {
+  auto spans = collect(clear);
+
+  auto& names = span_names();
+  std::shared_lock lock{names.mtx};
+
+  // Self-time per call stack
+  std::map<std::string, std::int64_t> stacks;
+  for (auto& [thread, thread_spans] : spans) {
+    sort_by_start(thread_spans);
+
+    // The open spans with the stack name of each
+    std::vector<std::pair<const span*, std::string>> open;
+    for (const auto& s : thread_spans) {
+      while (not open.empty() and (open.back().first->depth >= s.depth or
+                                   open.back().first->end <= s.start)) {
+        open.pop_back();
+      }
+
+      std::string stack = open.empty() ? names.names[s.name]
+                                       : std::format("{};{}",
+                                                     open.back().second,
+                                                     names.names[s.name]);
+
+      const std::int64_t dt  = s.end - s.start;
+      stacks[stack]         += dt;
+      if (not open.empty()) stacks[open.back().second] -= dt;
+
+      open.emplace_back(&s, std::move(stack));
+    }
+  }
+
+  std::string out;
+  for (const auto& [stack, ns] : stacks) {
+    out += std::format("{} {}\n", stack, std::max<std::int64_t>(ns, 0));
+  }
+  return out;
+}
+}  // namespace arts
@@ -1,7 +1,10 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <source_location>
+#include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -11,10 +14,31 @@ using StartEnd        = std::pair<time_t, time_t>;
 using SingleCoreTimer = std::unordered_map<std::string, std::vector<StartEnd>>;
 using TimeReport      = std::unordered_map<int, SingleCoreTimer>;
 
+/*! An interned profiler span name
+
+  Interning happens once, so that timing a scope only stores the id.
+*/
+struct profile_key {
+  std::uint32_t id;
+
+  explicit profile_key(std::string_view name);
+  explicit profile_key(std::source_location loc);
+};
+
+/*! Times the scope it lives in
+
+  Each thread records its spans into its own fixed-size ring buffer using a
+  monotonic clock, so no lock is taken when a span ends.  Spans nest; the
+  depth of each span in its thread's call stack is recorded as well.  If a
+  thread records more spans than fit in its buffer before the report is
+  collected, the oldest spans are dropped.
+*/
 struct profiler {
-  std::string name;
-  time_t start;
+  std::uint32_t name;
+  std::uint32_t depth;
+  std::int64_t start;
 
+  profiler(const profile_key& key);
   profiler(std::string&& key);
   profiler(std::source_location loc = std::source_location::current());
 
@@ -29,10 +53,34 @@ struct profiler {
 TimeReport get_report(bool clear = true);
 
 void print_report();
+
+/*! The recorded spans in the Chrome trace event format
+
+  The output is a JSON object that can be opened by chrome://tracing and
+  by Perfetto.  Spans are complete events ("ph": "X") with microsecond
+  timestamps relative to the start of the program.
+
+  @param clear Clear the recorded spans
+*/
+std::string trace_report(bool clear = false);
+
+/*! The recorded spans as folded stacks
+
+  One line per unique call stack, "outer;inner;innermost self-time", where
+  the self-time of a span excludes its child spans and is given in
+  nanoseconds.  This is the input format of flamegraph.pl and compatible
+  viewers.
+
+  @param clear Clear the recorded spans
+*/
+std::string flame_graph_report(bool clear = false);
 }  // namespace arts
 
 #if ARTS_PROFILING
-#define ARTS_TIME_REPORT arts::profiler _arts_prof_var_name_{};
+#define ARTS_TIME_REPORT                                          \
+  static const arts::profile_key _arts_prof_key_name_{            \
+      std::source_location::current()};                           \
+  arts::profiler _arts_prof_var_name_{_arts_prof_key_name_};
 #define ARTS_NAMED_TIME_REPORT(_name_var_) \
   arts::profiler _arts_named__prof_var_name_{_name_var_};
 #else
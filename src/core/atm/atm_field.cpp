@@ -14,7 +14,9 @@
 #include <algorithm>
 #include <exception>
 #include <limits>
+#include <memory>
 #include <optional>
+#include <ranges>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
@@ -184,24 +186,30 @@ std::pair<Numeric, Numeric> AtmPoint::levels(
 }
 
 namespace Atm {
+namespace {
+Point::SpeciesIsotopeMap point_isots(const SpeciesIsotopologueRatios &x) {
+  Point::SpeciesIsotopeMap isots;
+  for (Index i = 0; i < x.maxsize; i++) {
+    if (Species::Isotopologues[i].is_joker()) continue;
+    if (Species::Isotopologues[i].is_predefined()) continue;
+    isots[Species::Isotopologues[i]] = x.data[i];
+  }
+  return isots;
+}
+}  // namespace
+
 Point::Point(const IsoRatioOption isots_key) {
+  // Built once, all points share the schema of these
   switch (isots_key) {
     case IsoRatioOption::Builtin: {
-      const SpeciesIsotopologueRatios x =
-          Species::isotopologue_ratiosInitFromBuiltin();
-      for (Index i = 0; i < x.maxsize; i++) {
-        if (Species::Isotopologues[i].is_joker()) continue;
-        if (Species::Isotopologues[i].is_predefined()) continue;
-        isots[Species::Isotopologues[i]] = x.data[i];
-      }
+      static const SpeciesIsotopeMap x =
+          point_isots(Species::isotopologue_ratiosInitFromBuiltin());
+      isots = x;
     } break;
     case IsoRatioOption::Hitran: {
-      const SpeciesIsotopologueRatios x = Hitran::isotopologue_ratios();
-      for (Index i = 0; i < x.maxsize; i++) {
-        if (Species::Isotopologues[i].is_joker()) continue;
-        if (Species::Isotopologues[i].is_predefined()) continue;
-        isots[Species::Isotopologues[i]] = x.data[i];
-      }
+      static const SpeciesIsotopeMap x =
+          point_isots(Hitran::isotopologue_ratios());
+      isots = x;
     } break;
     case IsoRatioOption::None:
     default:                   break;
@@ -278,7 +286,7 @@ bool Point::contains(const KeyVal &key) const {
 Numeric Point::mean_mass(SpeciesEnum s) const {
   Numeric ratio = 0.0;
   Numeric mass  = 0.0;
-  for (auto &[isot, this_ratio] : isots) {
+  for (const auto &[isot, this_ratio] : isots) {
     if (isot.spec == s and not(isot.is_predefined() or isot.is_joker())) {
       ratio += this_ratio;
       mass  += this_ratio * isot.mass;
@@ -295,7 +303,7 @@ Numeric Point::mean_mass(SpeciesEnum s) const {
 Numeric Point::mean_mass() const {
   Numeric vmr  = 0.0;
   Numeric mass = 0.0;
-  for (auto &[spec, this_vmr] : specs) {
+  for (const auto &[spec, this_vmr] : specs) {
     vmr += this_vmr;
     if (this_vmr != 0.0) {
       mass += this_vmr * mean_mass(spec);
@@ -321,19 +329,19 @@ std::vector<KeyVal> Point::keys(bool keep_basic,
   }
 
   if (keep_specs) {
-    for (auto &a : specs) out.emplace_back(a.first);
+    for (auto &a : specs.keys()) out.emplace_back(a);
   }
 
   if (keep_nlte) {
-    for (auto &a : nlte) out.emplace_back(a.first);
+    for (auto &a : nlte.keys()) out.emplace_back(a);
   }
 
   if (keep_ssprops) {
-    for (auto &a : ssprops) out.emplace_back(a.first);
+    for (auto &a : ssprops.keys()) out.emplace_back(a);
   }
 
   if (keep_isots) {
-    for (auto &a : isots) out.emplace_back(a.first);
+    for (auto &a : isots.keys()) out.emplace_back(a);
   }
   return out;
 }
@@ -616,33 +624,33 @@ void Point::check_and_fix() try {
         mag)
   }
 
-  for (auto &spec : specs) {
-    ARTS_USER_ERROR_IF(nonstd::isnan(spec.second) or spec.second < 0.0,
+  for (const auto &[spec, vmr] : specs) {
+    ARTS_USER_ERROR_IF(nonstd::isnan(vmr) or vmr < 0.0,
                        "VMR for \"{}\" is {}",
-                       toString<1>(spec.first),
-                       spec.second)
+                       toString<1>(spec),
+                       vmr)
   }
 
-  for (auto &isot : isots) {
+  for (const auto &[isot, ratio] : isots) {
     //! Cannot check isnan because it is a valid state for isotopologue ratios
-    ARTS_USER_ERROR_IF(isot.second < 0.0,
+    ARTS_USER_ERROR_IF(ratio < 0.0,
                        "Isotopologue ratio for \"{}\" is {}",
-                       isot.first.FullName(),
-                       isot.second)
+                       isot.FullName(),
+                       ratio)
   }
 
-  for (auto &nl : nlte) {
-    ARTS_USER_ERROR_IF(nonstd::isnan(nl.second) or nl.second < 0.0,
+  for (const auto &[level, ratio] : nlte) {
+    ARTS_USER_ERROR_IF(nonstd::isnan(ratio) or ratio < 0.0,
                        "Non-LTE ratio for \"{}\" is {}",
-                       nl.first,
-                       nl.second)
+                       level,
+                       ratio)
   }
 
-  for (auto &pp : ssprops) {
-    ARTS_USER_ERROR_IF(nonstd::isnan(pp.second),
+  for (const auto &[prop, value] : ssprops) {
+    ARTS_USER_ERROR_IF(nonstd::isnan(value),
                        "Scattering Species Property value for \"",
-                       pp.first,
-                       pp.second)
+                       prop,
+                       value)
   }
 }
 ARTS_METHOD_ERROR_CATCH
@@ -887,10 +895,10 @@ struct PositionalNumeric {
   }
 };
 
-std::optional<Numeric> get_optional_limit(const Data &data,
-                                          const Numeric alt,
-                                          const Numeric lat,
-                                          const Numeric lon) {
+ComputeLimit checked_limit(const Data &data,
+                           const Numeric alt,
+                           const Numeric lat,
+                           const Numeric lon) {
   const auto lim = Atm::find_limit(
       data,
       std::visit([](auto &d) { return Atm::find_limits(d); }, data.data),
@@ -905,6 +913,15 @@ std::optional<Numeric> get_optional_limit(const Data &data,
       lim.lat,
       lim.lon)
 
+  return lim;
+}
+
+std::optional<Numeric> get_optional_limit(const Data &data,
+                                          const Numeric alt,
+                                          const Numeric lat,
+                                          const Numeric lon) {
+  const auto lim = checked_limit(data, alt, lat, lon);
+
   if (lim.type == InterpolationExtrapolation::Zero) return 0.0;
 
   if (lim.type == InterpolationExtrapolation::Nearest)
@@ -925,6 +942,27 @@ Numeric Data::at(const Numeric alt,
 
 Numeric Data::at(const Vector3 pos) const { return at(pos[0], pos[1], pos[2]); }
 
+namespace {
+/*! Zero values for all keys of the field data
+
+  Consecutive calls on a thread for fields with the same keys share the
+  schema, so the points of a field share it.
+*/
+template <typename Key>
+PointValues<Key> point_values(const std::unordered_map<Key, Data> &map) {
+  using Schema = typename PointValues<Key>::Schema;
+
+  thread_local std::shared_ptr<Schema> schema{};
+
+  if (not schema or not stdr::equal(schema->keys, map | stdv::keys)) {
+    const std::vector<Key> keys{std::from_range, map | stdv::keys};
+    schema = std::make_shared<Schema>(keys);
+  }
+
+  return PointValues<Key>{schema};
+}
+}  // namespace
+
 Point Field::at(const Numeric alt, const Numeric lat, const Numeric lon) const
     try {
   ARTS_USER_ERROR_IF(
@@ -935,6 +973,10 @@ Point Field::at(const Numeric alt, const Numeric lat, const Numeric lon) const
       alt)
 
   Point out;
+  out.specs   = point_values(specs);
+  out.nlte    = point_values(nlte);
+  out.ssprops = point_values(ssprops);
+
   for (auto &&key : keys()) out[key] = operator[](key).at(alt, lat, lon);
   out.check_and_fix();
   return out;
@@ -945,6 +987,190 @@ Point Field::at(const Vector3 pos) const try {
   return at(pos[0], pos[1], pos[2]);
 }
 ARTS_METHOD_ERROR_CATCH
+
+namespace {
+//! Keys with gridded data on the same grids and with the same extrapolation
+struct grid_group {
+  const Data *data;
+  std::vector<std::pair<Size, const GeodeticField3 *>> keys{};
+};
+
+bool same_grids(const Data &a, const Data &b) {
+  const auto &x = a.get<GeodeticField3>();
+  const auto &y = b.get<GeodeticField3>();
+
+  return a.alt_low == b.alt_low and a.alt_upp == b.alt_upp and
+         a.lat_low == b.lat_low and a.lat_upp == b.lat_upp and
+         a.lon_low == b.lon_low and a.lon_upp == b.lon_upp and
+         stdr::equal(x.grid<0>(), y.grid<0>()) and
+         stdr::equal(x.grid<1>(), y.grid<1>()) and
+         stdr::equal(x.grid<2>(), y.grid<2>());
+}
+
+//! The position of the key in the values of its kind, -1 for AtmKey
+Index point_slot(const Point &p, const KeyVal &key) {
+  return std::visit(
+      [&p]<typename T>(const T &k) -> Index {
+        if constexpr (isAtmKey<T>) return -1;
+        else if constexpr (isSpecies<T>) return p.specs.find(k);
+        else if constexpr (isSpeciesIsotope<T>) return p.isots.find(k);
+        else if constexpr (isQuantumLevelIdentifier<T>) return p.nlte.find(k);
+        else return p.ssprops.find(k);
+      },
+      key);
+}
+
+Numeric &point_value(Point &p, const KeyVal &key, const Index slot) {
+  return std::visit(
+      [&p, slot]<typename T>(const T &k) -> Numeric & {
+        if constexpr (isAtmKey<T>) return p[k];
+        else if constexpr (isSpecies<T>) return p.specs.values()[slot];
+        else if constexpr (isSpeciesIsotope<T>) return p.isots.values()[slot];
+        else if constexpr (isQuantumLevelIdentifier<T>)
+          return p.nlte.values()[slot];
+        else return p.ssprops.values()[slot];
+      },
+      key);
+}
+
+/*! The values of functional data at all positions in one call of its batch
+  function, with the limits applied as by Data::at
+*/
+Vector batch_values(const Data &data, const std::span<const Vector3> &pos) {
+  const auto &f = data.get<FunctionalData>();
+  const Size n  = pos.size();
+
+  if (n == 0) return {};
+
+  Vector alt(n), lat(n), lon(n);
+  std::vector<Size> zero;
+  for (Size i = 0; i < n; i++) {
+    const auto lim =
+        interp::checked_limit(data, pos[i][0], pos[i][1], pos[i][2]);
+    if (lim.type == InterpolationExtrapolation::Zero) zero.push_back(i);
+    alt[i] = lim.alt;
+    lat[i] = lim.lat;
+    lon[i] = lim.lon;
+  }
+
+  Vector out = f.batch(alt, lat, lon);
+  ARTS_USER_ERROR_IF(out.size() != n,
+                     "The batch function gave {} values for {} positions",
+                     out.size(),
+                     n)
+
+  for (Size i : zero) out[i] = 0.0;
+  return out;
+}
+}  // namespace
+
+void Field::at(std::span<Point> out, const std::span<const Vector3> &pos) const
+    try {
+  ARTS_USER_ERROR_IF(out.size() != pos.size(),
+                     "Output size {} does not match the {} positions",
+                     out.size(),
+                     pos.size())
+
+  for (auto &p : pos) {
+    ARTS_USER_ERROR_IF(
+        p[0] > top_of_atmosphere,
+        "Cannot get values above the top of the atmosphere, which is at: {}"
+        " m.\nYour max input altitude is: {} m.",
+        top_of_atmosphere,
+        p[0])
+  }
+
+  const std::vector<KeyVal> ks = keys();
+  const Size nk                = ks.size();
+
+  //! All points are copies of this, so they share the schemas
+  Point base;
+  base.specs   = point_values(specs);
+  base.nlte    = point_values(nlte);
+  base.ssprops = point_values(ssprops);
+  for (auto &key : ks) base[key] = 0.0;
+
+  std::vector<Index> slots(nk);
+  for (Size i = 0; i < nk; i++) slots[i] = point_slot(base, ks[i]);
+
+  std::vector<grid_group> groups;
+  std::vector<Size> ungridded;
+  std::vector<std::pair<Size, Vector>> batched;
+  for (Size i = 0; i < nk; i++) {
+    const Data &data = operator[](ks[i]);
+
+    if (std::holds_alternative<FunctionalData>(data.data) and
+        data.get<FunctionalData>().batch) {
+      batched.emplace_back(i, batch_values(data, pos));
+      continue;
+    }
+
+    if (not std::holds_alternative<GeodeticField3>(data.data)) {
+      ungridded.push_back(i);
+      continue;
+    }
+
+    const auto &gf3 = data.get<GeodeticField3>();
+    ARTS_USER_ERROR_IF(not gf3.ok(), "Bad field for key {}", ks[i])
+
+    auto ptr = stdr::find_if(
+        groups, [&data](auto &g) { return same_grids(*g.data, data); });
+    if (ptr == groups.end()) ptr = groups.insert(ptr, grid_group{&data});
+    ptr->keys.emplace_back(i, &gf3);
+  }
+
+  std::string error{};
+
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Size ip = 0; ip < pos.size(); ip++) {
+    try {
+      const auto [alt, lat, lon] = pos[ip];
+
+      Point &p = out[ip];
+      p        = base;
+
+      for (Size i : ungridded) {
+        point_value(p, ks[i], slots[i]) = operator[](ks[i]).at(alt, lat, lon);
+      }
+
+      for (auto &[i, v] : batched) point_value(p, ks[i], slots[i]) = v[ip];
+
+      for (auto &g : groups) {
+        const auto &grids = g.data->get<GeodeticField3>();
+        const auto lim    = interp::checked_limit(*g.data, alt, lat, lon);
+
+        if (lim.type == InterpolationExtrapolation::Zero) {
+          for (auto &[i, gf3] : g.keys) point_value(p, ks[i], slots[i]) = 0.0;
+          continue;
+        }
+
+        const auto al    = interp::altlag(grids.grid<0>(), lim.alt);
+        const auto la    = interp::latlag(grids.grid<1>(), lim.lat);
+        const auto lo    = interp::lonlag(grids.grid<2>(), lim.lon);
+        const Tensor3 iw = interp::interpweights(al, la, lo);
+
+        for (auto &[i, gf3] : g.keys) {
+          point_value(p, ks[i], slots[i]) = interp::get(*gf3, iw, al, la, lo);
+        }
+      }
+
+      p.check_and_fix();
+    } catch (std::exception &e) {
+#pragma omp critical
+      if (error.empty()) error = e.what();
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+}
+ARTS_METHOD_ERROR_CATCH
+
+std::vector<Point> Field::at(const std::span<const Vector3> &pos) const try {
+  std::vector<Point> out(pos.size());
+  at(out, pos);
+  return out;
+}
+ARTS_METHOD_ERROR_CATCH
 }  // namespace Atm
 
 std::string std::formatter<AtmKeyVal>::to_string(const AtmKeyVal &v) const {
@@ -1286,16 +1512,16 @@ std::string std::formatter<AtmPoint>::to_string(const AtmPoint &v) const {
 
   } else {
     out += tags.vformat(R"("SpeciesEnum": )"sv,
-                        v.specs,
+                        v.specs.map(),
                         sep,
                         R"("SpeciesIsotope": )"sv,
-                        v.isots,
+                        v.isots.map(),
                         sep,
                         R"("QuantumLevelIdentifier": )"sv,
-                        v.nlte,
+                        v.nlte.map(),
                         sep,
                         R"("ScatteringSpeciesProperty": )"sv,
-                        v.ssprops);
+                        v.ssprops.map());
   }
 
   return tags.bracket ? ("{" + out + "}") : out;
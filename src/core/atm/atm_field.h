@@ -12,7 +12,12 @@
 #include <quantum.h>
 #include <species.h>
 
+#include <memory>
+#include <span>
 #include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 AtmKey to_wind(const String &);
 AtmKey to_mag(const String &);
@@ -64,12 +69,179 @@ concept ListOfNumeric = requires(T a) {
   { matpack::mdvalue(a, {Index{0}}) } -> std::same_as<Numeric>;
 };
 
+/*! The values of one kind of key of a Point
+
+  The keys are held by a schema that is shared between points, so a point
+  only holds a dense array of values and copying it allocates once, not once
+  per key.  Species and isotopologues are looked up in a table indexed by the
+  species or isotopologue index, other keys in a hash map of the schema.
+
+  Setting a key that is not in the schema gives the point its own schema.
+*/
+template <typename Key>
+class PointValues {
+ public:
+  struct Schema {
+    static constexpr bool indexed = isSpecies<Key> or isSpeciesIsotope<Key>;
+
+    std::vector<Key> keys{};
+    std::vector<Index> slots{};
+    std::unordered_map<Key, Size> index{};
+
+    Schema() = default;
+
+    explicit Schema(std::span<const Key> ks) {
+      keys.reserve(ks.size());
+      for (auto &key : ks) push_back(key);
+    }
+
+    //! The position of the key in keys, or -1
+    [[nodiscard]] Index find(const Key &key) const {
+      if constexpr (indexed) {
+        return slots.empty() ? -1 : slots[slot(key)];
+      } else {
+        const auto ptr = index.find(key);
+        return ptr == index.end() ? -1 : static_cast<Index>(ptr->second);
+      }
+    }
+
+    void push_back(const Key &key) {
+      if constexpr (indexed) {
+        if (slots.empty()) slots.resize(nslots(), -1);
+        slots[slot(key)] = static_cast<Index>(keys.size());
+      } else {
+        index.emplace(key, keys.size());
+      }
+
+      keys.push_back(key);
+    }
+
+   private:
+    static constexpr Size nslots() {
+      if constexpr (isSpecies<Key>) {
+        return static_cast<Size>(enumsize::SpeciesEnumSize);
+      } else {
+        return Species::Isotopologues.size();
+      }
+    }
+
+    static Size slot(const Key &key) {
+      if constexpr (isSpecies<Key>) {
+        return static_cast<Size>(key);
+      } else {
+        return static_cast<Size>(Species::find_species_index(key));
+      }
+    }
+  };
+
+ private:
+  std::shared_ptr<Schema> schema{};
+  std::vector<Numeric> data{};
+
+  template <bool is_const>
+  struct iterator_t {
+    using value_t = std::conditional_t<is_const, const Numeric, Numeric>;
+
+    const Key *key;
+    value_t *value;
+
+    std::pair<const Key &, value_t &> operator*() const {
+      return {*key, *value};
+    }
+
+    iterator_t &operator++() {
+      ++key;
+      ++value;
+      return *this;
+    }
+
+    bool operator==(const iterator_t &) const = default;
+  };
+
+ public:
+  using iterator       = iterator_t<false>;
+  using const_iterator = iterator_t<true>;
+
+  PointValues() = default;
+
+  //! All keys of the schema, with zero values
+  explicit PointValues(std::shared_ptr<Schema> s)
+      : schema(std::move(s)), data(schema ? schema->keys.size() : 0, 0.0) {}
+
+  explicit PointValues(const std::unordered_map<Key, Numeric> &map) {
+    for (auto &[key, value] : map) operator[](key) = value;
+  }
+
+  [[nodiscard]] Size size() const { return data.size(); }
+  [[nodiscard]] bool empty() const { return data.empty(); }
+
+  [[nodiscard]] bool contains(const Key &key) const {
+    return find(key) >= 0;
+  }
+
+  //! The position of the key in values(), or -1
+  [[nodiscard]] Index find(const Key &key) const {
+    return schema ? schema->find(key) : -1;
+  }
+
+  //! The value of key, throws std::out_of_range if it is missing
+  [[nodiscard]] Numeric at(const Key &key) const {
+    const Index i = schema ? schema->find(key) : -1;
+    if (i < 0) throw std::out_of_range("Key not found");
+    return data[i];
+  }
+
+  //! The value of key, it is added with a zero value if it is missing
+  Numeric &operator[](const Key &key) {
+    if (const Index i = schema ? schema->find(key) : -1; i >= 0) {
+      return data[i];
+    }
+
+    if (not schema) {
+      schema = std::make_shared<Schema>();
+    } else if (schema.use_count() > 1) {
+      schema = std::make_shared<Schema>(*schema);
+    }
+
+    schema->push_back(key);
+    return data.emplace_back(0.0);
+  }
+
+  void clear() {
+    schema.reset();
+    data.clear();
+  }
+
+  [[nodiscard]] std::span<const Key> keys() const {
+    return schema ? std::span<const Key>{schema->keys} : std::span<const Key>{};
+  }
+
+  [[nodiscard]] std::span<const Numeric> values() const { return data; }
+  [[nodiscard]] std::span<Numeric> values() { return data; }
+
+  [[nodiscard]] std::unordered_map<Key, Numeric> map() const {
+    std::unordered_map<Key, Numeric> out;
+    for (const auto &[key, value] : *this) out.emplace(key, value);
+    return out;
+  }
+
+  [[nodiscard]] iterator begin() { return {keys().data(), data.data()}; }
+  [[nodiscard]] iterator end() {
+    return {keys().data() + size(), data.data() + size()};
+  }
+  [[nodiscard]] const_iterator begin() const {
+    return {keys().data(), data.data()};
+  }
+  [[nodiscard]] const_iterator end() const {
+    return {keys().data() + size(), data.data() + size()};
+  }
+};
+
 struct Point {
-  using SpeciesMap        = std::unordered_map<SpeciesEnum, Numeric>;
-  using SpeciesIsotopeMap = std::unordered_map<SpeciesIsotope, Numeric>;
-  using NlteMap           = std::unordered_map<QuantumLevelIdentifier, Numeric>;
-  using ScatteringSpeciesMap =
-      std::unordered_map<ScatteringSpeciesProperty, Numeric>;
+  using SpeciesMap           = PointValues<SpeciesEnum>;
+  using SpeciesIsotopeMap    = PointValues<SpeciesIsotope>;
+  using NlteMap              = PointValues<QuantumLevelIdentifier>;
+  using ScatteringSpeciesMap = PointValues<ScatteringSpeciesProperty>;
 
   SpeciesMap specs{};
   SpeciesIsotopeMap isots{};
@@ -112,15 +284,15 @@ struct Point {
   constexpr bool has(T &&key, Ts &&...keys) const {
     const auto has_ = [](auto &x [[maybe_unused]], auto &&k [[maybe_unused]]) {
       if constexpr (isSpecies<T>)
-        return x.specs.end() not_eq x.specs.find(std::forward<T>(k));
+        return x.specs.contains(std::forward<T>(k));
       else if constexpr (isSpeciesIsotope<T>)
-        return x.isots.end() not_eq x.isots.find(std::forward<T>(k));
+        return x.isots.contains(std::forward<T>(k));
       else if constexpr (isAtmKey<T>)
         return true;
       else if constexpr (isQuantumLevelIdentifier<T>)
-        return x.nlte.end() not_eq x.nlte.find(std::forward<T>(k));
+        return x.nlte.contains(std::forward<T>(k));
       else if constexpr (isScatteringSpeciesProperty<T>)
-        return x.ssprops.end() not_eq x.ssprops.find(std::forward<T>(k));
+        return x.ssprops.contains(std::forward<T>(k));
     };
 
     if constexpr (N > 0)
@@ -307,6 +479,23 @@ struct Field final {
   //! Compute the values at a single point
   [[nodiscard]] Point at(const Vector3 pos) const;
 
+  /*! Compute the values at many points
+
+    Gives the same points as at(pos[i]) for all i.  The keys with gridded
+    data on the same grids and with the same extrapolation are interpolated
+    with the same weights, computed once per point, and the points share
+    the schemas of their keys.  Functional data with a batch function are
+    evaluated for all positions in a single call.
+
+    @param[out] out The points, same size as pos
+    @param[in] pos The positions [alt, lat, lon]
+  */
+  void at(std::span<Point> out, const std::span<const Vector3> &pos) const;
+
+  //! Compute the values at many points, see above
+  [[nodiscard]] std::vector<Point> at(
+      const std::span<const Vector3> &pos) const;
+
   [[nodiscard]] Size size() const;
   [[nodiscard]] Size nspec() const;
   [[nodiscard]] Size nisot() const;
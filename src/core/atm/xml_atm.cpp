@@ -9,11 +9,21 @@ void xml_io_stream<AtmPoint>::read(std::istream& is,
   tag.read_from_stream(is);
   tag.check_name(type_name);
 
-  xml_read_from_stream(is, v.specs, pbifs);
-  xml_read_from_stream(is, v.isots, pbifs);
-  xml_read_from_stream(is, v.nlte, pbifs);
-  xml_read_from_stream(is, v.ssprops, pbifs);
+  std::unordered_map<SpeciesEnum, Numeric> specs;
+  std::unordered_map<SpeciesIsotope, Numeric> isots;
+  std::unordered_map<QuantumLevelIdentifier, Numeric> nlte;
+  std::unordered_map<ScatteringSpeciesProperty, Numeric> ssprops;
+
+  xml_read_from_stream(is, specs, pbifs);
+  xml_read_from_stream(is, isots, pbifs);
+  xml_read_from_stream(is, nlte, pbifs);
+  xml_read_from_stream(is, ssprops, pbifs);
   xml_read_from_stream(is, v.pressure, pbifs);
+
+  v.specs   = AtmPoint::SpeciesMap{specs};
+  v.isots   = AtmPoint::SpeciesIsotopeMap{isots};
+  v.nlte    = AtmPoint::NlteMap{nlte};
+  v.ssprops = AtmPoint::ScatteringSpeciesMap{ssprops};
   xml_read_from_stream(is, v.temperature, pbifs);
   xml_read_from_stream(is, v.wind, pbifs);
   xml_read_from_stream(is, v.mag, pbifs);
@@ -29,10 +39,10 @@ void xml_io_stream<AtmPoint>::write(std::ostream& os,
   XMLTag tag(type_name, "name", name);
   tag.write_to_stream(os);
 
-  xml_write_to_stream(os, v.specs, pbofs, "Species Data"sv);
-  xml_write_to_stream(os, v.isots, pbofs, "Isotopologue Data"sv);
-  xml_write_to_stream(os, v.nlte, pbofs, "NLTE Data"sv);
-  xml_write_to_stream(os, v.ssprops, pbofs, "Scattering Data"sv);
+  xml_write_to_stream(os, v.specs.map(), pbofs, "Species Data"sv);
+  xml_write_to_stream(os, v.isots.map(), pbofs, "Isotopologue Data"sv);
+  xml_write_to_stream(os, v.nlte.map(), pbofs, "NLTE Data"sv);
+  xml_write_to_stream(os, v.ssprops.map(), pbofs, "Scattering Data"sv);
   xml_write_to_stream(os, v.pressure, pbofs, "pressure"sv);
   xml_write_to_stream(os, v.temperature, pbofs, "temperature"sv);
   xml_write_to_stream(os, v.wind, pbofs, "wind field"sv);
@@ -0,0 +1,199 @@
+#include <disort-test.h>
+
+#include <cmath>
+
+#include "artstime.h"
+#include "disort.h"
+
+void test_update_sources() try {
+  const AscendingGrid tau_arr{0.5, 1.0, 2.0, 4.0};
+  const Vector omega_arr{0.1, 0.5, 0.9, 0.3};
+  const Index NQuad    = 8;
+  const Index NLeg     = NQuad;
+  const Index NFourier = NQuad;
+
+  Matrix Leg_coeffs_all(tau_arr.size(), 2 * NQuad);
+  for (auto&& v : Leg_coeffs_all) {
+    for (Size i = 0; i < v.size(); i++) {
+      v[i] = std::pow(0.75, static_cast<Numeric>(i));
+    }
+  }
+  const Vector f_arr{Leg_coeffs_all[joker, NQuad]};
+
+  const Numeric mu0  = 0.6;
+  const Numeric I0   = 0.0;
+  const Numeric phi0 = 0.0;
+
+  Matrix b_neg(NFourier, NQuad / 2, 0);
+  b_neg[0] = 1;
+  Matrix b_pos(NFourier, NQuad / 2, 0);
+  b_pos[0] = 2;
+  Matrix s_poly_coeffs(tau_arr.size(), 2);
+  for (auto&& v : s_poly_coeffs) v = std::array{3.0, -0.5};
+
+  const disort::main_data orig(NQuad,
+                               NLeg,
+                               NFourier,
+                               tau_arr,
+                               omega_arr,
+                               Leg_coeffs_all,
+                               b_pos,
+                               b_neg,
+                               f_arr,
+                               s_poly_coeffs,
+                               {},
+                               mu0,
+                               I0,
+                               phi0);
+
+  b_neg[0]         = 1.5;
+  b_pos[0]         = 2.5;
+  s_poly_coeffs[2] = std::array{3.5, -0.4};
+
+  const disort::main_data full(NQuad,
+                               NLeg,
+                               NFourier,
+                               tau_arr,
+                               omega_arr,
+                               Leg_coeffs_all,
+                               b_pos,
+                               b_neg,
+                               f_arr,
+                               s_poly_coeffs,
+                               {},
+                               mu0,
+                               I0,
+                               phi0);
+
+  disort::main_data dis   = orig;
+  dis.positive_boundary() = b_pos;
+  dis.negative_boundary() = b_neg;
+  dis.source_poly()       = s_poly_coeffs;
+  dis.update_sources();
+
+  const Vector taus{0.1, 1.5, 3.9};
+  const Vector phis{0.0, 1.0};
+
+  if (not is_good(compute_u(dis, taus, phis, false),
+                  compute_u(full, taus, phis, false))) {
+    throw std::runtime_error("update_sources differs from update_all");
+  }
+
+  if (is_good(compute_u(orig, taus, phis, false),
+              compute_u(full, taus, phis, false))) {
+    throw std::runtime_error("The sources do not change the radiance");
+  }
+} catch (std::exception& e) {
+  throw std::runtime_error(
+      std::format("Error in test-update-sources:\n{}", e.what()));
+}
+
+void test_reuse_eigensystem() try {
+  const AscendingGrid tau_arr{0.5, 1.0, 2.0, 4.0};
+  const AscendingGrid tau_arr2{0.6, 1.2, 2.1, 4.5};
+  const Vector omega_arr{0.1, 0.5, 0.9, 0.3};
+  const Index NQuad    = 8;
+  const Index NLeg     = NQuad;
+  const Index NFourier = NQuad;
+
+  Matrix Leg_coeffs_all(tau_arr.size(), 2 * NQuad);
+  for (auto&& v : Leg_coeffs_all) {
+    for (Size i = 0; i < v.size(); i++) {
+      v[i] = std::pow(0.5, static_cast<Numeric>(i));
+    }
+  }
+  const Vector f_arr{Leg_coeffs_all[joker, NQuad]};
+
+  const Numeric mu0  = 0.6;
+  const Numeric I0   = Constant::pi / mu0;
+  const Numeric phi0 = 0.9 * Constant::pi;
+
+  Matrix b_neg(NFourier, NQuad / 2, 0);
+  b_neg[0] = 1;
+  Matrix b_pos(NFourier, NQuad / 2, 0);
+  b_pos[0] = 2;
+  Matrix s_poly_coeffs(tau_arr.size(), 2);
+  for (auto&& v : s_poly_coeffs) v = std::array{3.0, -0.5};
+
+  disort::main_data dis(NQuad,
+                        NLeg,
+                        NFourier,
+                        tau_arr,
+                        omega_arr,
+                        Leg_coeffs_all,
+                        b_pos,
+                        b_neg,
+                        f_arr,
+                        s_poly_coeffs,
+                        {},
+                        mu0,
+                        I0,
+                        phi0);
+
+  const Vector taus{0.1, 1.5, 3.9};
+  const Vector phis{0.0, 1.0};
+
+  // Only the optical thickness changes, the eigensystem is reused
+  const disort::main_data full(NQuad,
+                               NLeg,
+                               NFourier,
+                               tau_arr2,
+                               omega_arr,
+                               Leg_coeffs_all,
+                               b_pos,
+                               b_neg,
+                               f_arr,
+                               s_poly_coeffs,
+                               {},
+                               mu0,
+                               I0,
+                               phi0);
+
+  dis.tau(tau_arr2.vec());
+  dis.update_all(I0);
+
+  if (not is_good(compute_u(dis, taus, phis, true),
+                  compute_u(full, taus, phis, true))) {
+    throw std::runtime_error("Reused eigensystem differs");
+  }
+
+  // Only the sources change, the factorization is reused
+  b_neg[0]         = 1.5;
+  s_poly_coeffs[1] = std::array{3.5, -0.4};
+
+  const disort::main_data full2(NQuad,
+                                NLeg,
+                                NFourier,
+                                tau_arr2,
+                                omega_arr,
+                                Leg_coeffs_all,
+                                b_pos,
+                                b_neg,
+                                f_arr,
+                                s_poly_coeffs,
+                                {},
+                                mu0,
+                                I0,
+                                phi0);
+
+  dis.negative_boundary() = b_neg;
+  dis.source_poly()       = s_poly_coeffs;
+  dis.update_all(I0);
+
+  if (not is_good(compute_u(dis, taus, phis, true),
+                  compute_u(full2, taus, phis, true))) {
+    throw std::runtime_error("Reused factorization differs");
+  }
+} catch (std::exception& e) {
+  throw std::runtime_error(
+      std::format("Error in test-reuse-eigensystem:\n{}", e.what()));
+}
+
+int main() try {
+  std::cout << std::setprecision(16);
+  test_update_sources();
+  test_reuse_eigensystem();
+} catch (std::exception& e) {
+  std::cerr << "Error in main:\n" << e.what() << '\n';
+  return EXIT_FAILURE;
+}
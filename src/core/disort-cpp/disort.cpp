@@ -10,12 +10,23 @@
 #include <xml.h>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstring>
+#include <iterator>
+#include <memory>
 #include <numeric>
 #include <ranges>
+#include <utility>
 #include <vector>
 
+namespace {
+bool same_elems(const auto& a, const auto& b) {
+  return a.shape() == b.shape() and
+         std::equal(a.elem_begin(), a.elem_end(), b.elem_begin());
+}
+}  // namespace
+
 namespace disort {
 void radiances::resize(AscendingGrid f_grid,
                        DescendingGrid alt_grid_,
@@ -183,6 +194,9 @@ void main_data::solve_for_coefs() {
 
   const Index ln = NLayers - 1;
 
+  // BDRFs cannot be compared, so their system is always factorized again
+  const bool refactorize = not factorized or NBDRF > 0;
+
   //! FIXME: Original code is transposed, but I suspect it is a bug
   auto RHS_middle = RHS[Range{N, n - NQuad}].view_as(NLayers - 1, NQuad);
 
@@ -255,8 +269,9 @@ void main_data::solve_for_coefs() {
       }
     }
 
-    // Fill LHS
-    {
+    // Fill and factorize LHS
+    auto& LHSB_m = LHSB[m];
+    if (refactorize) {
       ARTS_NAMED_TIME_REPORT("disort::lhs"s);
 
       if (BDRF_bool) {
@@ -267,11 +282,12 @@ void main_data::solve_for_coefs() {
 
       for (Index j = 0; j < N; j++) {
         for (Index i = 0; i < N; i++) {
-          LHSB[i, j]     = G_collect_m[0, i + N, j];
-          LHSB[i, N + j] = G_collect_m[0, i + N, j + N] * expK_collect[m, 0, j];
-          LHSB[n - N + i, n - 2 * N + j] =
+          LHSB_m[i, j]     = G_collect_m[0, i + N, j];
+          LHSB_m[i, N + j] =
+              G_collect_m[0, i + N, j + N] * expK_collect[m, 0, j];
+          LHSB_m[n - N + i, n - 2 * N + j] =
               (G_collect_m[ln, i, j] - BDRF_LHS[i, j]) * expK_collect[m, ln, j];
-          LHSB[n - N + i, n - N + j] =
+          LHSB_m[n - N + i, n - N + j] =
               G_collect_m[ln, i, j + N] - BDRF_LHS[i, j + N];
         }
       }
@@ -281,36 +297,41 @@ void main_data::solve_for_coefs() {
           const Numeric e1 = 1.0 / expK_collect[m, l, j + N];
           const Numeric e2 = 1.0 / expK_collect[m, l + 1, j + N];
           for (Index i = 0; i < N; i++) {
-            LHSB[N + l * NQuad + i, l * NQuad + j] = G_collect_m[l, i, j] * e1;
-            LHSB[2 * N + l * NQuad + i, l * NQuad + j] =
+            LHSB_m[N + l * NQuad + i, l * NQuad + j] =
+                G_collect_m[l, i, j] * e1;
+            LHSB_m[2 * N + l * NQuad + i, l * NQuad + j] =
                 G_collect_m[l, N + i, j] * e1;
-            LHSB[N + l * NQuad + i, l * NQuad + 2 * NQuad - N + j] =
+            LHSB_m[N + l * NQuad + i, l * NQuad + 2 * NQuad - N + j] =
                 -G_collect_m[l + 1, i, N + j] * e2;
-            LHSB[2 * N + l * NQuad + i, l * NQuad + 2 * NQuad - N + j] =
+            LHSB_m[2 * N + l * NQuad + i, l * NQuad + 2 * NQuad - N + j] =
                 -G_collect_m[l + 1, N + i, N + j] * e2;
           }
         }
 
         for (Index i = 0; i < NQuad; i++) {
           for (Index j = 0; j < N; j++) {
-            LHSB[N + l * NQuad + i, l * NQuad + N + j] =
+            LHSB_m[N + l * NQuad + i, l * NQuad + N + j] =
                 G_collect_m[l, i, N + j];
-            LHSB[N + l * NQuad + i, l * NQuad + 2 * N + j] =
+            LHSB_m[N + l * NQuad + i, l * NQuad + 2 * N + j] =
                 -G_collect_m[l + 1, i, j];
           }
         }
       }
+
+      LHSB_m.factorize();
     }
 
     {
       ARTS_NAMED_TIME_REPORT("disort::solve-band"s);
 
-      LHSB.solve(RHS);
+      LHSB_m.solve_factorized(RHS);
 
       einsum<"ijm", "ijm", "im">(
           GC_collect[m], G_collect_m, RHS.view_as(NLayers, NQuad));
     }
   }
+
+  factorized = NBDRF == 0;
 }
 
 namespace {
@@ -439,6 +460,14 @@ void main_data::diagonalize() {
       }
     }
   }
+
+  eigen_Leg_coeffs = weighted_scaled_Leg_coeffs;
+  eigen_omega      = scaled_omega_arr;
+  eigen_mu0        = mu0;
+  eigen_I0         = I0;
+  eigen_beam       = has_beam_source;
+  transmission_tau.resize(0);
+  factorized = false;
 }
 
 /** Computes the IMS factors
@@ -655,6 +684,9 @@ void main_data::transmission() {
       K_collect,
       scaled_tau_arr_with_0[Range(1, NLayers)],
       scaled_tau_arr_with_0[Range(0, NLayers)]);
+
+  transmission_tau = scaled_tau_arr_with_0;
+  factorized       = false;
 }
 
 void main_data::source_function() {
@@ -683,8 +715,27 @@ void main_data::update_all(const Numeric I0_) try {
   if (I0_ >= 0) set_beam_source(I0_);
   set_scales();
   set_ims_factors();
-  diagonalize();
-  transmission();
+  if (not same_eigensystem()) diagonalize();
+  if (not same_transmission()) transmission();
+  source_function();
+  solve_for_coefs();
+}
+ARTS_METHOD_ERROR_CATCH
+
+bool main_data::same_eigensystem() const {
+  return eigen_mu0 == mu0 and eigen_I0 == I0 and
+         eigen_beam == has_beam_source and
+         same_elems(eigen_omega, scaled_omega_arr) and
+         same_elems(eigen_Leg_coeffs, weighted_scaled_Leg_coeffs);
+}
+
+bool main_data::same_transmission() const {
+  return same_elems(transmission_tau, scaled_tau_arr_with_0);
+}
+
+void main_data::update_sources() try {
+  ARTS_TIME_REPORT
+
   source_function();
   solve_for_coefs();
 }
@@ -760,7 +811,7 @@ main_data::main_data(const Index NLayers_,
       D_temp(N, NLeg),
       solve_work(NQuad),
       diag_work(N),
-      LHSB(3 * N - 1, 3 * N - 1, n, n),
+      LHSB(NFourier, matpack::band_matrix(3 * N - 1, 3 * N - 1, n, n)),
       comp_data(NQuad, Nscoeffs) {
   ARTS_TIME_REPORT
 
@@ -857,7 +908,7 @@ main_data::main_data(const Index NQuad_,
       D_temp(N, NLeg),
       solve_work(NQuad),
       diag_work(N),
-      LHSB(3 * N - 1, 3 * N - 1, n, n),
+      LHSB(NFourier, matpack::band_matrix(3 * N - 1, 3 * N - 1, n, n)),
       comp_data(NQuad, Nscoeffs) {
   ARTS_TIME_REPORT
 
@@ -1561,6 +1612,48 @@ ZenGriddedField1 main_data::gridded_weights() const {
 
   return disort_quadrature;
 }
+
+namespace {
+struct main_data_pool {
+  static constexpr Size max_size = 8;
+
+  std::vector<std::pair<std::array<Index, 7>, std::unique_ptr<main_data>>>
+      free{};
+};
+
+thread_local main_data_pool pool{};
+}  // namespace
+
+main_data_lease::main_data_lease(const Index NLayers,
+                                 const Index NQuad,
+                                 const Index NLeg,
+                                 const Index NFourier,
+                                 const Index Nscoeffs,
+                                 const Index NLeg_all,
+                                 const Index NBDRF)
+    : key{NLayers, NQuad, NLeg, NFourier, Nscoeffs, NLeg_all, NBDRF} {
+  auto& free = pool.free;
+
+  // Most recently returned first
+  auto ptr = std::find_if(free.rbegin(), free.rend(), [this](auto& x) {
+    return x.first == key;
+  });
+
+  if (ptr != free.rend()) {
+    data = std::move(ptr->second);
+    free.erase(std::next(ptr).base());
+  } else {
+    data = std::make_unique<main_data>(
+        NLayers, NQuad, NLeg, NFourier, Nscoeffs, NLeg_all, NBDRF);
+  }
+}
+
+main_data_lease::~main_data_lease() {
+  auto& free = pool.free;
+
+  if (free.size() == main_data_pool::max_size) free.erase(free.begin());
+  free.emplace_back(key, std::move(data));
+}
 }  // namespace disort
 
 void DisortSettings::resize(Index quadrature_dimension_,
@@ -1642,6 +1735,19 @@ disort::main_data DisortSettings::init() const try {
 }
 ARTS_METHOD_ERROR_CATCH
 
+disort::main_data_lease DisortSettings::lease() const try {
+  check();
+  return disort::main_data_lease(
+      alt_grid.size() - 1,
+      quadrature_dimension,
+      legendre_coefficients.ncols(),
+      fourier_mode_dimension,
+      source_polynomial.ncols(),
+      legendre_polynomial_dimension,
+      bidirectional_reflectance_distribution_functions.ncols());
+}
+ARTS_METHOD_ERROR_CATCH
+
 disort::main_data& DisortSettings::set(disort::main_data& dis, Index iv) const
     try {
   using Conversion::cosd;
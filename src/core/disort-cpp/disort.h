@@ -4,8 +4,10 @@
 #include <operators.h>
 #include <xml.h>
 
+#include <array>
 #include <format>
 #include <iosfwd>
+#include <memory>
 #include <string_view>
 
 #include "disort-eigen.h"
@@ -192,12 +194,29 @@ class main_data {
   //! [4 * N] + [N, N]
   real_diagonalize_workdata diag_work{};
 
-  //! [n, 9 * N - 2] + [n / 2]
-  matpack::band_matrix LHSB{};
+  //! [NFourier] x ([n, 9 * N - 2] + [n / 2]), LU factorized
+  std::vector<matpack::band_matrix> LHSB{};
 
   //! [NQuad, Nscoeffs] + [NQuad, NQuad] + 3 * [Nquad] + [Nscoeffs]
   mathscr_v_data comp_data{};
 
+  //! The inputs of the last diagonalize and transmission
+  Matrix eigen_Leg_coeffs{};  // [NLayers, NLeg]
+  Vector eigen_omega{};       // [NLayers]
+  Numeric eigen_mu0{};
+  Numeric eigen_I0{};
+  bool eigen_beam{false};
+  Vector transmission_tau{};  // [NLayers + 1]
+
+  //! Whether LHSB holds the factorization for the current optics
+  bool factorized{false};
+
+  //! Whether diagonalize would give the current G, K, and B collections
+  [[nodiscard]] bool same_eigensystem() const;
+
+  //! Whether transmission would give the current expK collection
+  [[nodiscard]] bool same_transmission() const;
+
  public:
   friend struct std::formatter<main_data>;
 
@@ -547,12 +566,33 @@ class main_data {
     * Additionally, this calls check_input_value to ensure that the input
     * values are valid.
     *
+    * The diagonalization only depends on the scaled single scattering albedo
+    * and Legendre coefficients and on the beam.  If these are the same as in
+    * the previous call, e.g., for neighbouring frequencies, the eigensystem is
+    * reused.  If the optical thicknesses are also the same and there are no
+    * BDRFs, the factorization of the system of equations is reused as well.
+    *
     * Not safe for parallel use.
     * 
     * @param I0 The new beam intensity if it should be changed, otherwise -1
     */
   void update_all(const Numeric I0 = -1);
 
+  /** Updates the internal data after changing only the sources
+    *
+    * The sources are the source polynomial coefficients and the boundary
+    * conditions.  The radiance is linear in these, and the diagonalization
+    * and transmission do not depend on them, so only the source function is
+    * recomputed and the system of equations is solved again.
+    *
+    * The rest of the internal data must be up-to-date, e.g., by a previous
+    * call to update_all.  If there is a beam source, the beam is normalized
+    * by the boundary conditions, so update_all must be used instead.
+    *
+    * Not safe for parallel use.
+    */
+  void update_sources();
+
   //! The angles of quadrature - NQuad
   [[nodiscard]] auto&& mu() const { return mu_arr; }
 
@@ -642,6 +682,46 @@ class main_data {
   //! Get weights on a grid
   [[nodiscard]] ZenGriddedField1 gridded_weights() const;
 };
+
+/** A main_data from a per-thread pool
+ *
+ * The pool is keyed by the dimensions of main_data.  A lease of the same
+ * dimensions as an earlier lease on the same thread gets the same buffers
+ * back, so repeated DISORT calls do not allocate after the first one, and
+ * the memory in use does not grow over a long run.  The pool keeps a few
+ * sets of dimensions per thread, the least recently used are freed.
+ *
+ * The data is left as the previous user left it.  This is safe as
+ * update_all sets all internal data, and it lets update_all reuse the
+ * eigensystem of the previous user if it is the same.
+ *
+ * Must be destroyed on the thread that created it.
+ */
+class main_data_lease {
+  using key_t = std::array<Index, 7>;
+
+  key_t key;
+  std::unique_ptr<main_data> data;
+
+ public:
+  main_data_lease(const Index NLayers,
+                  const Index NQuad,
+                  const Index NLeg,
+                  const Index NFourier,
+                  const Index Nscoeffs,
+                  const Index NLeg_all,
+                  const Index NBDRF);
+
+  main_data_lease(const main_data_lease&)            = delete;
+  main_data_lease(main_data_lease&&)                 = delete;
+  main_data_lease& operator=(const main_data_lease&) = delete;
+  main_data_lease& operator=(main_data_lease&&)      = delete;
+
+  ~main_data_lease();
+
+  [[nodiscard]] main_data& operator*() { return *data; }
+  [[nodiscard]] main_data* operator->() { return data.get(); }
+};
 }  // namespace disort
 
 using DisortBDRF         = disort::BDRF;
@@ -701,7 +781,11 @@ struct DisortSettings {
   [[nodiscard]] Index layer_count() const { return alt_grid.size() - 1; }
 
   [[nodiscard]] disort::main_data init() const;
+
+  //! As init, but from the per-thread pool of main_data
+  [[nodiscard]] disort::main_data_lease lease() const;
   disort::main_data& set(disort::main_data&, Index iv) const;
+
 #ifdef ENABLE_CDISORT
   disort::main_data& set_cdisort(disort::main_data&, Index iv) const;
 #endif
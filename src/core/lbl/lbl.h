@@ -1,6 +1,10 @@
 #pragma once
 
+#include "lbl_band_soa.h"
+#include "lbl_cache.h"
 #include "lbl_data.h"
+#include "lbl_frequency_index.h"
+#include "lbl_hash.h"
 #include "lbl_fwd.h"
 #include "lbl_hitran.h"
 #include "lbl_jpl.h"
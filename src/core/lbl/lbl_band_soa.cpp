@@ -0,0 +1,102 @@
+#include "lbl_band_soa.h"
+
+#include <arts_constexpr_math.h>
+#include <nonstd.h>
+
+#include "lbl_hash.h"
+#include "lbl_temperature_model.h"
+
+namespace lbl {
+namespace {
+constexpr std::array<LineShapeModelVariable, band_soa::nvariables> variables{
+    LineShapeModelVariable::G0,
+    LineShapeModelVariable::D0,
+    LineShapeModelVariable::DV,
+    LineShapeModelVariable::G,
+    LineShapeModelVariable::Y};
+}  // namespace
+
+band_soa::band_soa(const band_data& band)
+    : f0(band.size()),
+      f0_cubed(band.size()),
+      strength(band.size()),
+      e0(band.size()),
+      T0(band.size()),
+      zeeman(band.size()),
+      species_first(band.size() + 1, 0),
+      hash(content_hash(band)) {
+  Size ncoef = 0;
+  for (auto& line : band) {
+    for (auto& [s, m] : line.ls.single_models) {
+      for (auto& [v, d] : m.data) ncoef += d.X().size();
+    }
+  }
+  coefficients.resize(ncoef);
+
+  ncoef = 0;
+  for (Size i = 0; i < band.size(); i++) {
+    const line& line = band.lines[i];
+
+    f0[i]       = line.f0;
+    f0_cubed[i] = Math::pow3(line.f0);
+    strength[i] = line.a * line.gu;
+    e0[i]       = line.e0;
+    T0[i]       = line.ls.T0;
+    zeeman[i]   = line.z.on;
+
+    for (auto& [s, m] : line.ls.single_models) {
+      species.push_back(s);
+
+      auto& refs = models.emplace_back();
+      for (Size iv = 0; iv < nvariables; iv++) {
+        const auto ptr = m.data.find(variables[iv]);
+        if (ptr == m.data.end()) continue;
+
+        const Vector& x = ptr->second.X();
+        refs[iv]        = {.on     = true,
+                           .type   = ptr->second.Type(),
+                           .offset = ncoef,
+                           .size   = x.size()};
+        for (auto c : x) coefficients[ncoef++] = c;
+      }
+    }
+
+    species_first[i + 1] = species.size();
+  }
+}
+
+Numeric band_soa::X(variable v, Size i, const AtmPoint& atm) const {
+  const auto iv      = static_cast<Size>(v);
+  const Numeric T    = atm.temperature;
+  const Numeric P    = atm.pressure;
+  const Numeric PVAR = (v == variable::G or v == variable::DV) ? P * P : P;
+
+  Numeric vmr = 0.0;
+  Numeric res = 0.0;
+  Numeric bth = NAN;
+
+  for (Size k = species_first[i]; k < species_first[i + 1]; k++) {
+    const temperature_ref& m = models[k][iv];
+
+    const Numeric this_res =
+        m.on ? PVAR * temperature::compute(
+                          m.type,
+                          coefficients[Range(m.offset, m.size)],
+                          T0[i],
+                          T)
+             : 0.0;
+
+    if (species[k] != SpeciesEnum::Bath) {
+      const Numeric this_vmr  = atm[species[k]];
+      vmr                    += this_vmr;
+      res                    += this_vmr * this_res;
+    } else {
+      bth = this_res;
+    }
+  }
+
+  if (not nonstd::isnan(bth)) return res + (1.0 - vmr) * bth;
+
+  return res / vmr;
+}
+}  // namespace lbl
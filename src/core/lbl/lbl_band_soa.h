@@ -0,0 +1,111 @@
+#pragma once
+
+#include <atm.h>
+#include <enumsLineShapeModelType.h>
+#include <enumsSpeciesEnum.h>
+#include <matpack.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "lbl_data.h"
+
+namespace lbl {
+/*! A compiled, read-only structure-of-arrays copy of a band_data
+
+  The line parameters that are needed to set up the line shape at a new
+  atmospheric point are stored in contiguous arrays, and the temperature
+  models of the line shape parameters are flattened so that they are
+  evaluated without any map lookups.
+
+  The line shape parameters are evaluated with the same order of operations
+  as line_shape::model, so the results are bit-identical to those of the
+  band_data the snapshot was compiled from.  The snapshot is not updated if
+  the band_data changes, it must then be compiled again.  The hash member
+  is the content_hash of the band_data, so that a changed band is found.
+*/
+struct band_soa {
+  //! The line shape parameters that are needed by the LTE Voigt line shape
+  enum class variable : Size { G0, D0, DV, G, Y };
+
+  static constexpr Size nvariables = 5;
+
+  //! A flattened temperature model of coefficients[offset, offset + size)
+  struct temperature_ref {
+    bool on{false};
+    LineShapeModelType type{LineShapeModelType::T0};
+    Size offset{0};
+    Size size{0};
+  };
+
+  //! Line center
+  Vector f0{};
+
+  //! The line center cubed
+  Vector f0_cubed{};
+
+  //! Einstein A coefficient times the upper level degeneracy
+  Vector strength{};
+
+  //! Lower level energy
+  Vector e0{};
+
+  //! Reference temperature of the line shape model
+  Vector T0{};
+
+  //! Whether or not the Zeeman effect is on for the line
+  std::vector<char> zeeman{};
+
+  //! Line i has the broadening species [species_first[i], species_first[i+1])
+  std::vector<Size> species_first{};
+
+  //! The broadening species, in the iteration order of the line shape model
+  std::vector<SpeciesEnum> species{};
+
+  //! The temperature models per broadening species and variable
+  std::vector<std::array<temperature_ref, nvariables>> models{};
+
+  //! All the temperature model coefficients
+  Vector coefficients{};
+
+  //! The content_hash of the band_data the snapshot was compiled from
+  std::size_t hash{0};
+
+  band_soa() = default;
+
+  explicit band_soa(const band_data& band);
+
+  [[nodiscard]] Size size() const { return f0.size(); }
+
+  //! Line strength, as line::s
+  [[nodiscard]] Numeric s(Size i, Numeric T, Numeric Q) const {
+    return strength[i] * std::exp(-e0[i] / (Constant::k * T)) /
+           (f0_cubed[i] * Q);
+  }
+
+  [[nodiscard]] Numeric G0(Size i, const AtmPoint& atm) const {
+    return X(variable::G0, i, atm);
+  }
+
+  [[nodiscard]] Numeric D0(Size i, const AtmPoint& atm) const {
+    return X(variable::D0, i, atm);
+  }
+
+  [[nodiscard]] Numeric DV(Size i, const AtmPoint& atm) const {
+    return X(variable::DV, i, atm);
+  }
+
+  [[nodiscard]] Numeric G(Size i, const AtmPoint& atm) const {
+    return X(variable::G, i, atm);
+  }
+
+  [[nodiscard]] Numeric Y(Size i, const AtmPoint& atm) const {
+    return X(variable::Y, i, atm);
+  }
+
+  //! The line shape variable v of line i, as line_shape::model
+  [[nodiscard]] Numeric X(variable v, Size i, const AtmPoint& atm) const;
+};
+}  // namespace lbl
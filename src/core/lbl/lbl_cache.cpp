@@ -0,0 +1,240 @@
+#include "lbl_cache.h"
+
+#include "lbl_hash.h"
+
+#include <boost/container_hash/hash.hpp>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace lbl {
+namespace {
+using quantized = std::int64_t;
+
+//! Quantize x to steps of tol, exact if tol is not positive
+quantized absolute(Numeric x, Numeric tol) {
+  if (tol <= 0.0) return std::bit_cast<quantized>(x);
+  return std::llround(x / tol);
+}
+
+//! Quantize log|x| to steps of tol keeping the sign, exact if tol <= 0
+quantized relative(Numeric x, Numeric tol) {
+  if (tol <= 0.0) return std::bit_cast<quantized>(x);
+  if (x == 0.0) return std::numeric_limits<quantized>::min();
+
+  const quantized q = std::llround(std::log(std::abs(x)) / tol);
+  return x < 0.0 ? 2 * q + 1 : 2 * q;
+}
+
+//! Sorted, quantized content of one of the maps of an AtmPoint
+template <typename T>
+void append_map(std::vector<quantized>& values,
+                const Atm::PointValues<T>& map,
+                Numeric tol) {
+  std::vector<std::pair<quantized, quantized>> sorted;
+  sorted.reserve(map.size());
+  for (const auto& [k, v] : map) {
+    sorted.emplace_back(static_cast<quantized>(std::hash<T>{}(k)),
+                        relative(v, tol));
+  }
+  stdr::sort(sorted);
+
+  values.push_back(static_cast<quantized>(sorted.size()));
+  for (auto& [k, v] : sorted) {
+    values.push_back(k);
+    values.push_back(v);
+  }
+}
+
+struct key_hash {
+  std::size_t operator()(const cache::key& k) const { return k.hash; }
+};
+
+struct entry {
+  cache::key k;
+  Vector f_grid;
+  PropmatVector pm;
+  StokvecVector sv;
+};
+}  // namespace
+
+struct cache::state {
+  settings config;
+
+  std::mutex mtx;
+  Size hits{0};
+  Size misses{0};
+
+  //! Most recently used first
+  std::list<entry> entries;
+  std::unordered_map<key, std::list<entry>::iterator, key_hash> index;
+};
+
+cache::cache() : cache(settings{}) {}
+
+cache::cache(const settings& config) : data(std::make_shared<state>()) {
+  data->config = config;
+}
+
+bool cache::active() const { return data->config.max_entries > 0; }
+
+const cache::settings& cache::config() const { return data->config; }
+
+Size cache::hits() const {
+  std::lock_guard lock(data->mtx);
+  return data->hits;
+}
+
+Size cache::misses() const {
+  std::lock_guard lock(data->mtx);
+  return data->misses;
+}
+
+Size cache::size() const {
+  std::lock_guard lock(data->mtx);
+  return data->entries.size();
+}
+
+void cache::clear() const {
+  std::lock_guard lock(data->mtx);
+  data->hits   = 0;
+  data->misses = 0;
+  data->index.clear();
+  data->entries.clear();
+}
+
+cache::key cache::make_key(const ConstVectorView f_grid,
+                           const SpeciesEnum species,
+                           const std::size_t bands_hash,
+                           const LinemixingEcsData& abs_ecs_data,
+                           const AtmPoint& atm,
+                           const Vector2 los,
+                           const bool no_negative_absorption) const {
+  if (not active()) return {};
+
+  const settings& config = data->config;
+
+  std::size_t f_hash = 0;
+  for (auto f : f_grid) {
+    boost::hash_combine(f_hash, std::bit_cast<std::uint64_t>(f));
+  }
+
+  key k;
+  k.values = {static_cast<quantized>(species),
+              static_cast<quantized>(no_negative_absorption),
+              static_cast<quantized>(bands_hash),
+              static_cast<quantized>(content_hash(abs_ecs_data)),
+              static_cast<quantized>(f_grid.size()),
+              static_cast<quantized>(f_hash),
+              relative(atm.pressure, config.pressure_tolerance),
+              absolute(atm.temperature, config.temperature_tolerance),
+              absolute(atm.mag[0], config.magnetic_tolerance),
+              absolute(atm.mag[1], config.magnetic_tolerance),
+              absolute(atm.mag[2], config.magnetic_tolerance),
+              absolute(los[0], config.los_tolerance),
+              absolute(los[1], config.los_tolerance)};
+
+  append_map(k.values, atm.specs, config.vmr_tolerance);
+  append_map(k.values, atm.isots, config.vmr_tolerance);
+  append_map(k.values, atm.nlte, config.vmr_tolerance);
+
+  k.hash = boost::hash_range(k.values.begin(), k.values.end());
+  return k;
+}
+
+bool cache::add_cached(PropmatVectorView pm,
+                       StokvecVectorView sv,
+                       const key& k,
+                       const ConstVectorView f_grid) const {
+  if (not active()) return false;
+
+  std::lock_guard lock(data->mtx);
+
+  const auto ptr = data->index.find(k);
+  if (ptr == data->index.end() or
+      not stdr::equal(ptr->second->f_grid, f_grid)) {
+    data->misses++;
+    return false;
+  }
+
+  data->hits++;
+  data->entries.splice(data->entries.begin(), data->entries, ptr->second);
+
+  const entry& e = *ptr->second;
+  for (Size i = 0; i < e.pm.size(); i++) pm[i] += e.pm[i];
+  for (Size i = 0; i < e.sv.size(); i++) sv[i] += e.sv[i];
+  return true;
+}
+
+void cache::store(const PropmatConstVectorView pm,
+                  const StokvecConstVectorView sv,
+                  const key& k,
+                  const ConstVectorView f_grid) const {
+  if (not active()) return;
+
+  std::lock_guard lock(data->mtx);
+
+  // Another thread may have stored the same state meanwhile
+  if (const auto ptr = data->index.find(k); ptr != data->index.end()) {
+    data->entries.erase(ptr->second);
+    data->index.erase(ptr);
+  }
+
+  data->entries.emplace_front(
+      k, Vector{f_grid}, PropmatVector{pm}, StokvecVector{sv});
+  data->index.emplace(k, data->entries.begin());
+
+  while (data->entries.size() > data->config.max_entries) {
+    data->index.erase(data->entries.back().k);
+    data->entries.pop_back();
+  }
+}
+}  // namespace lbl
+
+void xml_io_stream<LineByLineCache>::write(std::ostream& os,
+                                           const LineByLineCache& x,
+                                           bofstream* pbofs,
+                                           std::string_view name) {
+  XMLTag tag(type_name, "name", name);
+  tag.write_to_stream(os);
+
+  const auto& c = x.config();
+  xml_write_to_stream(os, static_cast<Index>(c.max_entries), pbofs);
+  xml_write_to_stream(os, c.pressure_tolerance, pbofs);
+  xml_write_to_stream(os, c.temperature_tolerance, pbofs);
+  xml_write_to_stream(os, c.vmr_tolerance, pbofs);
+  xml_write_to_stream(os, c.magnetic_tolerance, pbofs);
+  xml_write_to_stream(os, c.los_tolerance, pbofs);
+
+  tag.write_to_end_stream(os);
+}
+
+void xml_io_stream<LineByLineCache>::read(std::istream& is,
+                                          LineByLineCache& x,
+                                          bifstream* pbifs) try {
+  XMLTag tag;
+  tag.read_from_stream(is);
+  tag.check_name(type_name);
+
+  Index max_entries;
+  LineByLineCache::settings c;
+  xml_read_from_stream(is, max_entries, pbifs);
+  xml_read_from_stream(is, c.pressure_tolerance, pbifs);
+  xml_read_from_stream(is, c.temperature_tolerance, pbifs);
+  xml_read_from_stream(is, c.vmr_tolerance, pbifs);
+  xml_read_from_stream(is, c.magnetic_tolerance, pbifs);
+  xml_read_from_stream(is, c.los_tolerance, pbifs);
+  c.max_entries = static_cast<Size>(std::max<Index>(max_entries, 0));
+  x             = LineByLineCache{c};
+
+  tag.read_from_stream(is);
+  tag.check_end_name(type_name);
+} catch (const std::exception& e) {
+  throw std::runtime_error(
+      std::format("Error reading {}:\n{}", type_name, e.what()));
+}
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <atm.h>
+#include <matpack.h>
+#include <rtepack.h>
+#include <xml.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "lbl_data.h"
+#include "lbl_lineshape_linemixing.h"
+
+namespace lbl {
+/*! A bounded cache of line-by-line absorption
+
+  Results of lbl::calculate are stored keyed on the atmospheric state,
+  the line-of-sight, and the frequency grid.  The state is quantized by the
+  tolerances of the cache, so that states that differ by less than the
+  tolerances share a result.  A zero tolerance means that the values must
+  be identical.  The frequency grid must always be identical.
+
+  The least recently used result is dropped once max_entries results are
+  held.  A cache with max_entries zero is inactive and never stores anything.
+
+  The bands and the line mixing data are identified by a hash of their
+  content, so modifying them in place does not give stale results.  The
+  key of a call is made once by make_key() and used for both the lookup
+  and the store.
+
+  Copies share the same storage, so that a cache given to an agenda is
+  the same cache everywhere.  All access is thread-safe.
+*/
+class cache {
+ public:
+  struct settings {
+    //! The maximum number of results to keep, 0 for an inactive cache
+    Size max_entries{0};
+
+    //! Relative pressure tolerance [-]
+    Numeric pressure_tolerance{0.0};
+
+    //! Absolute temperature tolerance [K]
+    Numeric temperature_tolerance{0.0};
+
+    //! Relative tolerance of VMRs, isotopologue ratios, and NLTE values [-]
+    Numeric vmr_tolerance{0.0};
+
+    //! Absolute magnetic field tolerance [T]
+    Numeric magnetic_tolerance{0.0};
+
+    //! Absolute line-of-sight tolerance [deg]
+    Numeric los_tolerance{0.0};
+  };
+
+ private:
+  struct state;
+  std::shared_ptr<state> data;
+
+ public:
+  cache();
+  explicit cache(const settings& config);
+
+  //! Whether or not anything is ever stored
+  [[nodiscard]] bool active() const;
+
+  [[nodiscard]] const settings& config() const;
+
+  //! The number of results found in the cache
+  [[nodiscard]] Size hits() const;
+
+  //! The number of results not found in the cache
+  [[nodiscard]] Size misses() const;
+
+  //! The number of results currently held
+  [[nodiscard]] Size size() const;
+
+  //! Drop all results and reset the counters
+  void clear() const;
+
+  //! The identity of a result in the cache, see make_key()
+  struct key {
+    std::vector<std::int64_t> values;
+    std::size_t hash{0};
+
+    bool operator==(const key& other) const { return values == other.values; }
+  };
+
+  /** The key of a state, computed once per call of lbl::calculate
+
+    The arguments are as for lbl::calculate over the full frequency grid
+    and without Jacobian targets, except that the bands are given by
+    their content hash.  The caller computes the hash once and shares it
+    with the frequency index of the bands.
+
+    @param bands_hash content_hash(bnds, species)
+    @return The key of the state, quantized by the tolerances
+  */
+  [[nodiscard]] key make_key(const ConstVectorView f_grid,
+                             const SpeciesEnum species,
+                             const std::size_t bands_hash,
+                             const LinemixingEcsData& abs_ecs_data,
+                             const AtmPoint& atm,
+                             const Vector2 los,
+                             const bool no_negative_absorption) const;
+
+  /** Add a cached result if there is one
+
+    @param k The key from make_key()
+    @param f_grid The frequency grid the key was made from
+    @return true If a result was found and added to pm and sv
+  */
+  bool add_cached(PropmatVectorView pm,
+                  StokvecVectorView sv,
+                  const key& k,
+                  const ConstVectorView f_grid) const;
+
+  /** Store a result computed by lbl::calculate
+
+    The arguments are as for add_cached(), with pm and sv being only the
+    contribution of the lines, not anything they were added to.
+  */
+  void store(const PropmatConstVectorView pm,
+             const StokvecConstVectorView sv,
+             const key& k,
+             const ConstVectorView f_grid) const;
+};
+}  // namespace lbl
+
+using LineByLineCache = lbl::cache;
+
+template <>
+struct std::formatter<LineByLineCache> {
+  format_tags tags;
+
+  [[nodiscard]] constexpr auto& inner_fmt() { return *this; }
+  [[nodiscard]] constexpr auto& inner_fmt() const { return *this; }
+
+  constexpr std::format_parse_context::iterator parse(
+      std::format_parse_context& ctx) {
+    return parse_format_tags(tags, ctx);
+  }
+
+  template <class FmtContext>
+  FmtContext::iterator format(const LineByLineCache& v, FmtContext& ctx) const {
+    const auto& c = v.config();
+    return tags.format(ctx,
+                       "max_entries: "sv,
+                       c.max_entries,
+                       "\nsize: "sv,
+                       v.size(),
+                       "\nhits: "sv,
+                       v.hits(),
+                       "\nmisses: "sv,
+                       v.misses(),
+                       "\ntolerances (p, T, VMR, mag, los): "sv,
+                       c.pressure_tolerance,
+                       ", "sv,
+                       c.temperature_tolerance,
+                       ", "sv,
+                       c.vmr_tolerance,
+                       ", "sv,
+                       c.magnetic_tolerance,
+                       ", "sv,
+                       c.los_tolerance);
+  }
+};
+
+template <>
+struct xml_io_stream<LineByLineCache> {
+  static constexpr std::string_view type_name = "LineByLineCache"sv;
+
+  static void write(std::ostream& os,
+                    const LineByLineCache& x,
+                    bofstream* pbofs      = nullptr,
+                    std::string_view name = ""sv);
+
+  static void read(std::istream& is,
+                   LineByLineCache& x,
+                   bifstream* pbifs = nullptr);
+};
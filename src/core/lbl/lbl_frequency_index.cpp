@@ -0,0 +1,166 @@
+#include "lbl_frequency_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <list>
+#include <mutex>
+
+namespace lbl {
+namespace {
+//! Whether or not the band is only computed for lines close to the frequency
+bool is_bounded(const band_data& band) {
+  if (band.cutoff.type != LineByLineCutoffType::ByLine) return false;
+  if (band.lines.empty()) return false;
+
+  switch (band.lineshape) {
+    using enum LineByLineLineshape;
+    case VP_LTE:        return true;
+    case VP_LTE_MIRROR: return true;
+    case VP_LINE_NLTE:  return true;
+    default:            return false;
+  }
+}
+
+struct kept_index {
+  const AbsorptionBands* bands;
+  SpeciesEnum species;
+  std::size_t hash;
+  std::shared_ptr<const frequency_index> index;
+};
+
+//! The indexes kept by frequency_index::shared, most recently used first
+struct kept_indexes {
+  static constexpr Size max_size = 16;
+
+  std::mutex mtx;
+  std::list<kept_index> list;
+};
+
+kept_indexes& kept() {
+  static kept_indexes x;
+  return x;
+}
+}  // namespace
+
+frequency_index::frequency_index(const AbsorptionBands& bnds,
+                                 SpeciesEnum species) {
+  bands.reserve(bnds.size());
+  snapshots.resize(bnds.size());
+
+  for (auto& v : bnds) {
+    const Size pos = bands.size();
+    bands.push_back(&v);
+
+    const band_data& band = v.second;
+    if (band.lineshape == LineByLineLineshape::VP_LTE and
+        (species == SpeciesEnum::Bath or species == v.first.isot.spec)) {
+      snapshots[pos].emplace(band);
+    }
+
+    if (not is_bounded(band)) {
+      unbounded.push_back(pos);
+      continue;
+    }
+
+    const auto f0s              = band.lines | stdv::transform(&line::f0);
+    const auto [f0_min, f0_max] = stdr::minmax(f0s);
+    const Numeric c             = band.get_cutoff_frequency();
+
+    // Widened by an ulp, the exact test is the one of band_data::active_lines
+    constexpr Numeric inf = std::numeric_limits<Numeric>::infinity();
+    ranges.push_back({.lo     = std::nextafter(f0_min - c, -inf),
+                      .hi     = std::nextafter(f0_max + c, inf),
+                      .f0_min = f0_min,
+                      .f0_max = f0_max,
+                      .cutoff = c,
+                      .pos    = pos});
+  }
+
+  stdr::sort(ranges, {}, &range::lo);
+
+  max_hi.resize(ranges.size());
+  build(0, ranges.size());
+}
+
+std::shared_ptr<const frequency_index> frequency_index::shared(
+    const AbsorptionBands& bnds, SpeciesEnum species, std::size_t hash) {
+  const auto same_bands = [&bnds](const frequency_index& x) {
+    return x.bands.size() == bnds.size() and
+           stdr::equal(x.bands, bnds, {}, {}, [](auto& v) { return &v; });
+  };
+
+  kept_indexes& k = kept();
+
+  std::shared_ptr<const frequency_index> out;
+  {
+    std::lock_guard lock(k.mtx);
+    const auto ptr = stdr::find_if(k.list, [&](const kept_index& x) {
+      return x.bands == &bnds and x.species == species and x.hash == hash;
+    });
+
+    if (ptr != k.list.end()) {
+      k.list.splice(k.list.begin(), k.list, ptr);
+      out = ptr->index;
+    }
+  }
+
+  if (out and same_bands(*out)) return out;
+
+  out = std::make_shared<const frequency_index>(bnds, species);
+
+  std::lock_guard lock(k.mtx);
+  std::erase_if(k.list, [&](const kept_index& x) {
+    return x.bands == &bnds and x.species == species;
+  });
+  k.list.push_front({&bnds, species, hash, out});
+  if (k.list.size() > kept_indexes::max_size) k.list.pop_back();
+  return out;
+}
+
+Numeric frequency_index::build(Size first, Size last) {
+  if (first >= last) return std::numeric_limits<Numeric>::lowest();
+
+  const Size mid = first + (last - first) / 2;
+  max_hi[mid]    = std::max(
+      {ranges[mid].hi, build(first, mid), build(mid + 1, last)});
+  return max_hi[mid];
+}
+
+void frequency_index::find(std::vector<Size>& out,
+                           Size first,
+                           Size last,
+                           Numeric fmin,
+                           Numeric fmax) const {
+  if (first >= last) return;
+
+  const Size mid = first + (last - first) / 2;
+  if (max_hi[mid] < fmin) return;
+
+  find(out, first, mid, fmin, fmax);
+
+  const range& r = ranges[mid];
+  if (r.lo > fmax) return;
+
+  if (r.f0_max >= fmin - r.cutoff and r.f0_min <= fmax + r.cutoff) {
+    out.push_back(r.pos);
+  }
+
+  find(out, mid + 1, last, fmin, fmax);
+}
+
+std::vector<frequency_index::selected> frequency_index::select(
+    Numeric fmin, Numeric fmax) const {
+  std::vector<Size> pos = unbounded;
+  find(pos, 0, ranges.size(), fmin, fmax);
+  stdr::sort(pos);
+
+  std::vector<selected> out;
+  out.reserve(pos.size());
+  for (auto i : pos) {
+    const auto& soa = snapshots[i];
+    out.push_back({bands[i], soa ? &*soa : nullptr});
+  }
+  return out;
+}
+}  // namespace lbl
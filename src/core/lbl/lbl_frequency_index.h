@@ -0,0 +1,120 @@
+#pragma once
+
+#include <matpack.h>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "lbl_band_soa.h"
+#include "lbl_data.h"
+
+namespace lbl {
+/*! An index of the frequency ranges in which the bands contribute
+
+  Bands whose lines are cut off (LineByLineCutoffType::ByLine) only
+  contribute between their lowest line center minus the cutoff and their
+  highest line center plus the cutoff.  These ranges are kept in an implicit
+  interval tree, sorted by their lower limit, so that the bands contributing
+  to a frequency window are found in O(log n + k) time.  All other bands are
+  always selected.
+
+  The VP_LTE bands of the species of the index are also compiled into
+  snapshots, see band_soa, so that their line parameters are read from
+  contiguous arrays.
+
+  The index holds pointers into the bands it was built from, so it must not
+  outlive them and must be rebuilt if they are modified.  Use shared() to
+  keep the index between calculations on the same bands.
+*/
+class frequency_index {
+ public:
+  using band_ptr = const AbsorptionBands::value_type*;
+
+  //! A selected band and its snapshot, nullptr if it has none
+  struct selected {
+    band_ptr band;
+    const band_soa* snapshot;
+  };
+
+ private:
+  struct range {
+    Numeric lo;
+    Numeric hi;
+
+    //! The range is [f0_min - cutoff, f0_max + cutoff]
+    Numeric f0_min;
+    Numeric f0_max;
+    Numeric cutoff;
+
+    //! The position of the band in the iteration order of the bands
+    Size pos;
+  };
+
+  //! All bands, in iteration order
+  std::vector<band_ptr> bands{};
+
+  //! Sorted by lo, the implicit tree has its node at the middle of a range
+  std::vector<range> ranges{};
+
+  //! The largest hi of the subtree that has its node at the same index
+  std::vector<Numeric> max_hi{};
+
+  //! The positions of the bands that are always selected
+  std::vector<Size> unbounded{};
+
+  //! Snapshots of the bands, in iteration order, if compiled
+  std::vector<std::optional<band_soa>> snapshots{};
+
+  Numeric build(Size first, Size last);
+
+  void find(std::vector<Size>& out,
+            Size first,
+            Size last,
+            Numeric fmin,
+            Numeric fmax) const;
+
+ public:
+  frequency_index() = default;
+
+  /** Index the bands
+
+    @param[in] bands The bands
+    @param[in] species The species whose bands are compiled, Bath for all
+  */
+  explicit frequency_index(const AbsorptionBands& bands,
+                           SpeciesEnum species = SpeciesEnum::Bath);
+
+  /** The index of the bands, built once per content of the bands
+
+    Indexes are kept between calls, keyed on the address of the bands, the
+    species, and the content hash of the bands of the species.  A kept index
+    is only returned if its band pointers are still those of the bands, so
+    bands that are modified or reassigned get a new index.
+
+    @param[in] bands The bands
+    @param[in] species The species of the calculation, Bath for all
+    @param[in] hash The content_hash(bands, species)
+    @return The index
+  */
+  [[nodiscard]] static std::shared_ptr<const frequency_index> shared(
+      const AbsorptionBands& bands, SpeciesEnum species, std::size_t hash);
+
+  //! The number of bands in the index
+  [[nodiscard]] Size size() const { return bands.size(); }
+
+  /** The bands that may contribute between fmin and fmax
+
+    A band that is not selected would contribute nothing to the frequencies
+    in [fmin, fmax].  The selected bands are in the iteration order of the
+    bands the index was built from.
+
+    @param[in] fmin The lowest frequency
+    @param[in] fmax The highest frequency
+    @return The selected bands
+  */
+  [[nodiscard]] std::vector<selected> select(Numeric fmin,
+                                             Numeric fmax) const;
+};
+}  // namespace lbl
@@ -7,6 +7,7 @@
 #include <limits>
 
 #include "lbl_data.h"
+#include "lbl_hash.h"
 #include "lbl_lineshape_voigt_lte.h"
 
 namespace lbl::fwd {
@@ -35,6 +36,21 @@ line_storage& line_storage::operator=(const line_storage&)     = default;
 line_storage& line_storage::operator=(line_storage&&) noexcept = default;
 
 namespace models {
+void lte::compile() {
+  snapshots.resize(0);
+
+  if (not bands) return;
+
+  snapshots.reserve(bands->size());
+  for (auto& [qid, band] : *bands) {
+    if (band.lineshape == LineByLineLineshape::VP_LTE) {
+      snapshots.emplace_back(band);
+    } else {
+      snapshots.emplace_back();
+    }
+  }
+}
+
 void lte::adapt() try {
   lines.lines.resize(0);
   cutoff_lines.lines.resize(0);
@@ -50,17 +66,23 @@ void lte::adapt() try {
 
   ARTS_USER_ERROR_IF(not atm, "Must have an atmosphere")
 
+  if (snapshots.size() != bands->size()) compile();
+
   std::vector<voigt::lte::single_shape> shapes;
   std::vector<line_pos> shapes_pos;
   decltype(cutoff) cutoff_this;
 
+  Size iband = 0;
   for (auto& [qid, band] : *bands) {
+    band_soa& soa = snapshots[iband++];
     if (band.lineshape != LineByLineLineshape::VP_LTE) continue;
+    if (soa.hash != content_hash(band)) soa = band_soa{band};
 
     band_shape_helper(shapes,
                       shapes_pos,
                       qid.isot,
                       band,
+                      soa,
                       *atm,
                       std::numeric_limits<Numeric>::lowest(),
                       std::numeric_limits<Numeric>::max(),
@@ -246,6 +268,7 @@ std::pair<Complex, Complex> nlte::operator()(const Numeric frequency) const {
 
 void lte::set_model(std::shared_ptr<AbsorptionBands> bands_) {
   bands = std::move(bands_);
+  compile();
   adapt();
 }
 
@@ -295,6 +318,7 @@ void lte::set(std::shared_ptr<AbsorptionBands> bands_,
   bands = std::move(bands_);
   atm   = std::move(atm_);
   pol   = pol_;
+  compile();
   adapt();
 }
 
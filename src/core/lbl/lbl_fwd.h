@@ -4,6 +4,7 @@
 
 #include <memory>
 
+#include "lbl_band_soa.h"
 #include "lbl_data.h"
 #include "lbl_lineshape_voigt_lte.h"
 #include "lbl_lineshape_voigt_lte_mirrored.h"
@@ -16,11 +17,15 @@ class lte {
   std::shared_ptr<AbsorptionBands> bands{};
   ZeemanPolarization pol{};
 
+  //! Compiled copies of the bands, in the iteration order of bands
+  std::vector<band_soa> snapshots{};
+
   voigt::lte::band_shape lines{};
 
   voigt::lte::band_shape cutoff_lines{};
   ComplexVector cutoff;
 
+  void compile();
   void adapt();
 
  public:
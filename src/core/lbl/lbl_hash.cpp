@@ -0,0 +1,97 @@
+#include "lbl_hash.h"
+
+#include <boost/container_hash/hash.hpp>
+#include <bit>
+#include <cstdint>
+
+namespace lbl {
+namespace {
+void combine(std::size_t& seed, const Numeric x) {
+  boost::hash_combine(seed, std::bit_cast<std::uint64_t>(x));
+}
+
+//! The hash of a map that does not depend on its iteration order
+template <typename Map, typename ValueHash>
+std::size_t unordered_hash(const Map& map, const ValueHash& value_hash) {
+  using key_t = typename Map::key_type;
+
+  std::size_t sum = map.size();
+  for (auto& [k, v] : map) {
+    std::size_t seed = std::hash<key_t>{}(k);
+    boost::hash_combine(seed, value_hash(v));
+    sum += seed;
+  }
+  return sum;
+}
+
+std::size_t hash(const temperature::data& x) {
+  std::size_t seed = std::hash<LineShapeModelType>{}(x.Type());
+  for (auto v : x.X()) combine(seed, v);
+  return seed;
+}
+
+std::size_t hash(const line_shape::species_model& x) {
+  return unordered_hash(x.data, [](auto& v) { return hash(v); });
+}
+
+std::size_t hash(const line_shape::model& x) {
+  std::size_t seed = 0;
+  combine(seed, x.T0);
+  boost::hash_combine(
+      seed, unordered_hash(x.single_models, [](auto& v) { return hash(v); }));
+  return seed;
+}
+
+std::size_t hash(const line& x) {
+  std::size_t seed = 0;
+  combine(seed, x.a);
+  combine(seed, x.f0);
+  combine(seed, x.e0);
+  combine(seed, x.gu);
+  combine(seed, x.gl);
+  combine(seed, x.z.mdata.gu);
+  combine(seed, x.z.mdata.gl);
+  boost::hash_combine(seed, x.z.on);
+  boost::hash_combine(seed, hash(x.ls));
+  boost::hash_combine(seed, std::hash<QuantumState>{}(x.qn));
+  return seed;
+}
+
+std::size_t hash(const band_data& x) {
+  std::size_t seed = std::hash<LineByLineLineshape>{}(x.lineshape);
+  boost::hash_combine(seed, std::hash<LineByLineCutoffType>{}(x.cutoff.type));
+  combine(seed, x.cutoff.value);
+  for (auto& l : x.lines) boost::hash_combine(seed, hash(l));
+  return seed;
+}
+
+std::size_t hash(const linemixing::species_data& x) {
+  std::size_t seed = hash(x.scaling);
+  boost::hash_combine(seed, hash(x.beta));
+  boost::hash_combine(seed, hash(x.lambda));
+  boost::hash_combine(seed, hash(x.collisional_distance));
+  return seed;
+}
+}  // namespace
+
+std::size_t content_hash(const AbsorptionBands& bands,
+                         const SpeciesEnum species) {
+  std::size_t sum = 0;
+  for (auto& [k, v] : bands) {
+    if (species != SpeciesEnum::Bath and species != k.isot.spec) continue;
+
+    std::size_t seed = std::hash<QuantumIdentifier>{}(k);
+    boost::hash_combine(seed, hash(v));
+    sum += seed;
+  }
+  return sum;
+}
+
+std::size_t content_hash(const band_data& band) { return hash(band); }
+
+std::size_t content_hash(const LinemixingEcsData& ecs_data) {
+  return unordered_hash(ecs_data, [](auto& v) {
+    return unordered_hash(v, [](auto& x) { return hash(x); });
+  });
+}
+}  // namespace lbl
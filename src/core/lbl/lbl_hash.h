@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+
+#include "lbl_data.h"
+#include "lbl_lineshape_linemixing.h"
+
+namespace lbl {
+/** A hash of the content of the bands
+
+  Every value of the bands goes into the hash, so any change to a line,
+  its line shape model, or its quantum numbers changes the hash.  The order
+  of the bands and of the line shape models does not matter.
+
+  @param bands The bands
+  @param species Only the bands of this species count, all for Bath
+  @return The hash
+*/
+[[nodiscard]] std::size_t content_hash(
+    const AbsorptionBands& bands, const SpeciesEnum species = SpeciesEnum::Bath);
+
+/** A hash of the content of a single band, as for the bands
+
+  @param band The band
+  @return The hash
+*/
+[[nodiscard]] std::size_t content_hash(const band_data& band);
+
+/** A hash of the content of the line mixing data, as for the bands
+
+  @param ecs_data The line mixing data
+  @return The hash
+*/
+[[nodiscard]] std::size_t content_hash(const LinemixingEcsData& ecs_data);
+}  // namespace lbl
@@ -1,20 +1,28 @@
 #include "lbl_hitran.h"
 
 #include <arts_conversions.h>
+#include <arts_omp.h>
 #include <fast_float/fast_float.h>
 #include <hitran_species.h>
+#include <isotopologues.h>
 #include <partfun.h>
 #include <quantum.h>
 
+#include <algorithm>
+#include <array>
 #include <charconv>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <string_view>
 
 namespace lbl {
 namespace {
 struct reader {
-  std::string::const_iterator it;
-  std::string::const_iterator end;
+  std::string_view::const_iterator it;
+  std::string_view::const_iterator end;
 
-  reader(const std::string& s) : it(s.begin()), end(s.end()) {}
+  reader(std::string_view s) : it(s.begin()), end(s.end()) {}
 
   template <typename T>
   constexpr T read_next(Size n) {
@@ -92,7 +100,7 @@ bool read_par_line(hitran_record& record, reader& data, const Numeric fmin) {
 bool read_hitran_par_record(
     hitran_record& record,
     const std::vector<HitranFileFormatType>& format_order,
-    const std::string& linedata,
+    const std::string_view linedata,
     const Numeric fmin) try {
   using namespace Conversion;
 
@@ -141,30 +149,155 @@ bool read_hitran_par_record(
       e.what(),
       linedata);
 }
+
+//! The records parsed from a part of a file
+struct parsed_chunk {
+  hitran_data data;
+
+  //! A record above the frequency range was found
+  bool stopped{false};
+
+  std::string error;
+};
+
+bool is_selected(const hitran_record& record,
+                 const ArrayOfSpeciesEnum& species) {
+  return species.empty() or stdr::contains(species, record.qid.isot.spec);
+}
+
+//! Parse all full lines of text until the first record above the range
+void parse_chunk(parsed_chunk& out,
+                 std::string_view text,
+                 const std::vector<HitranFileFormatType>& format_order,
+                 const Vector2& frequency_range,
+                 const ArrayOfSpeciesEnum& species) try {
+  while (not text.empty()) {
+    const Size n                = text.find('\n');
+    const std::string_view line = text.substr(0, n);
+    text.remove_prefix(n == text.npos ? text.size() : n + 1);
+
+    hitran_record record;
+    if (not read_hitran_par_record(
+            record, format_order, line, frequency_range[0])) {
+      continue;
+    }
+
+    if (record.f0 > frequency_range[1]) {
+      out.stopped = true;
+      return;
+    }
+
+    if (is_selected(record, species)) out.data.push_back(std::move(record));
+  }
+} catch (std::exception& e) {
+  out.error = e.what();
+}
+
+//! Split text into about n parts at line breaks
+std::vector<std::string_view> split_lines(std::string_view text, Size n) {
+  std::vector<std::string_view> parts;
+  parts.reserve(n);
+
+  const Size size = std::max<Size>(text.size() / n, 1);
+  while (not text.empty()) {
+    Size end = text.find('\n', std::min(size, text.size()) - 1);
+    end      = end == text.npos ? text.size() : end + 1;
+    parts.push_back(text.substr(0, end));
+    text.remove_prefix(end);
+  }
+
+  return parts;
+}
+
+//! The number of bytes read from the file at a time
+constexpr Size block_size = Size{1} << 26;
+
+constexpr std::array<char, 16> cache_magic{"ARTSHITRANCACHE"};
+
+constexpr std::uint64_t cache_version = 1;
+
+template <typename T>
+void write_column(std::ostream& os, std::span<const T> x) {
+  os.write(reinterpret_cast<const char*>(x.data()),
+           static_cast<std::streamsize>(x.size_bytes()));
+}
+
+template <typename T>
+void read_column(std::istream& is, std::span<T> x) {
+  is.read(reinterpret_cast<char*>(x.data()),
+          static_cast<std::streamsize>(x.size_bytes()));
+  ARTS_USER_ERROR_IF(not is, "Unexpected end of the HITRAN cache")
+}
+
+//! The 64-bit FNV-1a hash
+struct fnv1a {
+  static constexpr std::uint64_t prime = 0x100000001b3;
+
+  std::uint64_t value{0xcbf29ce484222325};
+
+  void add(std::string_view bytes) {
+    for (char c : bytes) {
+      value ^= static_cast<unsigned char>(c);
+      value *= prime;
+    }
+  }
+};
+
+//! The numeric members of hitran_record, in the order of the cache columns
+constexpr std::array numeric_columns{&hitran_record::f0,
+                                     &hitran_record::S,
+                                     &hitran_record::A,
+                                     &hitran_record::gamma_air,
+                                     &hitran_record::gamma_self,
+                                     &hitran_record::E,
+                                     &hitran_record::n,
+                                     &hitran_record::delta,
+                                     &hitran_record::g_upp,
+                                     &hitran_record::g_low};
 }  // namespace
 
 hitran_data read_hitran_par(
     std::istream& file,
     const std::vector<HitranFileFormatType>& format_order,
-    const Vector2& frequency_range) {
+    const Vector2& frequency_range,
+    const ArrayOfSpeciesEnum& species) {
   hitran_data out;
 
-  std::string linedata;
-  bool last_ok = true;
+  const Size nthreads = arts_omp_get_max_threads();
 
-  while (std::getline(file, linedata)) {
-    last_ok = read_hitran_par_record(last_ok ? out.emplace_back() : out.back(),
-                                     format_order,
-                                     linedata,
-                                     frequency_range[0]);
+  std::string block;
+  std::vector<parsed_chunk> chunks;
+  while (file) {
+    // Read a block, keeping any partial line from the previous block
+    const Size carry = block.size();
+    block.resize(carry + block_size);
+    file.read(block.data() + carry, static_cast<std::streamsize>(block_size));
+    block.resize(carry + static_cast<Size>(file.gcount()));
 
-    if (last_ok and out.back().f0 > frequency_range[1]) {
-      out.pop_back();
-      break;
+    const Size end = file ? block.rfind('\n') : block.size() - 1;
+    if (end == block.npos) continue;
+
+    const std::string_view text{block.data(), end + 1};
+    const auto parts = split_lines(text, 4 * nthreads);
+
+    chunks.resize(0);
+    chunks.resize(parts.size());
+
+#pragma omp parallel for if (not arts_omp_in_parallel())
+    for (Size i = 0; i < parts.size(); i++) {
+      parse_chunk(chunks[i], parts[i], format_order, frequency_range, species);
     }
-  }
 
-  if (not last_ok) out.pop_back();
+    for (auto& chunk : chunks) {
+      out.insert(out.end(),
+                 std::make_move_iterator(chunk.data.begin()),
+                 std::make_move_iterator(chunk.data.end()));
+      ARTS_USER_ERROR_IF(not chunk.error.empty(), "{}", chunk.error)
+      if (chunk.stopped) return out;
+    }
+
+    block.erase(0, end + 1);
+  }
 
   return out;
 }
@@ -172,8 +305,153 @@ hitran_data read_hitran_par(
 hitran_data read_hitran_par(
     std::istream&& file,
     const std::vector<HitranFileFormatType>& format_order,
-    const Vector2& frequency_range) {
-  return read_hitran_par(file, format_order, frequency_range);
+    const Vector2& frequency_range,
+    const ArrayOfSpeciesEnum& species) {
+  return read_hitran_par(file, format_order, frequency_range, species);
+}
+
+std::uint64_t hitran_content_hash(
+    std::istream& file, const std::vector<HitranFileFormatType>& format_order) {
+  fnv1a hash;
+
+  for (auto& fmt : format_order) hash.add(std::format("{},", fmt));
+
+  std::string block(block_size, '\0');
+  while (file) {
+    file.read(block.data(), static_cast<std::streamsize>(block.size()));
+    hash.add({block.data(), static_cast<Size>(file.gcount())});
+  }
+
+  return hash.value;
+}
+
+void write_hitran_cache(std::ostream& os,
+                        const hitran_data& data,
+                        const std::uint64_t content_hash) {
+  const Size n = data.size();
+
+  std::vector<Numeric> column(n);
+  std::vector<std::int64_t> isot(n);
+  std::vector<std::uint64_t> offset(n + 1, 0);
+  std::string qids;
+
+  for (Size i = 0; i < n; i++) {
+    isot[i] = Species::find_species_index(data[i].qid.isot);
+    std::format_to(std::back_inserter(qids), "{}", data[i].qid);
+    offset[i + 1] = qids.size();
+  }
+
+  write_column<char>(os, cache_magic);
+  write_column<std::uint64_t>(os, std::array{
+      cache_version,
+      static_cast<std::uint64_t>(Species::Isotopologues.size()),
+      content_hash,
+      static_cast<std::uint64_t>(n)});
+
+  for (auto ptr : numeric_columns) {
+    for (Size i = 0; i < n; i++) column[i] = data[i].*ptr;
+    write_column<Numeric>(os, column);
+  }
+  write_column<std::int64_t>(os, isot);
+  write_column<std::uint64_t>(os, offset);
+  write_column<char>(os, qids);
+
+  ARTS_USER_ERROR_IF(not os, "Failed to write the HITRAN cache")
+}
+
+std::optional<hitran_data> read_hitran_cache(
+    std::istream& is,
+    const std::uint64_t content_hash,
+    const Vector2& frequency_range,
+    const ArrayOfSpeciesEnum& species) {
+  std::array<char, cache_magic.size()> magic;
+  is.read(magic.data(), magic.size());
+  if (not is or magic != cache_magic) return std::nullopt;
+
+  std::array<std::uint64_t, 4> header;
+  read_column<std::uint64_t>(is, header);
+  if (header[0] != cache_version or
+      header[1] != Species::Isotopologues.size() or header[2] != content_hash) {
+    return std::nullopt;
+  }
+
+  const auto n             = static_cast<Size>(header[3]);
+  const std::streamoff pos = is.tellg();
+  const auto column_pos    = [pos, n](Size icol, Size i) {
+    return pos + static_cast<std::streamoff>((icol * n + i) * 8);
+  };
+  constexpr Size ncols = numeric_columns.size();
+
+  // Select by frequency as read_hitran_par does, from the f0 column only
+  std::vector<Numeric> f0(n);
+  read_column<Numeric>(is, f0);
+
+  Size first = n, last = n;
+  for (Size i = 0; i < n; i++) {
+    if (not(f0[i] >= frequency_range[0])) continue;
+    if (f0[i] > frequency_range[1]) {
+      last = i;
+      break;
+    }
+    first = std::min(first, i);
+  }
+  if (first > last) first = last;
+  const Size m = last - first;
+
+  // Then by species from the isotopologue column
+  std::vector<std::int64_t> isot(m);
+  is.seekg(column_pos(ncols, first));
+  read_column<std::int64_t>(is, isot);
+
+  std::vector<Size> selected;
+  selected.reserve(m);
+  for (Size i = 0; i < m; i++) {
+    if (not(f0[first + i] >= frequency_range[0])) continue;
+
+    const SpeciesEnum spec =
+        Species::Isotopologues[static_cast<Size>(isot[i])].spec;
+    if (species.empty() or stdr::contains(species, spec)) {
+      selected.push_back(i);
+    }
+  }
+
+  hitran_data out(selected.size());
+
+  std::vector<Numeric> column(m);
+  for (Size icol = 0; icol < ncols; icol++) {
+    is.seekg(column_pos(icol, first));
+    read_column<Numeric>(is, column);
+    for (Size j = 0; j < selected.size(); j++) {
+      out[j].*numeric_columns[icol] = column[selected[j]];
+    }
+  }
+
+  std::vector<std::uint64_t> offset(m + 1);
+  is.seekg(column_pos(ncols + 1, first));
+  read_column<std::uint64_t>(is, offset);
+
+  std::string qids(static_cast<Size>(offset.back() - offset.front()), '\0');
+  is.seekg(column_pos(ncols + 2, 1) +
+           static_cast<std::streamoff>(offset.front()));
+  read_column<char>(is, qids);
+
+  String error;
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Size j = 0; j < selected.size(); j++) {
+    const Size i = selected[j];
+    try {
+      out[j].qid = QuantumIdentifier{std::string_view{qids}.substr(
+          static_cast<Size>(offset[i] - offset.front()),
+          static_cast<Size>(offset[i + 1] - offset[i]))};
+    } catch (std::exception& e) {
+#pragma omp critical
+      error = e.what();
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+
+  return out;
 }
 
 line hitran_record::from(HitranLineStrengthOption ls,
@@ -3,6 +3,10 @@
 #include <enumsHitranLineStrengthOption.h>
 #include <matpack.h>
 #include <quantum.h>
+#include <species.h>
+
+#include <cstdint>
+#include <optional>
 
 #include "lbl_data.h"
 
@@ -26,11 +30,63 @@ struct hitran_record {
 };
 using hitran_data = std::vector<hitran_record>;
 
-hitran_data read_hitran_par(std::istream& file, 
-  const std::vector<HitranFileFormatType>& format_order,const Vector2& frequency_range);
-hitran_data read_hitran_par(std::istream&& file,
-  const std::vector<HitranFileFormatType>& format_order,
-                            const Vector2& frequency_range);
+/** Read the records of a HITRAN .par file
+
+  The file is read in large blocks whose lines are parsed on multiple
+  threads.  The file is assumed sorted in frequency: reading stops at the
+  first record above the frequency range.
+
+  @param[in] file The .par file
+  @param[in] format_order The layout of a line of the file
+  @param[in] frequency_range Inclusive range of the records to keep
+  @param[in] species Only keep records of these species, all if empty
+  @return The records
+*/
+hitran_data read_hitran_par(
+    std::istream& file,
+    const std::vector<HitranFileFormatType>& format_order,
+    const Vector2& frequency_range,
+    const ArrayOfSpeciesEnum& species = {});
+hitran_data read_hitran_par(
+    std::istream&& file,
+    const std::vector<HitranFileFormatType>& format_order,
+    const Vector2& frequency_range,
+    const ArrayOfSpeciesEnum& species = {});
+
+//! A hash of the content of a HITRAN file and the layout of its lines
+std::uint64_t hitran_content_hash(
+    std::istream& file, const std::vector<HitranFileFormatType>& format_order);
+
+/** Write records to a binary cache
+
+  The cache is columnar: each member of the records is stored as one
+  contiguous array, so that a part of the cache can be read without
+  reading the rest.  The binary format is that of the machine.
+
+  @param[out] os A binary stream
+  @param[in] data All the records of the HITRAN file
+  @param[in] content_hash The hitran_content_hash of the HITRAN file
+*/
+void write_hitran_cache(std::ostream& os,
+                        const hitran_data& data,
+                        const std::uint64_t content_hash);
+
+/** Read records from a binary cache
+
+  The records are selected as by read_hitran_par.  Only the parts of the
+  cache that are needed for the selection are read.
+
+  @param[in] is A binary stream
+  @param[in] content_hash The expected hitran_content_hash
+  @param[in] frequency_range Inclusive range of the records to keep
+  @param[in] species Only keep records of these species, all if empty
+  @return The records, or nothing if the cache is not for content_hash
+*/
+std::optional<hitran_data> read_hitran_cache(
+    std::istream& is,
+    const std::uint64_t content_hash,
+    const Vector2& frequency_range,
+    const ArrayOfSpeciesEnum& species = {});
 }  // namespace lbl
 
 template <>
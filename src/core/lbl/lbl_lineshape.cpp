@@ -8,6 +8,7 @@
 #include <ranges>
 
 #include "lbl_data.h"
+#include "lbl_hash.h"
 #include "lbl_lineshape_linemixing.h"
 #include "lbl_lineshape_voigt_ecs.h"
 #include "lbl_lineshape_voigt_lte.h"
@@ -16,12 +17,16 @@
 
 namespace lbl {
 namespace {
+const band_data& band_of(const frequency_index::selected& x) {
+  return x.band->second;
+}
+
 std::unique_ptr<voigt::lte::ComputeData> init_voigt_lte_data(
     const ConstVectorView& f_grid,
-    const AbsorptionBands& bnds,
+    const std::vector<frequency_index::selected>& bnds,
     const AtmPoint& atm,
     const Vector2 los) {
-  if (stdr::any_of(bnds | stdv::values, [](auto& bnd) {
+  if (stdr::any_of(bnds | stdv::transform(band_of), [](auto& bnd) {
         return bnd.lineshape == LineByLineLineshape::VP_LTE;
       }))
     return std::make_unique<voigt::lte::ComputeData>(
@@ -31,10 +36,10 @@ std::unique_ptr<voigt::lte::ComputeData> init_voigt_lte_data(
 
 std::unique_ptr<voigt::lte_mirror::ComputeData> init_voigt_lte_mirrored_data(
     const ConstVectorView& f_grid,
-    const AbsorptionBands& bnds,
+    const std::vector<frequency_index::selected>& bnds,
     const AtmPoint& atm,
     const Vector2 los) {
-  if (stdr::any_of(bnds | stdv::values, [](auto& bnd) {
+  if (stdr::any_of(bnds | stdv::transform(band_of), [](auto& bnd) {
         return bnd.lineshape == LineByLineLineshape::VP_LTE_MIRROR;
       }))
     return std::make_unique<voigt::lte_mirror::ComputeData>(
@@ -44,10 +49,10 @@ std::unique_ptr<voigt::lte_mirror::ComputeData> init_voigt_lte_mirrored_data(
 
 std::unique_ptr<voigt::nlte::ComputeData> init_voigt_line_nlte_data(
     const ConstVectorView& f_grid,
-    const AbsorptionBands& bnds,
+    const std::vector<frequency_index::selected>& bnds,
     const AtmPoint& atm,
     const Vector2 los) {
-  if (stdr::any_of(bnds | stdv::values, [](auto& bnd) {
+  if (stdr::any_of(bnds | stdv::transform(band_of), [](auto& bnd) {
         return bnd.lineshape == LineByLineLineshape::VP_LINE_NLTE;
       }))
     return std::make_unique<voigt::nlte::ComputeData>(
@@ -57,10 +62,10 @@ std::unique_ptr<voigt::nlte::ComputeData> init_voigt_line_nlte_data(
 
 std::unique_ptr<voigt::ecs::ComputeData> init_voigt_abs_ecs_data(
     const ConstVectorView& f_grid,
-    const AbsorptionBands& bnds,
+    const std::vector<frequency_index::selected>& bnds,
     const AtmPoint& atm,
     const Vector2 los) {
-  if (stdr::any_of(bnds | stdv::values, [](auto& bnd) {
+  if (stdr::any_of(bnds | stdv::transform(band_of), [](auto& bnd) {
         return bnd.lineshape == LineByLineLineshape::VP_ECS_MAKAROV or
                bnd.lineshape == LineByLineLineshape::VP_ECS_HARTMANN or
                bnd.lineshape == LineByLineLineshape::VP_ECS_STOTOP or
@@ -85,6 +90,42 @@ void calculate(PropmatVectorView pm,
                const AtmPoint& atm,
                const Vector2 los,
                const bool no_negative_absorption) {
+  const auto bnds_index =
+      frequency_index::shared(bnds, species, content_hash(bnds, species));
+
+  calculate(pm,
+            sv,
+            dpm,
+            dsv,
+            f_grid,
+            f_range,
+            jac_targets,
+            species,
+            *bnds_index,
+            abs_ecs_data,
+            atm,
+            los,
+            no_negative_absorption);
+}
+
+void calculate(PropmatVectorView pm,
+               StokvecVectorView sv,
+               PropmatMatrixView dpm,
+               StokvecMatrixView dsv,
+               const ConstVectorView f_grid,
+               const Range& f_range,
+               const Jacobian::Targets& jac_targets,
+               const SpeciesEnum species,
+               const frequency_index& bnds_index,
+               const LinemixingEcsData& abs_ecs_data,
+               const AtmPoint& atm,
+               const Vector2 los,
+               const bool no_negative_absorption) {
+  if (f_range.nelem == 0) return;
+
+  const auto bnds = bnds_index.select(f_grid[f_range].front(),
+                                      f_grid[f_range].back());
+
   auto voigt_lte_data = init_voigt_lte_data(f_grid[f_range], bnds, atm, los);
   auto voigt_lte_mirror_data =
       init_voigt_lte_mirrored_data(f_grid[f_range], bnds, atm, los);
@@ -95,18 +136,34 @@ void calculate(PropmatVectorView pm,
 
   const auto calc_voigt_lte = [&](const QuantumIdentifier& bnd_key,
                                   const band_data& bnd,
+                                  const band_soa* soa,
                                   const ZeemanPolarization pol) {
-    voigt::lte::calculate(pm,
-                          dpm,
-                          *voigt_lte_data,
-                          f_grid,
-                          f_range,
-                          jac_targets,
-                          bnd_key,
-                          bnd,
-                          atm,
-                          pol,
-                          no_negative_absorption);
+    if (soa) {
+      voigt::lte::calculate(pm,
+                            dpm,
+                            *voigt_lte_data,
+                            f_grid,
+                            f_range,
+                            jac_targets,
+                            bnd_key,
+                            bnd,
+                            *soa,
+                            atm,
+                            pol,
+                            no_negative_absorption);
+    } else {
+      voigt::lte::calculate(pm,
+                            dpm,
+                            *voigt_lte_data,
+                            f_grid,
+                            f_range,
+                            jac_targets,
+                            bnd_key,
+                            bnd,
+                            atm,
+                            pol,
+                            no_negative_absorption);
+    }
   };
 
   const auto calc_voigt_lte_mirrored = [&](const QuantumIdentifier& bnd_key,
@@ -165,12 +222,12 @@ void calculate(PropmatVectorView pm,
                           no_negative_absorption);
   };
 
-  const auto calc_switch = [&](const QuantumIdentifier& bnd_key,
-                               const band_data& bnd,
+  const auto calc_switch = [&](const frequency_index::selected& x,
                                const ZeemanPolarization pol) {
+    const auto& [bnd_key, bnd] = *x.band;
     switch (bnd.lineshape) {
       case LineByLineLineshape::VP_LTE:
-        calc_voigt_lte(bnd_key, bnd, pol);
+        calc_voigt_lte(bnd_key, bnd, x.snapshot, pol);
         break;
       case LineByLineLineshape::VP_LTE_MIRROR:
         calc_voigt_lte_mirrored(bnd_key, bnd, pol);
@@ -187,9 +244,10 @@ void calculate(PropmatVectorView pm,
     }
   };
 
-  for (auto& [bnd_key, bnd] : bnds) {
-    if (species == bnd_key.isot.spec or species == SpeciesEnum::Bath) {
-      calc_switch(bnd_key, bnd, ZeemanPolarization::no);
+  for (auto& x : bnds) {
+    const SpeciesEnum spec = x.band->first.isot.spec;
+    if (species == spec or species == SpeciesEnum::Bath) {
+      calc_switch(x, ZeemanPolarization::no);
     }
   }
 
@@ -200,9 +258,10 @@ void calculate(PropmatVectorView pm,
     if (voigt_lte_mirror_data) voigt_lte_mirror_data->update_zeeman(los, atm.mag, pol);
     if (voigt_line_nlte_data) voigt_line_nlte_data->update_zeeman(los, atm.mag, pol);
 
-    for (auto& [bnd_key, bnd] : bnds) {
-      if (species == bnd_key.isot.spec or species == SpeciesEnum::Bath) {
-        calc_switch(bnd_key, bnd, pol);
+    for (auto& x : bnds) {
+      const SpeciesEnum spec = x.band->first.isot.spec;
+      if (species == spec or species == SpeciesEnum::Bath) {
+        calc_switch(x, pol);
       }
     }
   }
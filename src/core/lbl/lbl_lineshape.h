@@ -1,6 +1,7 @@
 #pragma once
 
 #include "lbl_data.h"
+#include "lbl_frequency_index.h"
 #include "lbl_lineshape_linemixing.h"
 
 //! FIXME: These functions should be elsewhere?
@@ -9,6 +10,11 @@ struct Targets;
 }  // namespace Jacobian
 
 namespace lbl {
+/** The line-by-line absorption of the bands
+
+  The frequency index of the bands, with the snapshots of the VP_LTE
+  bands, is kept between calls, see frequency_index::shared.
+*/
 void calculate(PropmatVectorView pm,
                StokvecVectorView sv,
                PropmatMatrixView dpm,
@@ -22,4 +28,24 @@ void calculate(PropmatVectorView pm,
                const AtmPoint& atm,
                const Vector2 los,
                const bool no_negative_absorption);
+
+/** As above, but for the bands of an index
+
+  Only the bands that the index selects for f_grid[f_range] are computed.
+  It is useful to build the index once if the same bands are computed for
+  many atmospheric points or many frequency ranges.
+*/
+void calculate(PropmatVectorView pm,
+               StokvecVectorView sv,
+               PropmatMatrixView dpm,
+               StokvecMatrixView dsv,
+               const ConstVectorView f_grid,
+               const Range& f_range,
+               const Jacobian::Targets& jac_targets,
+               const SpeciesEnum species,
+               const frequency_index& bnds_index,
+               const LinemixingEcsData& abs_ecs_data,
+               const AtmPoint& atm,
+               const Vector2 los,
+               const bool no_negative_absorption);
 }  // namespace lbl
@@ -9,12 +9,14 @@
 #include <quantum.h>
 #include <sorting.h>
 
-#include <Faddeeva/Faddeeva.hh>
 #include <algorithm>
+#include <array>
+#include <cassert>
 #include <cmath>
 #include <numeric>
 
 #include "lbl_data.h"
+#include "lbl_voigt_faddeeva.h"
 #include "lbl_zeeman.h"
 
 namespace lbl::voigt::lte {
@@ -236,7 +238,15 @@ single_shape::single_shape(const SpeciesIsotope& spec,
       s(line.z.Strength(line.qn, pol, iz) *
         line_strength_calc(inv_gd, spec, line, atm)) {}
 
-Complex single_shape::F(const Complex z_) { return Faddeeva::w(z_); }
+namespace {
+//! The step of the numerical derivative of the Faddeeva function
+Complex dF_step(const Complex z) {
+  return {std::max(1e-4 * nonstd::abs(z.real()), 1e-4),
+          std::max(1e-4 * nonstd::abs(z.imag()), 1e-4)};
+}
+}  // namespace
+
+Complex single_shape::F(const Complex z_) { return faddeeva::w(z_); }
 
 Complex single_shape::F(const Numeric f) const { return F(z(f)); }
 
@@ -261,9 +271,8 @@ Complex single_shape::dF(const Complex z_, const Complex F_) {
    * y > 1e7, it always fails.  This is about the analytical form
    * above using the latest version of the MIT Faddeeva package.
   */
-  const Complex dz{std::max(1e-4 * nonstd::abs(z_.real()), 1e-4),
-                   std::max(1e-4 * nonstd::abs(z_.imag()), 1e-4)};
-  const Complex F_2 = Faddeeva::w(z_ + dz);
+  const Complex dz  = dF_step(z_);
+  const Complex F_2 = faddeeva::w(z_ + dz);
   return (F_2 - F_) / dz;
 }
 
@@ -425,33 +434,155 @@ void band_shape_helper(std::vector<single_shape>& lines,
   });
 }
 
+void band_shape_helper(std::vector<single_shape>& lines,
+                       std::vector<line_pos>& pos,
+                       const SpeciesIsotope& spec,
+                       const band_data& bnd,
+                       const band_soa& soa,
+                       const AtmPoint& atm,
+                       const Numeric fmin,
+                       const Numeric fmax,
+                       const ZeemanPolarization pol) {
+  assert(soa.size() == bnd.size());
+
+  lines.resize(0);
+  pos.resize(0);
+
+  auto first = soa.f0.begin();
+  auto last  = soa.f0.end();
+  if (bnd.cutoff.type == LineByLineCutoffType::ByLine) {
+    const Numeric c = bnd.get_cutoff_frequency();
+    first           = std::lower_bound(first, last, fmin - c);
+    last            = std::upper_bound(first, last, fmax + c);
+  }
+
+  const Size ifirst = static_cast<Size>(first - soa.f0.begin());
+  const Size ilast  = static_cast<Size>(last - soa.f0.begin());
+
+  // The same for all lines of the band
+  const Numeric T = atm.temperature;
+  const Numeric Q = PartitionFunctions::Q(T, spec);
+  const Numeric r = atm[spec];
+  const Numeric x = atm[spec.spec];
+  const Numeric H = std::hypot(atm.mag[0], atm.mag[1], atm.mag[2]);
+  const Numeric scaled_gd_part =
+      std::sqrt(Constant::doppler_broadening_const_squared * T / spec.mass);
+  const bool zeeman = pol != ZeemanPolarization::no;
+
+  lines.reserve(ilast - ifirst);
+  pos.reserve(lines.capacity());
+
+  for (Size iline = ifirst; iline < ilast; iline++) {
+    if (static_cast<bool>(soa.zeeman[iline]) != zeeman) continue;
+
+    const Numeric G = soa.G(iline, atm);
+    const Numeric Y = soa.Y(iline, atm);
+    const Complex lm{1 + G, -Y};
+
+    single_shape s;
+    s.f0     = soa.f0[iline] + soa.D0(iline, atm) + soa.DV(iline, atm);
+    s.inv_gd = 1.0 / (scaled_gd_part * s.f0);
+    s.z_imag = soa.G0(iline, atm) * s.inv_gd;
+    s.s      = Constant::inv_sqrt_pi * s.inv_gd * r * x * lm *
+          soa.s(iline, T, Q);
+
+    if (not zeeman) {
+      lines.emplace_back(s);
+      pos.emplace_back(line_pos{.line = iline});
+      continue;
+    }
+
+    const line& ln = bnd.lines[iline];
+    const auto nz  = static_cast<Size>(ln.z.size(ln.qn, pol));
+    for (Size iz = 0; iz < nz; iz++) {
+      const Complex s_iz = ln.z.Strength(ln.qn, pol, iz) * s.s;
+      if (s_iz == 0.0) continue;
+
+      lines.emplace_back(s);
+      lines.back().f0 = s.f0 + H * ln.z.Splitting(ln.qn, pol, iz);
+      lines.back().s  = s_iz;
+      pos.emplace_back(line_pos{.line = iline, .iz = iz});
+    }
+  }
+
+  stdr::sort(stdv::zip(lines, pos), {}, [](const auto& x) {
+    return std::get<0>(x).f0;
+  });
+}
+
+namespace {
+//! The number of lines whose Faddeeva function is evaluated together
+constexpr Size faddeeva_chunk = 64;
+
+/*! Sum fn(i, F) over the lines, F being the Faddeeva function of line i at f
+
+  The Faddeeva function is evaluated for a chunk of lines at a time, so that
+  the vectorized faddeeva::w can be used.
+*/
+template <typename Fn>
+Complex sum_F(const std::span<const single_shape> lines,
+              const Numeric f,
+              Fn&& fn) {
+  std::array<Complex, faddeeva_chunk> z, F;
+
+  Complex out{};
+  for (Size i0 = 0; i0 < lines.size(); i0 += faddeeva_chunk) {
+    const Size n = std::min(faddeeva_chunk, lines.size() - i0);
+
+    for (Size i = 0; i < n; i++) z[i] = lines[i0 + i].z(f);
+    faddeeva::w(std::span{F}.first(n), std::span{z}.first(n));
+    for (Size i = 0; i < n; i++) out += fn(i0 + i, F[i]);
+  }
+
+  return out;
+}
+
+//! As sum_F but calls fn(i, z, F, dF), with dF as in single_shape::dF
+template <typename Fn>
+Complex sum_zFdF(const std::span<const single_shape> lines,
+                 const Numeric f,
+                 Fn&& fn) {
+  std::array<Complex, 2 * faddeeva_chunk> z, F;
+
+  Complex out{};
+  for (Size i0 = 0; i0 < lines.size(); i0 += faddeeva_chunk) {
+    const Size n = std::min(faddeeva_chunk, lines.size() - i0);
+
+    for (Size i = 0; i < n; i++) {
+      z[i]     = lines[i0 + i].z(f);
+      z[n + i] = z[i] + dF_step(z[i]);
+    }
+    faddeeva::w(std::span{F}.first(2 * n), std::span{z}.first(2 * n));
+    for (Size i = 0; i < n; i++) {
+      const Complex dF = (F[n + i] - F[i]) / dF_step(z[i]);
+      out             += fn(i0 + i, z[i], F[i], dF);
+    }
+  }
+
+  return out;
+}
+}  // namespace
+
 band_shape::band_shape(std::vector<single_shape>&& ls, const Numeric cut)
     : lines(std::move(ls)), cutoff(cut) {}
 
 Complex band_shape::operator()(const Numeric f) const {
-  return std::transform_reduce(
-      lines.begin(), lines.end(), Complex{}, std::plus<>{}, [f](auto& ls) {
-        return ls(f);
-      });
+  return sum_F(lines, f, [this](Size i, Complex F) { return lines[i].s * F; });
 }
 
 Complex band_shape::df(const Numeric f) const {
-  return std::transform_reduce(
-      lines.begin(), lines.end(), Complex{}, std::plus<>{}, [f](auto& ls) {
-        return ls.df(f);
-      });
+  return sum_zFdF(lines, f, [this](Size i, Complex, Complex, Complex dF) {
+    return lines[i].s * lines[i].inv_gd * dF;
+  });
 }
 
 Complex band_shape::dH(const ConstComplexVectorView& dz_dH,
                        const Numeric f) const {
   assert(static_cast<Size>(dz_dH.size()) == lines.size());
 
-  return std::transform_reduce(lines.begin(),
-                               lines.end(),
-                               dz_dH.begin(),
-                               Complex{},
-                               std::plus<>{},
-                               [f](auto& ls, auto& d) { return ls.dH(d, f); });
+  return sum_zFdF(lines, f, [&](Size i, Complex, Complex, Complex dF) {
+    return lines[i].s * dz_dH[i] * dF;
+  });
 }
 
 Complex band_shape::dT(const ConstComplexVectorView& ds_dT,
@@ -461,13 +592,9 @@ Complex band_shape::dT(const ConstComplexVectorView& ds_dT,
   assert(ds_dT.size() == dz_dT.size());
   assert(static_cast<Size>(ds_dT.size()) == lines.size());
 
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
-  for (Size i = 0; i < lines.size(); ++i) {
-    out += lines[i].dT(ds_dT[i], dz_dT[i], dz_dT_fac[i], f);
-  }
-
-  return out;
+  return sum_zFdF(lines, f, [&](Size i, Complex z, Complex F, Complex dF) {
+    return ds_dT[i] * F + lines[i].s * (dz_dT[i] + dz_dT_fac[i] * z) * dF;
+  });
 }
 
 Complex band_shape::dVMR(const ConstComplexVectorView& ds_dVMR,
@@ -477,13 +604,10 @@ Complex band_shape::dVMR(const ConstComplexVectorView& ds_dVMR,
   assert(ds_dVMR.size() == dz_dVMR.size());
   assert(static_cast<Size>(ds_dVMR.size()) == lines.size());
 
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
-  for (Size i = 0; i < lines.size(); ++i) {
-    out += lines[i].dVMR(ds_dVMR[i], dz_dVMR[i], dz_dVMR_fac[i], f);
-  }
-
-  return out;
+  return sum_zFdF(lines, f, [&](Size i, Complex z, Complex F, Complex dF) {
+    return ds_dVMR[i] * F +
+           lines[i].s * (dz_dVMR[i] + dz_dVMR_fac[i] * z) * dF;
+  });
 }
 
 Complex band_shape::df0(const ConstComplexVectorView ds_df0,
@@ -591,12 +715,7 @@ Complex band_shape::dG(const ConstComplexVectorView ds_dG,
 Complex band_shape::operator()(const ConstComplexVectorView& cut,
                                const Numeric f) const {
   const auto [s, cs] = frequency_spans(cutoff, f, lines, cut);
-  return std::transform_reduce(s.begin(),
-                               s.end(),
-                               cs.begin(),
-                               Complex{},
-                               std::plus<>{},
-                               [f](auto& ls, auto& c) { return ls(f) - c; });
+  return sum_F(s, f, [&](Size i, Complex F) { return s[i].s * F - cs[i]; });
 }
 
 void band_shape::operator()(ComplexVectorView cut) const {
@@ -610,12 +729,9 @@ void band_shape::operator()(ComplexVectorView cut) const {
 Complex band_shape::df(const ConstComplexVectorView& cut,
                        const Numeric f) const {
   const auto [s, cs] = frequency_spans(cutoff, f, lines, cut);
-  return std::transform_reduce(s.begin(),
-                               s.end(),
-                               cs.begin(),
-                               Complex{},
-                               std::plus<>{},
-                               [f](auto& ls, auto& c) { return ls.df(f) - c; });
+  return sum_zFdF(s, f, [&](Size i, Complex, Complex, Complex dF) {
+    return s[i].s * s[i].inv_gd * dF - cs[i];
+  });
 }
 
 void band_shape::df(ComplexVectorView cut) const {
@@ -632,13 +748,9 @@ Complex band_shape::dH(const ConstComplexVectorView& cut,
   assert(static_cast<Size>(dz_dH.size()) == lines.size());
 
   const auto [s, cs, dH] = frequency_spans(cutoff, f, lines, cut, dz_dH);
-
-  Complex out{};  //! Fixme, use zip in C++ 23...
-  for (Size i = 0; i < s.size(); ++i) {
-    out += s[i].dH(dH[i], f) - cs[i];
-  }
-
-  return out;
+  return sum_zFdF(s, f, [&](Size i, Complex, Complex, Complex dF) {
+    return s[i].s * dH[i] * dF - cs[i];
+  });
 }
 
 void band_shape::dH(ComplexVectorView cut,
@@ -662,16 +774,11 @@ Complex band_shape::dT(const ConstComplexVectorView& cut,
   assert(ds_dT.size() == dz_dT.size());
   assert(static_cast<Size>(ds_dT.size()) == lines.size());
 
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
   const auto [s, cs, ds, dz, dzf] =
       frequency_spans(cutoff, f, lines, cut, ds_dT, dz_dT, dz_dT_fac);
-
-  for (Size i = 0; i < s.size(); ++i) {
-    out += s[i].dT(ds[i], dz[i], dzf[i], f) - cs[i];
-  }
-
-  return out;
+  return sum_zFdF(s, f, [&](Size i, Complex z, Complex F, Complex dF) {
+    return ds[i] * F + s[i].s * (dz[i] + dzf[i] * z) * dF - cs[i];
+  });
 }
 
 void band_shape::dT(ComplexVectorView cut,
@@ -695,16 +802,11 @@ Complex band_shape::dVMR(const ConstComplexVectorView& cut,
   assert(ds_dVMR.size() == dz_dVMR.size());
   assert(static_cast<Size>(ds_dVMR.size()) == lines.size());
 
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
   const auto [s, cs, ds, dz, dzf] =
       frequency_spans(cutoff, f, lines, cut, ds_dVMR, dz_dVMR, dz_dVMR_fac);
-
-  for (Size i = 0; i < s.size(); ++i) {
-    out += s[i].dVMR(ds[i], dz[i], dzf[i], f) - cs[i];
-  }
-
-  return out;
+  return sum_zFdF(s, f, [&](Size i, Complex z, Complex F, Complex dF) {
+    return ds[i] * F + s[i].s * (dz[i] + dzf[i] * z) * dF - cs[i];
+  });
 }
 
 void band_shape::dVMR(ComplexVectorView cut,
@@ -1647,19 +1749,20 @@ void compute_derivative(PropmatVectorView,
                         const AtmPoint&,
                         const ZeemanPolarization,
                         const auto&) {}
-}  // namespace
 
-void calculate(PropmatVectorView pm_,
-               PropmatMatrixView dpm,
-               ComputeData& com_data,
-               const ConstVectorView f_grid_,
-               const Range& f_range,
-               const JacobianTargets& jac_targets,
-               const QuantumIdentifier& bnd_qid,
-               const band_data& bnd,
-               const AtmPoint& atm,
-               const ZeemanPolarization pol,
-               const bool no_negative_absorption) {
+//! The snapshot is used for the line parameters if it is not nullptr
+void calculate_impl(PropmatVectorView pm_,
+                    PropmatMatrixView dpm,
+                    ComputeData& com_data,
+                    const ConstVectorView f_grid_,
+                    const Range& f_range,
+                    const JacobianTargets& jac_targets,
+                    const QuantumIdentifier& bnd_qid,
+                    const band_data& bnd,
+                    const band_soa* soa,
+                    const AtmPoint& atm,
+                    const ZeemanPolarization pol,
+                    const bool no_negative_absorption) {
   if (stdr::all_of(com_data.npm, [](auto& n) { return n == 0; })) return;
 
   PropmatVectorView pm         = pm_[f_range];
@@ -1676,8 +1779,13 @@ void calculate(PropmatVectorView pm_,
          f_grid_.size() == static_cast<Size>(dpm.ncols()));
   assert(nf == pm.size());
 
-  band_shape_helper(
-      com_data.lines, com_data.pos, spec, bnd, atm, fmin, fmax, pol);
+  if (soa) {
+    band_shape_helper(
+        com_data.lines, com_data.pos, spec, bnd, *soa, atm, fmin, fmax, pol);
+  } else {
+    band_shape_helper(
+        com_data.lines, com_data.pos, spec, bnd, atm, fmin, fmax, pol);
+  }
   if (com_data.lines.empty()) return;
 
   //! Not const to save lines for reuse
@@ -1723,6 +1831,59 @@ void calculate(PropmatVectorView pm_,
 
   com_data.lines = std::move(shape.lines);
 }
+}  // namespace
+
+void calculate(PropmatVectorView pm,
+               PropmatMatrixView dpm,
+               ComputeData& com_data,
+               const ConstVectorView f_grid,
+               const Range& f_range,
+               const JacobianTargets& jac_targets,
+               const QuantumIdentifier& bnd_qid,
+               const band_data& bnd,
+               const AtmPoint& atm,
+               const ZeemanPolarization pol,
+               const bool no_negative_absorption) {
+  calculate_impl(pm,
+                 dpm,
+                 com_data,
+                 f_grid,
+                 f_range,
+                 jac_targets,
+                 bnd_qid,
+                 bnd,
+                 nullptr,
+                 atm,
+                 pol,
+                 no_negative_absorption);
+}
+
+void calculate(PropmatVectorView pm,
+               PropmatMatrixView dpm,
+               ComputeData& com_data,
+               const ConstVectorView f_grid,
+               const Range& f_range,
+               const JacobianTargets& jac_targets,
+               const QuantumIdentifier& bnd_qid,
+               const band_data& bnd,
+               const band_soa& soa,
+               const AtmPoint& atm,
+               const ZeemanPolarization pol,
+               const bool no_negative_absorption) {
+  assert(soa.size() == bnd.size());
+  calculate_impl(pm,
+                 dpm,
+                 com_data,
+                 f_grid,
+                 f_range,
+                 jac_targets,
+                 bnd_qid,
+                 bnd,
+                 &soa,
+                 atm,
+                 pol,
+                 no_negative_absorption);
+}
 
 namespace {
 void compute_derivative(ComplexVectorView dp,
@@ -9,6 +9,7 @@
 #include <limits>
 #include <vector>
 
+#include "lbl_band_soa.h"
 #include "lbl_data.h"
 
 //! FIXME: These functions should be elsewhere?
@@ -120,6 +121,22 @@ void band_shape_helper(std::vector<single_shape>& lines,
                        const Numeric fmax,
                        const ZeemanPolarization pol);
 
+/*! As above, but reads the line parameters from a compiled snapshot
+
+  The snapshot must have been compiled from bnd, whose lines are then only
+  accessed for the Zeeman splitting.  The result is identical to that of the
+  overload above.
+*/
+void band_shape_helper(std::vector<single_shape>& lines,
+                       std::vector<line_pos>& pos,
+                       const SpeciesIsotope& spec,
+                       const band_data& bnd,
+                       const band_soa& soa,
+                       const AtmPoint& atm,
+                       const Numeric fmin,
+                       const Numeric fmax,
+                       const ZeemanPolarization pol);
+
 constexpr std::pair<Index, Index> find_offset_and_count_of_frequency_range(
     const std::span<const single_shape> lines, Numeric f, Numeric cutoff) {
   if (cutoff < std::numeric_limits<Numeric>::infinity()) {
@@ -507,6 +524,23 @@ void calculate(PropmatVectorView pm,
                const ZeemanPolarization pol,
                const bool no_negative_absorption);
 
+/*! As above, but the line parameters are read from a compiled snapshot
+
+  The snapshot must have been compiled from bnd, see band_shape_helper.
+*/
+void calculate(PropmatVectorView pm,
+               PropmatMatrixView dpm,
+               ComputeData& com_data,
+               const ConstVectorView f_grid,
+               const Range& f_range,
+               const Jacobian::Targets& jac_targets,
+               const QuantumIdentifier& bnd_qid,
+               const band_data& bnd,
+               const band_soa& soa,
+               const AtmPoint& atm,
+               const ZeemanPolarization pol,
+               const bool no_negative_absorption);
+
 //! returns true if number of Zeeman lines is 0
 bool calculate(ComplexVectorView pm,
                ComplexMatrixView dpm,
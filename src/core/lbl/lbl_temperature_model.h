@@ -281,6 +281,27 @@ constexpr Numeric dAER_dT(
 }
 }  // namespace model
 
+//! Evaluate a temperature model of the given type with coefficients x
+inline Numeric compute(LineShapeModelType t,
+                       const ConstVectorView& x,
+                       Numeric T0_,
+                       Numeric T) {
+  switch (t) {
+    using enum LineShapeModelType;
+    case T0:   return model::T0(x[0]);
+    case T1:   return model::T1(x[0], x[1], T0_, T);
+    case T2:   return model::T2(x[0], x[1], x[2], T0_, T);
+    case T3:   return model::T3(x[0], x[1], T0_, T);
+    case T4:   return model::T4(x[0], x[1], x[2], T0_, T);
+    case T5:   return model::T5(x[0], x[1], T0_, T);
+    case AER:  return model::AER(x[0], x[1], x[2], x[3], T);
+    case DPL:  return model::DPL(x[0], x[1], x[2], x[3], T0_, T);
+    case POLY: return model::POLY(x, T);
+  }
+
+  return NAN;
+}
+
 class data {
   LineShapeModelType t{LineShapeModelType::T0};
   Vector x{};
@@ -296,20 +317,7 @@ class data {
   data(LineShapeModelType type = LineShapeModelType::T0, Vector X = {0.0});
 
   [[nodiscard]] Numeric operator()(Numeric T0_, Numeric T) const {
-    switch (t) {
-      using enum LineShapeModelType;
-      case T0:   return model::T0(x[0]);
-      case T1:   return model::T1(x[0], x[1], T0_, T);
-      case T2:   return model::T2(x[0], x[1], x[2], T0_, T);
-      case T3:   return model::T3(x[0], x[1], T0_, T);
-      case T4:   return model::T4(x[0], x[1], x[2], T0_, T);
-      case T5:   return model::T5(x[0], x[1], T0_, T);
-      case AER:  return model::AER(x[0], x[1], x[2], x[3], T);
-      case DPL:  return model::DPL(x[0], x[1], x[2], x[3], T0_, T);
-      case POLY: return model::POLY(x, T);
-    }
-
-    return NAN;
+    return compute(t, x, T0_, T);
   }
 
 #define DERIVATIVES(name)                                                    \
@@ -0,0 +1,223 @@
+#include "lbl_voigt_faddeeva.h"
+
+#include <Faddeeva/Faddeeva.hh>
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <numbers>
+
+#if defined(__x86_64__) and defined(__linux__) and defined(__has_attribute)
+#if __has_attribute(target_clones)
+#define FADDEEVA_TARGET_CLONES 1
+#endif
+#endif
+
+#ifdef FADDEEVA_TARGET_CLONES
+#define FADDEEVA_SIMD \
+  __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define FADDEEVA_SIMD
+#endif
+
+namespace lbl::voigt::faddeeva {
+namespace {
+constexpr Numeric inv_sqrt_pi = std::numbers::inv_sqrtpi;
+
+//! The number of terms of the Weideman series
+constexpr Size N = 40;
+
+//! The number of levels of the continued fraction
+constexpr Size nu = 12;
+
+//! The number of arguments evaluated together
+constexpr Size chunk = 64;
+
+//! Arguments this large are passed on to Faddeeva::w
+constexpr Numeric max_abs = 1e150;
+
+struct weideman_coefficients {
+  Numeric L;
+  std::array<Numeric, N + 1> a;
+
+  //! See the appendix of Weideman (1994), computed by a direct DFT
+  weideman_coefficients() : L(std::sqrt(N / std::numbers::sqrt2)) {
+    constexpr Size M  = 2 * N;
+    constexpr Size M2 = 2 * M;
+
+    std::array<Numeric, M2> f{}, theta{};
+    for (Size j = 1; j < M2; j++) {
+      theta[j]        = std::numbers::pi * (static_cast<Numeric>(j) - M) / M;
+      const Numeric t = L * std::tan(0.5 * theta[j]);
+      f[j]            = std::exp(-t * t) * (L * L + t * t);
+    }
+
+    for (Size n = 0; n <= N; n++) {
+      Numeric sum = 0.0;
+      for (Size j = 0; j < M2; j++) {
+        sum += f[j] * std::cos(static_cast<Numeric>(n) * theta[j]);
+      }
+      a[n] = sum / M2;
+    }
+  }
+};
+
+const weideman_coefficients& weideman() {
+  static const weideman_coefficients c;
+  return c;
+}
+
+//! Whether or not the continued fraction has converged to machine precision
+bool use_continued_fraction(Numeric x, Numeric y) {
+  // Fit of the required depth from the MIT Faddeeva package, solved for nu
+  constexpr Numeric limit = 11.398 / (static_cast<Numeric>(nu) - 3.9);
+  return 0.08254 * std::abs(x) + 0.1421 * y + 0.2023 >= limit;
+}
+
+bool use_fallback(Numeric x, Numeric y) {
+  return not(y >= 0.0 and std::abs(x) < max_abs and y < max_abs);
+}
+
+/*! The Weideman series for y >= 0
+
+  w(z) = 2 p(Z) / (L - iz)^2 + 1 / sqrt(pi) / (L - iz),
+  where Z = (L + iz) / (L - iz) and p(Z) = sum a[n] Z^(n-1)
+*/
+FADDEEVA_SIMD
+void weideman_kernel(Numeric* __restrict wr,
+                     Numeric* __restrict wi,
+                     const Numeric* __restrict x,
+                     const Numeric* __restrict y,
+                     const Size n,
+                     const weideman_coefficients& coef) {
+  const Numeric L                    = coef.L;
+  const std::array<Numeric, N + 1> a = coef.a;
+
+#pragma omp simd
+  for (Size i = 0; i < n; i++) {
+    const Numeric dr  = L + y[i];
+    const Numeric di  = -x[i];
+    const Numeric ur  = L - y[i];
+    const Numeric ui  = x[i];
+    const Numeric inv = 1.0 / (dr * dr + di * di);
+
+    const Numeric Zr = (ur * dr + ui * di) * inv;
+    const Numeric Zi = (ui * dr - ur * di) * inv;
+
+    Numeric pr = a[N];
+    Numeric pi = 0.0;
+    for (Size k = N - 1; k > 0; k--) {
+      const Numeric t = pr * Zr - pi * Zi;
+      pi              = pr * Zi + pi * Zr;
+      pr              = t + a[k];
+    }
+
+    const Numeric qr  = dr * inv;
+    const Numeric qi  = -di * inv;
+    const Numeric q2r = qr * qr - qi * qi;
+    const Numeric q2i = 2.0 * qr * qi;
+
+    wr[i] = 2.0 * (pr * q2r - pi * q2i) + inv_sqrt_pi * qr;
+    wi[i] = 2.0 * (pr * q2i + pi * q2r) + inv_sqrt_pi * qi;
+  }
+}
+
+/*! The Laplace continued fraction for y >= 0
+
+  w(z) = i / sqrt(pi) / (z - 1/2 / (z - 1 / (z - 3/2 / (z - ...))))
+*/
+FADDEEVA_SIMD
+void continued_fraction_kernel(Numeric* __restrict wr,
+                               Numeric* __restrict wi,
+                               const Numeric* __restrict x,
+                               const Numeric* __restrict y,
+                               const Size n) {
+#pragma omp simd
+  for (Size i = 0; i < n; i++) {
+    Numeric ar = x[i];
+    Numeric ai = y[i];
+#pragma GCC unroll 16
+    for (Size k = nu - 1; k > 0; k--) {
+      const Numeric d = 0.5 * static_cast<Numeric>(k) / (ar * ar + ai * ai);
+      ar              = x[i] - ar * d;
+      ai              = y[i] + ai * d;
+    }
+
+    const Numeric d = inv_sqrt_pi / (ar * ar + ai * ai);
+    wr[i]           = d * ai;
+    wi[i]           = d * ar;
+  }
+}
+
+//! Arguments of one kernel gathered from a chunk
+struct gathered {
+  std::array<Numeric, chunk> x, y, wr, wi;
+  std::array<Size, chunk> pos;
+  Size n{0};
+
+  void push_back(Complex z, Size i) {
+    x[n]   = z.real();
+    y[n]   = z.imag();
+    pos[n] = i;
+    n++;
+  }
+
+  void scatter(std::span<Complex> out) const {
+    for (Size i = 0; i < n; i++) out[pos[i]] = Complex{wr[i], wi[i]};
+  }
+};
+}  // namespace
+
+Complex w(const Complex z) {
+  Complex out;
+  w({&out, 1}, {&z, 1});
+  return out;
+}
+
+void w(std::span<Complex> out, std::span<const Complex> z) {
+  assert(out.size() == z.size());
+
+  const weideman_coefficients& coef = weideman();
+
+  gathered near, far;
+  for (Size i0 = 0; i0 < z.size(); i0 += chunk) {
+    const Size n = std::min(chunk, z.size() - i0);
+
+    near.n = 0;
+    far.n  = 0;
+    for (Size i = i0; i < i0 + n; i++) {
+      const Numeric x = z[i].real();
+      const Numeric y = z[i].imag();
+
+      if (use_fallback(x, y)) {
+        out[i] = Faddeeva::w(z[i]);
+      } else if (use_continued_fraction(x, y)) {
+        far.push_back(z[i], i);
+      } else {
+        near.push_back(z[i], i);
+      }
+    }
+
+    weideman_kernel(near.wr.data(),
+                    near.wi.data(),
+                    near.x.data(),
+                    near.y.data(),
+                    near.n,
+                    coef);
+    continued_fraction_kernel(
+        far.wr.data(), far.wi.data(), far.x.data(), far.y.data(), far.n);
+
+    near.scatter(out);
+    far.scatter(out);
+  }
+}
+
+std::string_view simd_target() {
+#ifdef FADDEEVA_TARGET_CLONES
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) return "avx512f";
+  if (__builtin_cpu_supports("avx2")) return "avx2";
+#endif
+  return "default";
+}
+}  // namespace lbl::voigt::faddeeva
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <matpack.h>
+
+#include <span>
+#include <string_view>
+
+/*! Vectorized evaluation of the Faddeeva function w(z)
+
+  In the upper half-plane, w(z) is computed by the rational series of
+  Weideman (1994, SIAM J. Numer. Anal. 31, 1497-1518) with 40 terms close
+  to the origin, and by a fixed-depth Laplace continued fraction further
+  out.  Both are branch-free, so batches of arguments are evaluated by
+  loops that the compiler vectorizes.  On x86-64 Linux, AVX2 and AVX-512
+  clones of these loops are compiled and selected at runtime.
+
+  The relative error compared to Faddeeva::w is below 1e-13.  Arguments
+  in the lower half-plane and non-finite arguments are passed on to
+  Faddeeva::w.
+*/
+namespace lbl::voigt::faddeeva {
+//! The Faddeeva function w(z)
+[[nodiscard]] Complex w(const Complex z);
+
+/** The Faddeeva function w(z) for many z
+
+  @param[out] out w(z), must have the same size as z
+  @param[in] z The arguments
+*/
+void w(std::span<Complex> out, std::span<const Complex> z);
+
+//! The instruction set used by w() on this machine
+[[nodiscard]] std::string_view simd_target();
+}  // namespace lbl::voigt::faddeeva
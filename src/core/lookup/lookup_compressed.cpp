@@ -0,0 +1,213 @@
+#include "lookup_compressed.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+namespace lookup {
+namespace {
+//! ScaledInt16 code reserved for zero cross sections
+constexpr std::uint16_t zero_code = 0;
+
+//! The largest ScaledInt16 code
+constexpr std::uint16_t max_code = std::numeric_limits<std::uint16_t>::max();
+
+//! IEEE half precision of minus infinity, used for zero cross sections
+constexpr std::uint16_t half_minus_inf = 0xFC00;
+
+/*! Round a float to the nearest IEEE half precision value
+
+  Overflows to infinity, underflows gracefully to the subnormals.  NaN
+  is kept a (quiet) NaN.
+*/
+std::uint16_t float_to_half(float x) {
+  constexpr std::uint32_t f32_inf      = 255U << 23;
+  constexpr std::uint32_t f16_max      = (127U + 16U) << 23;
+  constexpr std::uint32_t denorm_magic = ((127U - 15U) + (23U - 10U) + 1U)
+                                         << 23;
+
+  std::uint32_t u          = std::bit_cast<std::uint32_t>(x);
+  const std::uint32_t sign = u & 0x80000000U;
+  u                       ^= sign;
+
+  std::uint32_t o;
+  if (u >= f16_max) {
+    o = u > f32_inf ? 0x7E00U : 0x7C00U;
+  } else if (u < (113U << 23)) {
+    const float f =
+        std::bit_cast<float>(u) + std::bit_cast<float>(denorm_magic);
+    o = std::bit_cast<std::uint32_t>(f) - denorm_magic;
+  } else {
+    const std::uint32_t mant_odd  = (u >> 13) & 1U;
+    u                            += (15U - 127U) << 23;
+    u                            += 0xFFFU + mant_odd;
+    o                             = u >> 13;
+  }
+
+  return static_cast<std::uint16_t>(o | (sign >> 16));
+}
+
+//! Convert an IEEE half precision value to float, exact
+float half_to_float(std::uint16_t h) {
+  constexpr std::uint32_t shifted_exp = 0x7C00U << 13;
+  constexpr float magic = std::bit_cast<float>(std::uint32_t{113U << 23});
+
+  std::uint32_t o         = (h & 0x7FFFU) << 13;
+  const std::uint32_t exp = shifted_exp & o;
+  o                      += (127U - 15U) << 23;
+
+  if (exp == shifted_exp) {
+    o += (128U - 16U) << 23;
+  } else if (exp == 0) {
+    o += 1U << 23;
+    o  = std::bit_cast<std::uint32_t>(std::bit_cast<float>(o) - magic);
+  }
+
+  return std::bit_cast<float>(o | ((h & 0x8000U) << 16));
+}
+
+void check_value(Numeric x) {
+  ARTS_USER_ERROR_IF(
+      not std::isfinite(x) or x < 0.0,
+      "Reduced precision storage requires finite non-negative cross sections, "
+      "found {}",
+      x)
+}
+}  // namespace
+
+compressed_xsec::compressed_xsec(LookupTableStorage type_,
+                                 const ConstTensor4View& xsec)
+    : type(type_), shape(xsec.shape()) {
+  ARTS_USER_ERROR_IF(type == LookupTableStorage::Double,
+                     "Double precision is not a reduced storage mode")
+
+  const auto [nt, nw, np, nf] = shape;
+  const Index ntw             = nt * nw;
+  const Index npf             = np * nf;
+  const ConstVectorView x     = xsec.view_as(ntw * npf);
+
+  for (auto v : x) check_value(v);
+
+  switch (type) {
+    case LookupTableStorage::Double: break;
+    case LookupTableStorage::LogFloat32:
+      log32.resize(x.size());
+      std::transform(x.begin(), x.end(), log32.begin(), [](Numeric v) {
+        return static_cast<float>(std::log(v));
+      });
+      break;
+    case LookupTableStorage::LogFloat16: {
+      Numeric sum = 0.0;
+      Size n      = 0;
+      for (auto v : x) {
+        if (v > 0.0) {
+          sum += std::log(v);
+          n++;
+        }
+      }
+      log_offset = n == 0 ? 0.0 : sum / static_cast<Numeric>(n);
+
+      log16.resize(x.size());
+      std::transform(x.begin(), x.end(), log16.begin(), [this](Numeric v) {
+        return v > 0.0
+                   ? float_to_half(static_cast<float>(std::log(v) - log_offset))
+                   : half_minus_inf;
+      });
+    } break;
+    case LookupTableStorage::ScaledInt16:
+      log16.resize(x.size());
+      log_scale.resize(npf);
+      for (Index ipf = 0; ipf < npf; ipf++) {
+        Numeric lo = std::numeric_limits<Numeric>::infinity();
+        Numeric hi = -lo;
+        for (Index itw = 0; itw < ntw; itw++) {
+          const Numeric v = x[itw * npf + ipf];
+          if (v > 0.0) {
+            lo = std::min(lo, std::log(v));
+            hi = std::max(hi, std::log(v));
+          }
+        }
+
+        if (lo > hi) {
+          log_scale[ipf] = {0.0F, 0.0F};
+        } else {
+          log_scale[ipf] = {static_cast<float>(lo),
+                            static_cast<float>((hi - lo) / (max_code - 1))};
+        }
+
+        const auto [off, step] = log_scale[ipf];
+        for (Index itw = 0; itw < ntw; itw++) {
+          const Numeric v = x[itw * npf + ipf];
+          std::uint16_t c = zero_code;
+          if (v > 0.0) {
+            const Numeric q =
+                step > 0.0F ? std::round((std::log(v) - off) / step) : 0.0;
+            c = static_cast<std::uint16_t>(
+                1 + std::clamp<Numeric>(q, 0.0, max_code - 1));
+          }
+          log16[itw * npf + ipf] = c;
+        }
+      }
+      break;
+  }
+}
+
+bool compressed_xsec::empty() const {
+  return type == LookupTableStorage::Double;
+}
+
+void compressed_xsec::decode(std::span<Numeric> out,
+                             Index it,
+                             Index iw,
+                             Index ip,
+                             Index f0) const {
+  const Index nf = shape[3];
+  const Size i0  = ((it * shape[1] + iw) * shape[2] + ip) * nf + f0;
+
+  switch (type) {
+    case LookupTableStorage::Double:
+      ARTS_USER_ERROR("No reduced precision cross sections to decode")
+    case LookupTableStorage::LogFloat32:
+      for (Size i = 0; i < out.size(); i++) {
+        out[i] = std::exp(static_cast<Numeric>(log32[i0 + i]));
+      }
+      break;
+    case LookupTableStorage::LogFloat16:
+      for (Size i = 0; i < out.size(); i++) {
+        out[i] = std::exp(log_offset + half_to_float(log16[i0 + i]));
+      }
+      break;
+    case LookupTableStorage::ScaledInt16: {
+      const Size s0 = ip * nf + f0;
+      for (Size i = 0; i < out.size(); i++) {
+        const std::uint16_t c  = log16[i0 + i];
+        const auto [off, step] = log_scale[s0 + i];
+        out[i] = c == zero_code ? 0.0 : std::exp(off + (c - 1) * Numeric{step});
+      }
+    } break;
+  }
+}
+
+Tensor4 compressed_xsec::decode() const {
+  Tensor4 out(shape);
+  for (Index it = 0; it < shape[0]; it++) {
+    for (Index iw = 0; iw < shape[1]; iw++) {
+      for (Index ip = 0; ip < shape[2]; ip++) {
+        decode(std::span{&out[it, iw, ip, 0], static_cast<Size>(shape[3])},
+               it,
+               iw,
+               ip,
+               0);
+      }
+    }
+  }
+  return out;
+}
+
+Size compressed_xsec::nbytes() const {
+  return log32.size() * sizeof(float) +
+         log16.size() * sizeof(std::uint16_t) +
+         log_scale.size() * sizeof(std::array<float, 2>);
+}
+}  // namespace lookup
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <enumsLookupTableStorage.h>
+#include <matpack.h>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace lookup {
+/*! Cross sections stored with reduced precision
+
+  Keeps the same [t, w, p, f] row-major layout as table::xsec, but each value
+  is stored as its natural logarithm in one of the reduced formats of
+  LookupTableStorage.  Zero cross sections are represented exactly.
+
+  Values are decoded a frequency row at a time, so that interpolation only
+  ever touches the decoded rows it needs.
+*/
+struct compressed_xsec {
+  //! The storage mode, Double means that nothing is stored
+  LookupTableStorage type{LookupTableStorage::Double};
+
+  //! The shape of the encoded cross sections
+  std::array<Index, 4> shape{0, 0, 0, 0};
+
+  //! The encoded values for LogFloat32
+  std::vector<float> log32;
+
+  //! The encoded values for LogFloat16 and ScaledInt16
+  std::vector<std::uint16_t> log16;
+
+  //! The offset of the LogFloat16 values
+  Numeric log_offset{0.0};
+
+  //! Pairs of offset and step for each [p, f] for ScaledInt16
+  std::vector<std::array<float, 2>> log_scale;
+
+  compressed_xsec() = default;
+
+  /** Encode cross sections
+
+    @param[in] type The storage mode, must not be Double
+    @param[in] xsec The non-negative cross sections
+  */
+  compressed_xsec(LookupTableStorage type, const ConstTensor4View& xsec);
+
+  //! Whether or not any cross sections are stored
+  [[nodiscard]] bool empty() const;
+
+  /** Decode consecutive frequencies of a single row
+
+    @param[out] out The decoded cross sections, out.size() frequencies
+    @param[in] it The temperature perturbation index
+    @param[in] iw The water perturbation index
+    @param[in] ip The pressure index
+    @param[in] f0 The first frequency index
+  */
+  void decode(std::span<Numeric> out,
+              Index it,
+              Index iw,
+              Index ip,
+              Index f0) const;
+
+  //! Decode all cross sections
+  [[nodiscard]] Tensor4 decode() const;
+
+  //! The memory used by the encoded data in bytes
+  [[nodiscard]] Size nbytes() const;
+};
+}  // namespace lookup
@@ -4,6 +4,8 @@
 #include <jacobian.h>
 #include <lagrange_interp.h>
 
+#include <algorithm>
+
 namespace lookup {
 table::table()                            = default;
 table::table(const table&)                = default;
@@ -39,18 +41,84 @@ std::array<Index, 4> table::grid_shape() const {
   return {t_size(), w_size(), p_size(), f_size()};
 }
 
+bool table::is_mapped() const { return static_cast<bool>(xsec_mapped); }
+
+ConstTensor4View table::xsec_data() const {
+  if (is_mapped()) {
+    return ConstTensor4View{
+        matpack::mdview_t<const Numeric, 4>{xsec_mapped.get(), grid_shape()}};
+  }
+
+  return xsec;
+}
+
+bool table::is_compressed() const { return not xsec_compressed.empty(); }
+
+LookupTableStorage table::storage() const { return xsec_compressed.type; }
+
+Tensor4 table::xsec_decoded() const {
+  if (is_compressed()) return xsec_compressed.decode();
+  return Tensor4{xsec_data()};
+}
+
+void table::compress(LookupTableStorage storage_) try {
+  if (storage_ == storage()) return;
+
+  if (storage_ == LookupTableStorage::Double) {
+    xsec            = xsec_compressed.decode();
+    xsec_compressed = {};
+    return;
+  }
+
+  if (is_compressed()) compress(LookupTableStorage::Double);
+
+  xsec_compressed = compressed_xsec{storage_, xsec_data()};
+  xsec            = Tensor4{};
+  xsec_mapped.reset();
+}
+ARTS_METHOD_ERROR_CATCH
+
 table::table(const SpeciesEnum& species,
              const ArrayOfAtmPoint& atmref,
              std::shared_ptr<const AscendingGrid> f_grid_,
              const AbsorptionBands& abs_bands,
              const LinemixingEcsData& abs_ecs_data,
              std::shared_ptr<const AscendingGrid> t_pert_,
-             std::shared_ptr<const AscendingGrid> w_pert_) try
-    : f_grid(std::move(f_grid_)),
-      t_pert(std::move(t_pert_)),
-      w_pert(std::move(w_pert_)),
-      water_atmref(atmref.size()),
-      t_atmref(atmref.size()) {
+             std::shared_ptr<const AscendingGrid> w_pert_,
+             const Size f_block_size) try {
+  set_grids(atmref, std::move(f_grid_), std::move(t_pert_), std::move(w_pert_));
+
+  xsec.resize(grid_shape());
+
+  const Size nf = f_grid->size();
+  const Size nb = f_block_size == 0 ? nf : std::min(f_block_size, nf);
+  if (nb == nf) {
+    compute_block(xsec, Range(0, nf), species, atmref, abs_bands, abs_ecs_data);
+    return;
+  }
+
+  Tensor4 xsec_block;
+  for (Size f0 = 0; f0 < nf; f0 += nb) {
+    const Range f_range(f0, std::min(nb, nf - f0));
+    xsec_block.resize(t_size(), w_size(), p_size(), f_range.nelem);
+    compute_block(
+        xsec_block, f_range, species, atmref, abs_bands, abs_ecs_data);
+    xsec[joker, joker, joker, f_range] = xsec_block;
+  }
+}
+ARTS_METHOD_ERROR_CATCH
+
+void table::set_grids(const ArrayOfAtmPoint& atmref,
+                      std::shared_ptr<const AscendingGrid> f_grid_,
+                      std::shared_ptr<const AscendingGrid> t_pert_,
+                      std::shared_ptr<const AscendingGrid> w_pert_) {
+  f_grid = std::move(f_grid_);
+  t_pert = std::move(t_pert_);
+  w_pert = std::move(w_pert_);
+  xsec   = Tensor4{};
+  xsec_mapped.reset();
+  xsec_compressed = {};
+
   ARTS_USER_ERROR_IF(not do_f(), "Frequency grid is not set.")
 
   const bool do_water = do_w();
@@ -60,24 +128,47 @@ table::table(const SpeciesEnum& species,
         return std::log(x.pressure);
       });
 
-  xsec.resize(grid_shape());
-
+  water_atmref.resize(atmref.size());
   std::transform(
       atmref.begin(),
       atmref.end(),
       water_atmref.begin(),
       [do_water](const auto& x) { return do_water ? x["H2O"_spec] : NAN; });
 
+  t_atmref.resize(atmref.size());
   std::transform(
       atmref.begin(), atmref.end(), t_atmref.begin(), [](const auto& x) {
         return x.temperature;
       });
+}
+
+void table::compute_block(Tensor4View xsec_block,
+                          const Range& f_range,
+                          const SpeciesEnum& species,
+                          const ArrayOfAtmPoint& atmref,
+                          const AbsorptionBands& abs_bands,
+                          const LinemixingEcsData& abs_ecs_data) const try {
+  const Size nf = f_range.nelem;
+
+  ARTS_USER_ERROR_IF(atmref.size() != static_cast<Size>(p_size()),
+                     "Reference atmosphere has {} levels, expected {}",
+                     atmref.size(),
+                     p_size())
+  ARTS_USER_ERROR_IF(
+      (xsec_block.shape() !=
+       std::array{t_size(), w_size(), p_size(), f_range.nelem}),
+      "Bad shape of the cross section block: {:B,}",
+      xsec_block.shape())
+
+  const bool do_water = do_w();
+
+  const ConstVectorView f_block = f_grid->vec()[f_range];
 
   String error;
-  PropmatVector pm(f_grid->size());
-  StokvecVector sv(f_grid->size());
-  PropmatMatrix dpm(0, f_grid->size());
-  StokvecMatrix dsv(0, f_grid->size());
+  PropmatVector pm(nf);
+  StokvecVector sv(nf);
+  PropmatMatrix dpm(0, nf);
+  StokvecMatrix dsv(0, nf);
   const JacobianTargets jac_targets = {};
   const Vector2 los                 = {180, 0};
   const bool no_negative_absorption = true;
@@ -87,6 +178,8 @@ table::table(const SpeciesEnum& species,
   const AscendingGrid& water_vmr_local(do_water ? *w_pert : empty_water);
   const AscendingGrid& t_pert_local(do_t() ? *t_pert : empty_t_pert);
 
+  const lbl::frequency_index bands_index(abs_bands, species);
+
 #pragma omp parallel for collapse(3) if (not arts_omp_in_parallel()) \
     firstprivate(pm, sv, dpm, dsv)
   for (Size it = 0; it < t_pert_local.size(); ++it) {
@@ -102,19 +195,19 @@ table::table(const SpeciesEnum& species,
                          sv,
                          dpm,
                          dsv,
-                         *f_grid,
-                         Range(0, f_grid->size()),
+                         f_block,
+                         Range(0, nf),
                          jac_targets,
                          species,
-                         abs_bands,
+                         bands_index,
                          abs_ecs_data,
                          atm_point,
                          los,
                          no_negative_absorption);
 
           const Numeric inv_nd = 1.0 / atm_point.number_density(species);
-          for (Size ifreq = 0; ifreq < f_grid->size(); ++ifreq) {
-            xsec[it, iw, ip, ifreq] = pm[ifreq].A() * inv_nd;
+          for (Size ifreq = 0; ifreq < nf; ++ifreq) {
+            xsec_block[it, iw, ip, ifreq] = pm[ifreq].A() * inv_nd;
           }
         } catch (std::runtime_error& e) {
 #pragma omp critical
@@ -198,7 +291,22 @@ void table::absorption(VectorView absorption,
                        const Numeric& extpolfac) const try {
   check();
 
-  if (xsec.empty()) return;
+  // Reduced precision tables are only ever decoded by the path kernel
+  if (is_compressed()) {
+    this->absorption(absorption.view_as(1, absorption.size()),
+                     species,
+                     p_interp_order,
+                     t_interp_order,
+                     water_interp_order,
+                     f_interp_order,
+                     std::span<const AtmPoint>{&atm_point, 1},
+                     freq_grid,
+                     extpolfac);
+    return;
+  }
+
+  const ConstTensor4View xsec_view = xsec_data();
+  if (xsec_view.empty()) return;
 
   // Frequency grid positions
   const auto flag = frequency_lagrange(freq_grid, f_interp_order, extpolfac);
@@ -216,18 +324,21 @@ void table::absorption(VectorView absorption,
     const auto tlag = temperature_lagrange(
         atm_point.temperature, plag, t_interp_order, extpolfac);
     xsec_local =
-        reinterp(xsec, tlag, wlag, plag, flag).reshape(freq_grid.size());
+        reinterp(xsec_view, tlag, wlag, plag, flag).reshape(freq_grid.size());
   } else if (do_w()) {
     const auto wlag = water_lagrange(
         atm_point["H2O"_spec], plag, water_interp_order, extpolfac);
-    xsec_local = reinterp(xsec[0], wlag, plag, flag).reshape(freq_grid.size());
+    xsec_local =
+        reinterp(xsec_view[0], wlag, plag, flag).reshape(freq_grid.size());
   } else if (do_t()) {
     const auto tlag = temperature_lagrange(
         atm_point.temperature, plag, t_interp_order, extpolfac);
-    xsec_local = reinterp(xsec[joker, 0, joker, joker], tlag, plag, flag)
-                     .reshape(freq_grid.size());
+    xsec_local =
+        reinterp(xsec_view[joker, 0, joker, joker], tlag, plag, flag)
+            .reshape(freq_grid.size());
   } else {
-    xsec_local = reinterp(xsec[0][0], plag, flag).reshape(freq_grid.size());
+    xsec_local =
+        reinterp(xsec_view[0][0], plag, flag).reshape(freq_grid.size());
   }
 
   const Numeric nd = atm_point.number_density(species);
@@ -237,6 +348,197 @@ void table::absorption(VectorView absorption,
 }
 ARTS_METHOD_ERROR_CATCH
 
+namespace {
+/*! Flat interpolation weights, all lags padded to the same size
+
+  The padding repeats the last index with zero weight, so that the indices
+  of each lag stay within the range that the lag touches.
+*/
+struct flat_lags {
+  Size n{0};
+  std::vector<Index> indx;
+  std::vector<Numeric> data;
+
+  explicit flat_lags(const std::vector<lagrange_interp::lag_t<-1>>& lags) {
+    for (auto& lag : lags) n = std::max<Size>(n, lag.size());
+
+    indx.resize(lags.size() * n, 0);
+    data.resize(lags.size() * n, 0.0);
+    for (Size i = 0; i < lags.size(); i++) {
+      const auto last = stdr::copy(lags[i].indx, indx.begin() + i * n).out;
+      std::fill(last, indx.begin() + (i + 1) * n, lags[i].indx.back());
+      stdr::copy(lags[i].data, data.begin() + i * n);
+    }
+  }
+};
+
+std::span<const Index> lag_indx(const auto& lag, bool active) {
+  static constexpr std::array<Index, 1> zero{0};
+  return active ? std::span<const Index>{lag.indx} : zero;
+}
+
+std::span<const Numeric> lag_data(const auto& lag, bool active) {
+  static constexpr std::array<Numeric, 1> one{1.0};
+  return active ? std::span<const Numeric>{lag.data} : one;
+}
+}  // namespace
+
+void table::absorption(MatrixView absorption,
+                       const SpeciesEnum& species,
+                       const Index& p_interp_order,
+                       const Index& t_interp_order,
+                       const Index& water_interp_order,
+                       const Index& f_interp_order,
+                       std::span<const AtmPoint> atm_path,
+                       const AscendingGrid& freq_grid,
+                       const Numeric& extpolfac) const try {
+  check();
+
+  const Size np = atm_path.size();
+  const Size nf = freq_grid.size();
+
+  ARTS_USER_ERROR_IF(
+      static_cast<Size>(absorption.nrows()) != np or
+          static_cast<Size>(absorption.ncols()) != nf,
+      "Bad shape of absorption {:B,}, expected [{}, {}] (path x frequency)",
+      absorption.shape(),
+      np,
+      nf)
+
+  const bool compressed            = is_compressed();
+  const ConstTensor4View xsec_view = xsec_data();
+  if ((xsec_view.empty() and not compressed) or np == 0 or nf == 0) return;
+
+  // Frequency grid positions, shared by all points
+  const flat_lags flag(
+      frequency_lagrange(freq_grid, f_interp_order, extpolfac));
+
+  // Grid positions of all the points
+  const bool do_water = do_w();
+  const bool do_temp  = do_t();
+  std::vector<std::array<lagrange_interp::lag_t<-1>, 1>> plags(np);
+  std::vector<std::array<lagrange_interp::lag_t<-1>, 1>> wlags(np);
+  std::vector<std::array<lagrange_interp::lag_t<-1>, 1>> tlags(np);
+  for (Size ip = 0; ip < np; ip++) {
+    const AtmPoint& atm_point = atm_path[ip];
+
+    plags[ip] =
+        pressure_lagrange(atm_point.pressure, p_interp_order, extpolfac);
+
+    if (do_water) {
+      wlags[ip] = water_lagrange(
+          atm_point["H2O"_spec], plags[ip], water_interp_order, extpolfac);
+    }
+
+    if (do_temp) {
+      tlags[ip] = temperature_lagrange(
+          atm_point.temperature, plags[ip], t_interp_order, extpolfac);
+    }
+  }
+
+  // Only the pressure levels touched by the path are interpolated in frequency
+  std::vector<Index> p_used;
+  for (auto& plag : plags) {
+    stdr::copy(plag[0].indx, std::back_inserter(p_used));
+  }
+  stdr::sort(p_used);
+  p_used.erase(std::unique(p_used.begin(), p_used.end()), p_used.end());
+
+  std::vector<Index> p_pos(p_size(), -1);
+  for (Size iu = 0; iu < p_used.size(); iu++) p_pos[p_used[iu]] = iu;
+
+  const Index nt = t_size();
+  const Index nw = w_size();
+  const Index nu = static_cast<Index>(p_used.size());
+
+  // Combined atmospheric weights per point, indexing [t, w, p_used] rows
+  std::vector<Size> offset(np + 1, 0);
+  std::vector<Index> row;
+  std::vector<Numeric> weight;
+  Vector nd(np);
+  for (Size ip = 0; ip < np; ip++) {
+    const auto ti = lag_indx(tlags[ip][0], do_temp);
+    const auto td = lag_data(tlags[ip][0], do_temp);
+    const auto wi = lag_indx(wlags[ip][0], do_water);
+    const auto wd = lag_data(wlags[ip][0], do_water);
+    const auto pi = lag_indx(plags[ip][0], true);
+    const auto pd = lag_data(plags[ip][0], true);
+
+    for (Size it = 0; it < ti.size(); it++) {
+      for (Size iw = 0; iw < wi.size(); iw++) {
+        for (Size ipp = 0; ipp < pi.size(); ipp++) {
+          row.push_back((ti[it] * nw + wi[iw]) * nu + p_pos[pi[ipp]]);
+          weight.push_back(td[it] * wd[iw] * pd[ipp]);
+        }
+      }
+    }
+
+    offset[ip + 1] = row.size();
+    nd[ip]         = atm_path[ip].number_density(species);
+  }
+
+  // Work over blocks of frequencies so that the reduced table stays in cache
+  constexpr Size block = 256;
+  const Size nblocks   = (nf + block - 1) / block;
+  const Size nfw       = flag.n;
+
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Size ib = 0; ib < nblocks; ib++) {
+    const Size f0 = ib * block;
+    const Size nb = std::min(block, nf - f0);
+
+    // Table frequencies touched by this block
+    const auto [fmin, fmax] =
+        std::minmax_element(flag.indx.begin() + f0 * nfw,
+                            flag.indx.begin() + (f0 + nb) * nfw);
+    const Index lo = *fmin;
+    std::vector<Numeric> decoded(compressed ? *fmax - lo + 1 : 0);
+
+    // Frequency interpolation of the pressure levels in use
+    Matrix fx(nt * nw * nu, nb);
+    for (Index it = 0; it < nt; it++) {
+      for (Index iw = 0; iw < nw; iw++) {
+        for (Index iu = 0; iu < nu; iu++) {
+          const Numeric* x = nullptr;
+          if (compressed) {
+            xsec_compressed.decode(decoded, it, iw, p_used[iu], lo);
+            x = decoded.data();
+          } else {
+            x = &xsec_view[it, iw, p_used[iu], lo];
+          }
+          Numeric* y = &fx[(it * nw + iw) * nu + iu, 0];
+
+          for (Size i = 0; i < nb; i++) {
+            const Index* fi   = flag.indx.data() + (f0 + i) * nfw;
+            const Numeric* fd = flag.data.data() + (f0 + i) * nfw;
+
+            Numeric sum = 0.0;
+            for (Size k = 0; k < nfw; k++) sum += fd[k] * x[fi[k] - lo];
+            y[i] = sum;
+          }
+        }
+      }
+    }
+
+    // Weighted sum over contiguous rows of the reduced table
+    std::vector<Numeric> local(nb);
+    for (Size ip = 0; ip < np; ip++) {
+      stdr::fill(local, 0.0);
+
+      for (Size j = offset[ip]; j < offset[ip + 1]; j++) {
+        const Numeric* y = &fx[row[j], 0];
+        const Numeric w  = weight[j];
+        for (Size i = 0; i < nb; i++) local[i] += w * y[i];
+      }
+
+      for (Size i = 0; i < nb; i++) {
+        absorption[ip, f0 + i] += nd[ip] * local[i];
+      }
+    }
+  }
+}
+ARTS_METHOD_ERROR_CATCH
+
 void table::check() const {
   ARTS_USER_ERROR_IF(not do_f() or not do_p(),
                      R"(Must have frequency and pressure grids.
@@ -247,8 +549,10 @@ void table::check() const {
                      do_p());
 
   const auto [t_size, w_size, p_size, f_size] = grid_shape();
+  const std::array<Index, 4> xsec_shape =
+      is_compressed() ? xsec_compressed.shape : xsec_data().shape();
   ARTS_USER_ERROR_IF(
-      (xsec.shape() != std::array{t_size, w_size, p_size, f_size}),
+      (xsec_shape != std::array{t_size, w_size, p_size, f_size}),
       R"(The shape of the absorption cross section table is incorrect.
 
   Found:    {4:B,},
@@ -263,7 +567,7 @@ void table::check() const {
       w_size,
       p_size,
       f_size,
-      xsec.shape());
+      xsec_shape);
 
   ARTS_USER_ERROR_IF(water_atmref.size() != static_cast<Size>(p_size),
                      R"(Bad size of water_atmref
@@ -310,7 +614,10 @@ void xml_io_stream<AbsorptionLookupTable>::write(std::ostream& os,
                                                  const AbsorptionLookupTable& x,
                                                  bofstream* pbofs,
                                                  std::string_view name) {
-  XMLTag tag(type_name, "name", name);
+  // The cross sections are stored decoded, the storage mode is re-applied
+  // when read back
+  XMLTag tag(
+      type_name, "name", name, "storage", String{toString(x.storage())});
   tag.write_to_stream(os);
 
   xml_write_to_stream(os, x.f_grid, pbofs, "frequency"sv);
@@ -319,7 +626,11 @@ void xml_io_stream<AbsorptionLookupTable>::write(std::ostream& os,
   xml_write_to_stream(os, x.w_pert, pbofs, "water-pert"sv);
   xml_write_to_stream(os, x.water_atmref, pbofs, "water-ref"sv);
   xml_write_to_stream(os, x.t_atmref, pbofs, "t-ref"sv);
-  xml_write_to_stream(os, x.xsec, pbofs, "xsec");
+  if (x.is_mapped() or x.is_compressed()) {
+    xml_write_to_stream(os, x.xsec_decoded(), pbofs, "xsec");
+  } else {
+    xml_write_to_stream(os, x.xsec, pbofs, "xsec");
+  }
 
   tag.write_to_end_stream(os);
 }
@@ -331,6 +642,9 @@ void xml_io_stream<AbsorptionLookupTable>::read(std::istream& is,
   tag.read_from_stream(is);
   tag.check_name(type_name);
 
+  String storage;
+  tag.get_attribute_value("storage", storage, "Double");
+
   xml_read_from_stream(is, x.f_grid, pbifs);
   xml_read_from_stream(is, x.log_p_grid, pbifs);
   xml_read_from_stream(is, x.t_pert, pbifs);
@@ -338,9 +652,12 @@ void xml_io_stream<AbsorptionLookupTable>::read(std::istream& is,
   xml_read_from_stream(is, x.water_atmref, pbifs);
   xml_read_from_stream(is, x.t_atmref, pbifs);
   xml_read_from_stream(is, x.xsec, pbifs);
+  x.xsec_mapped     = nullptr;
+  x.xsec_compressed = {};
 
   tag.read_from_stream(is);
   tag.check_end_name(type_name);
 
   x.check();
+  x.compress(to<LookupTableStorage>(storage));
 }
@@ -7,8 +7,11 @@
 #include <matpack.h>
 #include <xml.h>
 
+#include <span>
 #include <unordered_map>
 
+#include "lookup_compressed.h"
+
 namespace lookup {
 struct table {
   //! The frequency grid in Hz
@@ -30,22 +33,72 @@ struct table {
   /*! The absorption cross section table
 
       Dimensions: t_pert.size() x w_pert.size() x log_p_grid -> size() x f_grid -> size()
+
+      Empty if the table is backed by a memory-mapped file, see xsec_data(),
+      or if the table is compressed, see xsec_compressed
   */
   Tensor4 xsec;
 
+  /*! Read-only cross section data living in a memory-mapped file
+
+      The pointer keeps the mapping alive.  Shares the layout of xsec.
+      Set by read_mapped(), nullptr for tables that own their data.
+  */
+  std::shared_ptr<const Numeric> xsec_mapped;
+
+  /*! Reduced precision cross sections
+
+      Used instead of xsec if not empty, see compress().
+  */
+  compressed_xsec xsec_compressed;
+
   table();
   table(const table&);
   table(table&&) noexcept;
   table& operator=(const table&);
   table& operator=(table&&) noexcept;
 
+  /** Compute the table
+
+    The cross sections are computed in blocks of f_block_size frequencies,
+    so that the line-by-line temporaries of each thread are bounded by the
+    block size rather than by the frequency grid.  Zero means a single block.
+  */
   table(const SpeciesEnum& species,
         const ArrayOfAtmPoint& atmref,
         std::shared_ptr<const AscendingGrid> f_grid,
         const AbsorptionBands& abs_bands,
         const LinemixingEcsData& abs_ecs_data,
         std::shared_ptr<const AscendingGrid> t_pert = nullptr,
-        std::shared_ptr<const AscendingGrid> w_pert = nullptr);
+        std::shared_ptr<const AscendingGrid> w_pert = nullptr,
+        const Size f_block_size                     = 0);
+
+  /** Set all grids and reference values but leave xsec empty
+
+    Use compute_block() to compute the cross sections.
+  */
+  void set_grids(const ArrayOfAtmPoint& atmref,
+                 std::shared_ptr<const AscendingGrid> f_grid,
+                 std::shared_ptr<const AscendingGrid> t_pert,
+                 std::shared_ptr<const AscendingGrid> w_pert);
+
+  /** Compute the cross sections for a block of frequencies
+
+    Requires that the grids are set up for the same atmref.
+
+    @param[out] xsec_block Size t_size() x w_size() x p_size() x f_range.nelem
+    @param[in] f_range The frequency range in f_grid
+    @param[in] species The species
+    @param[in] atmref The reference atmosphere
+    @param[in] abs_bands The line-by-line data
+    @param[in] abs_ecs_data The line mixing data
+  */
+  void compute_block(Tensor4View xsec_block,
+                     const Range& f_range,
+                     const SpeciesEnum& species,
+                     const ArrayOfAtmPoint& atmref,
+                     const AbsorptionBands& abs_bands,
+                     const LinemixingEcsData& abs_ecs_data) const;
 
   void absorption(VectorView absorption,
                   const SpeciesEnum& species,
@@ -57,6 +110,35 @@ struct table {
                   const AscendingGrid& freq_grid,
                   const Numeric& extpolfac) const;
 
+  /** Add the absorption of a species along a whole path
+
+    Same as the single point absorption() but for all points of a path
+    sharing a single frequency grid.  The frequency interpolation weights
+    are computed once and the table is interpolated in frequency once per
+    pressure level touched by the path.  The remaining temperature, water,
+    and pressure interpolation is a dense weighted sum over contiguous
+    frequency blocks.
+
+    @param[inout] absorption The absorption, size atm_path.size() x freq_grid.size()
+    @param[in] species The species of the table
+    @param[in] p_interp_order Interpolation order for pressure
+    @param[in] t_interp_order Interpolation order for temperature
+    @param[in] water_interp_order Interpolation order for water
+    @param[in] f_interp_order Interpolation order for frequency
+    @param[in] atm_path The atmospheric points
+    @param[in] freq_grid The frequency grid, shared by all points
+    @param[in] extpolfac The extrapolation factor
+  */
+  void absorption(MatrixView absorption,
+                  const SpeciesEnum& species,
+                  const Index& p_interp_order,
+                  const Index& t_interp_order,
+                  const Index& water_interp_order,
+                  const Index& f_interp_order,
+                  std::span<const AtmPoint> atm_path,
+                  const AscendingGrid& freq_grid,
+                  const Numeric& extpolfac) const;
+
   [[nodiscard]] bool do_t() const;
   [[nodiscard]] bool do_w() const;
   [[nodiscard]] bool do_p() const;
@@ -70,6 +152,32 @@ struct table {
   [[nodiscard]] std::array<Index, 4> grid_shape() const;
   void check() const;
 
+  //! Whether or not the cross sections are viewing a memory-mapped file
+  [[nodiscard]] bool is_mapped() const;
+
+  //! The cross sections, regardless of whether they are owned or mapped
+  [[nodiscard]] ConstTensor4View xsec_data() const;
+
+  //! Whether or not the cross sections are stored with reduced precision
+  [[nodiscard]] bool is_compressed() const;
+
+  //! The storage mode of the cross sections
+  [[nodiscard]] LookupTableStorage storage() const;
+
+  //! A copy of the cross sections in double precision, for any storage mode
+  [[nodiscard]] Tensor4 xsec_decoded() const;
+
+  /** Change how the cross sections are stored
+
+    Reduced precision modes encode the current cross sections into
+    xsec_compressed and release xsec and any mapped file.  Double decodes
+    compressed cross sections back into xsec.  Re-encoding from one
+    reduced mode to another goes via double precision.
+
+    @param[in] storage The new storage mode
+  */
+  void compress(LookupTableStorage storage);
+
   [[nodiscard]] std::array<lagrange_interp::lag_t<-1>, 1> pressure_lagrange(
       const Numeric& pressure,
       const Index interpolation_order,
@@ -143,7 +251,7 @@ struct std::formatter<AbsorptionLookupTable> {
                        "\nt_atmref: "sv,
                        v.t_atmref,
                        "\nxsec:\n"sv,
-                       v.xsec);
+                       v.xsec_decoded());
   }
 };
 
@@ -0,0 +1,578 @@
+#include "lookup_mapped.h"
+
+#include <lbl_hash.h>
+
+#include <boost/container_hash/hash.hpp>
+#include <bit>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ARTS_LOOKUP_HAS_MMAP 1
+#else
+#define ARTS_LOOKUP_HAS_MMAP 0
+#endif
+
+namespace lookup {
+namespace {
+//! Grid payloads are only aligned for vectorized access
+constexpr std::uint64_t grid_alignment = 64;
+
+constexpr std::uint64_t align_up(std::uint64_t x, std::uint64_t a) {
+  return (x + a - 1) / a * a;
+}
+
+/*! Owns a read-only view of a whole file
+
+  Uses mmap where available.  Falls back to reading the file into memory
+  otherwise, in which case there is no sharing between processes.
+*/
+class file_map {
+  const std::byte* ptr{nullptr};
+  Size n{0};
+#if not ARTS_LOOKUP_HAS_MMAP
+  std::vector<std::byte> buffer;
+#endif
+
+ public:
+  explicit file_map(const String& filename) {
+#if ARTS_LOOKUP_HAS_MMAP
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    ARTS_USER_ERROR_IF(fd < 0, "Cannot open file \"{}\"", filename)
+
+    struct stat st {};
+    if (::fstat(fd, &st) != 0) {
+      ::close(fd);
+      ARTS_USER_ERROR("Cannot stat file \"{}\"", filename)
+    }
+
+    n = static_cast<Size>(st.st_size);
+    if (n > 0) {
+      void* addr = ::mmap(nullptr, n, PROT_READ, MAP_SHARED, fd, 0);
+      ::close(fd);
+      ARTS_USER_ERROR_IF(
+          addr == MAP_FAILED, "Cannot memory-map file \"{}\"", filename)
+      ptr = static_cast<const std::byte*>(addr);
+    } else {
+      ::close(fd);
+    }
+#else
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    ARTS_USER_ERROR_IF(not file, "Cannot open file \"{}\"", filename)
+    n = static_cast<Size>(file.tellg());
+    buffer.resize(n);
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(buffer.data()), n);
+    ARTS_USER_ERROR_IF(not file, "Cannot read file \"{}\"", filename)
+    ptr = buffer.data();
+#endif
+  }
+
+  file_map(const file_map&)            = delete;
+  file_map(file_map&&)                 = delete;
+  file_map& operator=(const file_map&) = delete;
+  file_map& operator=(file_map&&)      = delete;
+
+  ~file_map() {
+#if ARTS_LOOKUP_HAS_MMAP
+    if (ptr) ::munmap(const_cast<std::byte*>(ptr), n);
+#endif
+  }
+
+  [[nodiscard]] const std::byte* data() const { return ptr; }
+  [[nodiscard]] Size size() const { return n; }
+};
+
+std::span<const Numeric> field_data(const table& t, mapped::field f) {
+  const auto grid = [](const auto& g) -> std::span<const Numeric> {
+    if (not g) return {};
+    const Vector& v = g->vec();
+    return {v.data_handle(), v.size()};
+  };
+
+  switch (f) {
+    case mapped::field::f_grid:       return grid(t.f_grid);
+    case mapped::field::log_p_grid:   return grid(t.log_p_grid);
+    case mapped::field::t_pert:       return grid(t.t_pert);
+    case mapped::field::w_pert:       return grid(t.w_pert);
+    case mapped::field::water_atmref:
+      return {t.water_atmref.data_handle(), t.water_atmref.size()};
+    case mapped::field::t_atmref:
+      return {t.t_atmref.data_handle(), t.t_atmref.size()};
+    case mapped::field::xsec: {
+      const ConstTensor4View x = t.xsec_data();
+      return {x.data_handle(), static_cast<Size>(x.size())};
+    }
+    case mapped::field::count: break;
+  }
+
+  std::unreachable();
+}
+
+Vector copy_vector(const std::byte* base,
+                   const mapped::table_entry& entry,
+                   mapped::field f) {
+  const auto i = static_cast<Size>(f);
+  Vector out(entry.size[i]);
+  if (entry.size[i] > 0) {
+    std::memcpy(out.data_handle(),
+                base + entry.offset[i],
+                entry.size[i] * sizeof(Numeric));
+  }
+  return out;
+}
+
+/*! Whether nbytes from offset fit in a file of size n
+
+  Written so that corrupt offsets and sizes can not overflow.
+*/
+constexpr bool fits(std::uint64_t offset,
+                    std::uint64_t nbytes,
+                    std::uint64_t n) {
+  return offset <= n and nbytes <= n - offset;
+}
+
+/*! Name of a temporary file to write next to filename
+
+  Files are written to this first and then renamed over filename.  Tables
+  that have the old file mapped thus keep seeing the old data instead of a
+  truncated file, which would end in SIGBUS.
+*/
+String temporary_filename(const String& filename) {
+  return filename + ".tmp";
+}
+
+template <typename Grid>
+std::shared_ptr<const Grid> copy_grid(const std::byte* base,
+                                      const mapped::table_entry& entry,
+                                      mapped::field f) {
+  if (entry.size[static_cast<Size>(f)] == 0) return nullptr;
+  return std::make_shared<const Grid>(copy_vector(base, entry, f));
+}
+//! The full description of a file, everything but the cross sections
+struct layout {
+  mapped::file_header header;
+  std::vector<SpeciesEnum> species;
+  std::vector<mapped::table_entry> entries;
+  std::uint64_t file_size;
+};
+
+layout make_layout(const AbsorptionLookupTables& data) {
+  layout out;
+
+  // Sorted output so that files are reproducible
+  out.species.reserve(data.size());
+  for (auto& s : data | stdv::keys) out.species.push_back(s);
+  stdr::sort(out.species);
+
+  out.header = {.magic     = mapped::magic,
+                .version   = mapped::version,
+                .endian    = mapped::endian_marker,
+                .alignment = mapped::alignment,
+                .ntables   = out.species.size()};
+
+  out.entries.resize(out.species.size());
+  std::uint64_t pos = sizeof(mapped::file_header) +
+                      out.species.size() * sizeof(mapped::table_entry);
+  for (Size i = 0; i < out.species.size(); i++) {
+    const table& t = data.at(out.species[i]);
+    auto& entry    = out.entries[i];
+
+    entry.species.fill('\0');
+    const std::string_view name = toString<1>(out.species[i]);
+    ARTS_USER_ERROR_IF(name.size() >= entry.species.size(),
+                       "Species name too long: {}",
+                       name)
+    stdr::copy(name, entry.species.begin());
+
+    for (Size j = 0; j < mapped::nfields; j++) {
+      const auto f = static_cast<mapped::field>(j);
+      const bool x = f == mapped::field::xsec;
+
+      entry.size[j]    = x ? mdsize(t.grid_shape()) : field_data(t, f).size();
+      pos              = align_up(pos, x ? mapped::alignment : grid_alignment);
+      entry.offset[j]  = pos;
+      pos             += entry.size[j] * sizeof(Numeric);
+    }
+  }
+
+  out.file_size = pos;
+  return out;
+}
+
+/*! Write the header, the table of contents, and the grids
+
+  The cross sections are written only if with_xsec is true.  Otherwise
+  their space is reserved in the file, to be filled later.
+*/
+void write_layout(std::ostream& file,
+                  const layout& lay,
+                  const AbsorptionLookupTables& data,
+                  const bool with_xsec) {
+  file.write(reinterpret_cast<const char*>(&lay.header), sizeof(lay.header));
+  file.write(reinterpret_cast<const char*>(lay.entries.data()),
+             lay.entries.size() * sizeof(mapped::table_entry));
+
+  for (Size i = 0; i < lay.species.size(); i++) {
+    const table& t = data.at(lay.species[i]);
+    for (Size j = 0; j < mapped::nfields; j++) {
+      const auto f = static_cast<mapped::field>(j);
+      if (f == mapped::field::xsec and not with_xsec) continue;
+
+      const auto values = field_data(t, f);
+      file.seekp(lay.entries[i].offset[j]);
+      file.write(reinterpret_cast<const char*>(values.data()),
+                 values.size() * sizeof(Numeric));
+    }
+  }
+
+  // Make sure the file has its full size, holes are zero-filled
+  if (lay.file_size > 0) {
+    file.seekp(lay.file_size - 1);
+    file.put('\0');
+  }
+}
+}  // namespace
+
+void write_mapped(const String& filename,
+                  const AbsorptionLookupTables& data) try {
+  ARTS_TIME_REPORT
+
+  for (auto&& [s, t] : data) {
+    t.check();
+    ARTS_USER_ERROR_IF(t.is_compressed(),
+                       "The table of {} is stored as {}, the mapped format "
+                       "requires double precision cross sections",
+                       s,
+                       t.storage())
+  }
+
+  const layout lay = make_layout(data);
+  const String tmp = temporary_filename(filename);
+
+  {
+    std::ofstream file(tmp, std::ios::binary | std::ios::trunc);
+    ARTS_USER_ERROR_IF(not file, "Cannot open file \"{}\" for writing", tmp)
+
+    write_layout(file, lay, data, true);
+
+    ARTS_USER_ERROR_IF(not file, "Error writing to file \"{}\"", tmp)
+  }
+
+  std::filesystem::rename(tmp, filename);
+}
+ARTS_METHOD_ERROR_CATCH
+
+AbsorptionLookupTables read_mapped(const String& filename) try {
+  ARTS_TIME_REPORT
+
+  const auto map = std::make_shared<const file_map>(filename);
+  const std::byte* base = map->data();
+
+  mapped::file_header header;
+  ARTS_USER_ERROR_IF(map->size() < sizeof(header),
+                     "File \"{}\" is too small to be a lookup table file",
+                     filename)
+  std::memcpy(&header, base, sizeof(header));
+
+  ARTS_USER_ERROR_IF(header.magic != mapped::magic,
+                     "File \"{}\" is not a binary lookup table file",
+                     filename)
+  ARTS_USER_ERROR_IF(header.version != mapped::version,
+                     "Unsupported binary lookup table version {}, expected {}",
+                     header.version,
+                     mapped::version)
+  ARTS_USER_ERROR_IF(header.endian != mapped::endian_marker,
+                     "File \"{}\" was written with a different endianness",
+                     filename)
+
+  ARTS_USER_ERROR_IF(header.ntables > (map->size() - sizeof(header)) /
+                                          sizeof(mapped::table_entry),
+                     "File \"{}\" is truncated (table of contents)",
+                     filename)
+
+  AbsorptionLookupTables out;
+  for (std::uint64_t i = 0; i < header.ntables; i++) {
+    mapped::table_entry entry;
+    std::memcpy(&entry,
+                base + sizeof(header) + i * sizeof(mapped::table_entry),
+                sizeof(entry));
+
+    for (Size j = 0; j < mapped::nfields; j++) {
+      ARTS_USER_ERROR_IF(
+          entry.offset[j] % alignof(Numeric) != 0 or
+              entry.size[j] > map->size() / sizeof(Numeric) or
+              not fits(entry.offset[j],
+                       entry.size[j] * sizeof(Numeric),
+                       map->size()),
+          "File \"{}\" is truncated or corrupt (table {}, field {})",
+          filename,
+          i,
+          j)
+    }
+
+    entry.species.back() = '\0';
+    const SpeciesEnum spec = to<SpeciesEnum>(String{entry.species.data()});
+
+    table t;
+    t.f_grid = copy_grid<AscendingGrid>(base, entry, mapped::field::f_grid);
+    t.log_p_grid =
+        copy_grid<DescendingGrid>(base, entry, mapped::field::log_p_grid);
+    t.t_pert = copy_grid<AscendingGrid>(base, entry, mapped::field::t_pert);
+    t.w_pert = copy_grid<AscendingGrid>(base, entry, mapped::field::w_pert);
+    t.water_atmref = copy_vector(base, entry, mapped::field::water_atmref);
+    t.t_atmref     = copy_vector(base, entry, mapped::field::t_atmref);
+
+    const auto ixsec = static_cast<Size>(mapped::field::xsec);
+    const auto shape = t.grid_shape();
+    ARTS_USER_ERROR_IF(
+        static_cast<std::uint64_t>(mdsize(shape)) != entry.size[ixsec],
+        "Cross section size {} does not match the grids {:B,} for {}",
+        entry.size[ixsec],
+        shape,
+        spec)
+
+    // Aliasing constructor: the table keeps the whole mapping alive
+    t.xsec_mapped = std::shared_ptr<const Numeric>(
+        map, reinterpret_cast<const Numeric*>(base + entry.offset[ixsec]));
+
+    t.check();
+    out[spec] = std::move(t);
+  }
+
+  return out;
+}
+ARTS_METHOD_ERROR_CATCH
+
+namespace {
+String progress_filename(const String& filename) {
+  return filename + ".progress";
+}
+
+//! The file that the blocks are written to until all of them are done
+String partial_filename(const String& filename) {
+  return filename + ".partial";
+}
+
+//! The hash of a map of an AtmPoint that does not depend on its order
+template <typename T>
+std::size_t point_values_hash(const Atm::PointValues<T>& map) {
+  std::size_t sum = map.size();
+  for (const auto& [k, v] : map) {
+    std::size_t seed = std::hash<T>{}(k);
+    boost::hash_combine(seed, std::bit_cast<std::uint64_t>(v));
+    sum += seed;
+  }
+  return sum;
+}
+
+/*! A hash of the inputs to the cross sections that are not in the file
+
+  The grids are stored in the file itself and are compared by
+  matches_layout(), these are the remaining inputs.
+*/
+std::size_t input_hash(const ArrayOfAtmPoint& atmref,
+                       const AbsorptionBands& abs_bands,
+                       const LinemixingEcsData& abs_ecs_data) {
+  std::size_t seed = lbl::content_hash(abs_bands);
+  boost::hash_combine(seed, lbl::content_hash(abs_ecs_data));
+
+  const auto combine = [&seed](Numeric x) {
+    boost::hash_combine(seed, std::bit_cast<std::uint64_t>(x));
+  };
+
+  for (auto& atm : atmref) {
+    combine(atm.pressure);
+    combine(atm.temperature);
+    for (auto x : atm.wind) combine(x);
+    for (auto x : atm.mag) combine(x);
+    boost::hash_combine(seed, point_values_hash(atm.specs));
+    boost::hash_combine(seed, point_values_hash(atm.isots));
+    boost::hash_combine(seed, point_values_hash(atm.nlte));
+  }
+
+  return seed;
+}
+
+//! Number of finished frequency blocks per species
+using progress_t = std::unordered_map<SpeciesEnum, Size>;
+
+/*! Atomically replace the progress file
+
+  The format is a line with the block size and the hash of the inputs,
+  see input_hash(), followed by one line per species with the number of
+  frequency blocks that have been written to the file.
+*/
+void save_progress(const String& filename,
+                   const Size f_block_size,
+                   const std::size_t hash,
+                   const progress_t& progress) {
+  const String fn  = progress_filename(filename);
+  const String tmp = fn + ".tmp";
+
+  {
+    std::ofstream file(tmp, std::ios::trunc);
+    ARTS_USER_ERROR_IF(not file, "Cannot open file \"{}\" for writing", tmp)
+
+    file << f_block_size << ' ' << hash << '\n';
+    for (auto& [s, n] : progress) file << toString<1>(s) << ' ' << n << '\n';
+
+    ARTS_USER_ERROR_IF(not file, "Error writing to file \"{}\"", tmp)
+  }
+
+  std::filesystem::rename(tmp, fn);
+}
+
+/*! Returns the progress if there is any for this block size and these
+  inputs, otherwise empty
+*/
+progress_t load_progress(const String& filename,
+                         const Size f_block_size,
+                         const std::size_t hash) {
+  std::ifstream file(progress_filename(filename));
+  if (not file) return {};
+
+  Size n        = 0;
+  std::size_t h = 0;
+  if (not(file >> n >> h) or n != f_block_size or h != hash) return {};
+
+  progress_t out;
+  String name;
+  Size done;
+  while (file >> name >> done) out[to<SpeciesEnum>(name)] = done;
+  return out;
+}
+
+//! Whether the file on disk has the same layout and grids as expected
+bool matches_layout(const String& filename,
+                    const layout& lay,
+                    const AbsorptionLookupTables& data) {
+  std::ifstream file(filename, std::ios::binary | std::ios::ate);
+  if (not file or static_cast<std::uint64_t>(file.tellg()) != lay.file_size) {
+    return false;
+  }
+
+  const auto same = [&file](std::uint64_t pos, const void* ptr, Size n) {
+    std::vector<char> buf(n);
+    file.seekg(pos);
+    file.read(buf.data(), n);
+    return file and std::memcmp(buf.data(), ptr, n) == 0;
+  };
+
+  if (not same(0, &lay.header, sizeof(lay.header))) return false;
+  if (not same(sizeof(lay.header),
+               lay.entries.data(),
+               lay.entries.size() * sizeof(mapped::table_entry))) {
+    return false;
+  }
+
+  for (Size i = 0; i < lay.species.size(); i++) {
+    const table& t = data.at(lay.species[i]);
+    for (Size j = 0; j < mapped::nfields; j++) {
+      const auto f = static_cast<mapped::field>(j);
+      if (f == mapped::field::xsec) continue;
+
+      const auto values = field_data(t, f);
+      if (not same(lay.entries[i].offset[j],
+                   values.data(),
+                   values.size() * sizeof(Numeric))) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+}  // namespace
+
+AbsorptionLookupTables precompute_mapped(
+    const String& filename,
+    const std::unordered_map<SpeciesEnum, table_setup>& setup,
+    const ArrayOfAtmPoint& atmref,
+    const std::shared_ptr<const AscendingGrid>& f_grid,
+    const AbsorptionBands& abs_bands,
+    const LinemixingEcsData& abs_ecs_data,
+    const Size f_block_size) try {
+  ARTS_TIME_REPORT
+
+  AbsorptionLookupTables grids;
+  for (auto& [s, x] : setup) grids[s].set_grids(atmref, f_grid, x.t, x.w);
+
+  const layout lay = make_layout(grids);
+  const Size nf    = f_grid->size();
+  const Size nb    = f_block_size == 0 ? nf : std::min(f_block_size, nf);
+
+  // The target is only replaced when done, it may be mapped by live tables
+  const String partial = partial_filename(filename);
+
+  // Blocks computed from other bands or atmospheres must not be resumed
+  const std::size_t hash = input_hash(atmref, abs_bands, abs_ecs_data);
+
+  progress_t progress = load_progress(filename, nb, hash);
+  if (progress.empty() or not matches_layout(partial, lay, grids)) {
+    progress.clear();
+
+    std::ofstream file(partial, std::ios::binary | std::ios::trunc);
+    ARTS_USER_ERROR_IF(
+        not file, "Cannot open file \"{}\" for writing", partial)
+    write_layout(file, lay, grids, false);
+    ARTS_USER_ERROR_IF(not file, "Error writing to file \"{}\"", partial)
+  }
+
+  for (auto s : lay.species) progress.try_emplace(s, 0);
+  save_progress(filename, nb, hash, progress);
+
+  std::fstream file(partial, std::ios::binary | std::ios::in | std::ios::out);
+  ARTS_USER_ERROR_IF(not file, "Cannot open file \"{}\" for writing", partial)
+
+  const Size nblocks = nf == 0 ? 0 : (nf + nb - 1) / nb;
+  const auto ixsec   = static_cast<Size>(mapped::field::xsec);
+
+  Tensor4 xsec_block;
+  for (Size i = 0; i < lay.species.size(); i++) {
+    const SpeciesEnum s = lay.species[i];
+    const table& t      = grids.at(s);
+    const auto [nt, nw, np, nf_] = t.grid_shape();
+    const std::uint64_t offset   = lay.entries[i].offset[ixsec];
+
+    for (Size ib = progress.at(s); ib < nblocks; ib++) {
+      const Range f_range(ib * nb, std::min(nb, nf - ib * nb));
+
+      xsec_block.resize(nt, nw, np, f_range.nelem);
+      t.compute_block(
+          xsec_block, f_range, s, atmref, abs_bands, abs_ecs_data);
+
+      // The cross sections are [t, w, p, f] so a block is one chunk per row
+      for (Index it = 0; it < nt; it++) {
+        for (Index iw = 0; iw < nw; iw++) {
+          for (Index ip = 0; ip < np; ip++) {
+            const Index row = (it * nw + iw) * np + ip;
+            file.seekp(offset + (row * nf_ + f_range.offset) * sizeof(Numeric));
+            file.write(
+                reinterpret_cast<const char*>(&xsec_block[it, iw, ip, 0]),
+                f_range.nelem * sizeof(Numeric));
+          }
+        }
+      }
+
+      file.flush();
+      ARTS_USER_ERROR_IF(not file, "Error writing to file \"{}\"", partial)
+
+      progress[s] = ib + 1;
+      save_progress(filename, nb, hash, progress);
+    }
+  }
+
+  file.close();
+  std::filesystem::rename(partial, filename);
+  std::filesystem::remove(progress_filename(filename));
+
+  return read_mapped(filename);
+}
+ARTS_METHOD_ERROR_CATCH
+}  // namespace lookup
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+
+#include "lookup_map.h"
+
+namespace lookup {
+/*! Layout of the memory-mappable binary container for lookup tables
+
+  The file is written in native byte-order and consists of
+
+    1. One file_header
+    2. file_header::ntables table_entry
+    3. Array payloads
+
+  The cross section payloads are aligned to file_header::alignment bytes,
+  the grid payloads to a cache line.  All array payloads are stored as raw
+  Numeric.  The cross section payload is stored in the same [t, w, p, f]
+  row-major layout as table::xsec so that it can be viewed in-place once
+  the file has been mapped.
+*/
+namespace mapped {
+//! The magic bytes at the start of the file
+inline constexpr std::array<char, 8> magic{
+    'A', 'R', 'T', 'S', '-', 'L', 'U', 'T'};
+
+//! The current version of the format, bump if the layout changes
+inline constexpr std::uint32_t version = 1;
+
+//! Used to detect files written on a machine of different endianness
+inline constexpr std::uint32_t endian_marker = 0x01020304;
+
+//! Payload alignment, a multiple of the page size on all relevant systems
+inline constexpr std::uint64_t alignment = 65536;
+
+//! The order of the arrays in table_entry
+enum class field : std::uint8_t {
+  f_grid,
+  log_p_grid,
+  t_pert,
+  w_pert,
+  water_atmref,
+  t_atmref,
+  xsec,
+  count
+};
+
+inline constexpr Size nfields = static_cast<Size>(field::count);
+
+struct file_header {
+  std::array<char, 8> magic;
+  std::uint32_t version;
+  std::uint32_t endian;
+  std::uint64_t alignment;
+  std::uint64_t ntables;
+};
+
+struct table_entry {
+  //! Null-padded short name of the species
+  std::array<char, 32> species;
+
+  //! Number of Numeric elements in each field (0 means nullptr for grids)
+  std::array<std::uint64_t, nfields> size;
+
+  //! Byte offset from the start of the file to each field
+  std::array<std::uint64_t, nfields> offset;
+};
+
+static_assert(std::is_trivially_copyable_v<file_header>);
+static_assert(std::is_trivially_copyable_v<table_entry>);
+}  // namespace mapped
+
+/** Write the lookup tables to a memory-mappable binary file
+ *
+ * The file is written under a temporary name and then renamed to filename,
+ * so tables that have an old version of the file mapped are not affected.
+ *
+ * @param filename The file to write to, replaced if it exists
+ * @param data The lookup tables
+ */
+void write_mapped(const String& filename, const AbsorptionLookupTables& data);
+
+/** Read lookup tables from a memory-mappable binary file
+ *
+ * The grids are copied into memory, the cross sections are not.  The
+ * returned tables instead view the mapped pages read-only, see
+ * table::xsec_data().  All processes that map the same file thus share
+ * the same physical memory via the page cache.
+ *
+ * The mapping is released once the last table referring to it is destroyed.
+ *
+ * @param filename The file to read
+ * @return AbsorptionLookupTables The read-only lookup tables
+ */
+AbsorptionLookupTables read_mapped(const String& filename);
+
+//! The perturbation grids of a species, see precompute_mapped()
+struct table_setup {
+  std::shared_ptr<const AscendingGrid> t{};
+  std::shared_ptr<const AscendingGrid> w{};
+};
+
+/** Compute lookup tables straight into a memory-mappable binary file
+ *
+ * The cross sections are computed in blocks of f_block_size frequencies.
+ * Each finished block is written to the file before the next is computed,
+ * so only a single block is ever held in memory.
+ *
+ * The blocks are written to filename + ".partial", which replaces filename
+ * once all blocks are done, so tables that have an old version of filename
+ * mapped are not affected.  Progress is recorded in a sidecar file,
+ * filename + ".progress".  If the computation is interrupted, calling this
+ * again with the same input resumes after the last finished block.  The
+ * sidecar is removed when all blocks are done.
+ *
+ * The sidecar holds a hash of the bands, the line mixing data, and the
+ * reference atmosphere.  The computation starts over, overwriting the
+ * partial file, if this hash or the grids in the partial file do not match
+ * the input.
+ *
+ * @param filename The file to write to
+ * @param setup The species to compute and their perturbation grids
+ * @param atmref The reference atmosphere
+ * @param f_grid The frequency grid
+ * @param abs_bands The line-by-line data
+ * @param abs_ecs_data The line mixing data
+ * @param f_block_size Number of frequencies per block, 0 means all
+ * @return AbsorptionLookupTables As read_mapped(filename)
+ */
+AbsorptionLookupTables precompute_mapped(
+    const String& filename,
+    const std::unordered_map<SpeciesEnum, table_setup>& setup,
+    const ArrayOfAtmPoint& atmref,
+    const std::shared_ptr<const AscendingGrid>& f_grid,
+    const AbsorptionBands& abs_bands,
+    const LinemixingEcsData& abs_ecs_data,
+    const Size f_block_size);
+}  // namespace lookup
@@ -14,6 +14,27 @@ extern "C" void dgbsv_(int* N,
                        int* LDB,
                        int* INFO);
 
+extern "C" void dgbtrf_(int* M,
+                        int* N,
+                        int* KL,
+                        int* KU,
+                        double* AB,
+                        int* LDAB,
+                        int* IPIV,
+                        int* INFO);
+
+extern "C" void dgbtrs_(char* TRANS,
+                        int* N,
+                        int* KL,
+                        int* KU,
+                        int* NRHS,
+                        double* AB,
+                        int* LDAB,
+                        int* IPIV,
+                        double* B,
+                        int* LDB,
+                        int* INFO);
+
 namespace matpack {
 band_matrix::band_matrix()                                  = default;
 band_matrix::band_matrix(const band_matrix&)                = default;
@@ -76,4 +97,45 @@ int band_matrix::solve(Vector& bx) {
 
   return info;
 }
+
+int band_matrix::factorize() {
+  ARTS_TIME_REPORT
+
+  int m    = static_cast<int>(M);
+  int n    = static_cast<int>(N);
+  int kl   = static_cast<int>(KL);
+  int ku   = static_cast<int>(KU);
+  int ldab = 2 * kl + ku + 1;
+  int info = 0;
+
+  dgbtrf_(&m, &n, &kl, &ku, AB.data_handle(), &ldab, ipiv.data(), &info);
+
+  return info;
+}
+
+int band_matrix::solve_factorized(Vector& bx) {
+  ARTS_TIME_REPORT
+
+  char trans = 'N';
+  int n      = static_cast<int>(N);
+  int kl     = static_cast<int>(KL);
+  int ku     = static_cast<int>(KU);
+  int nrhs   = 1;
+  int ldab   = 2 * kl + ku + 1;
+  int info   = 0;
+
+  dgbtrs_(&trans,
+          &n,
+          &kl,
+          &ku,
+          &nrhs,
+          AB.data_handle(),
+          &ldab,
+          ipiv.data(),
+          bx.data_handle(),
+          &n,
+          &info);
+
+  return info;
+}
 }  // namespace matpack
@@ -42,5 +42,11 @@ class band_matrix {
 
   //! Solves the system of equations A * x = b destructively
   int solve(Vector& bx);
+
+  //! Replaces the matrix by its LU factorization, see solve_factorized
+  int factorize();
+
+  //! Solves A * x = b, where the matrix holds the result of factorize
+  int solve_factorized(Vector& bx);
 };
 }  // namespace matpack
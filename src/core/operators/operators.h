@@ -6,6 +6,8 @@
 #include <xml_io_stream.h>
 
 #include <functional>
+#include <type_traits>
+#include <utility>
 
 #ifndef _MSC_VER
 #if defined(__clang__)
@@ -15,10 +17,45 @@
 #endif
 #endif
 
+//! The type of T when an operator is called for many points at once
+template <typename T>
+struct custom_operator_batch {
+  using type = T;
+};
+
+template <>
+struct custom_operator_batch<Numeric> {
+  using type = Vector;
+};
+
+template <>
+struct custom_operator_batch<std::pair<Numeric, Numeric>> {
+  using type = std::pair<Vector, Vector>;
+};
+
+template <typename T>
+using custom_operator_batch_t = typename custom_operator_batch<T>::type;
+
+//! The batched argument type, numeric arguments become all of the points
+template <typename T>
+using custom_operator_batch_arg_t =
+    std::conditional_t<std::is_same_v<T, Numeric>, const Vector &, T>;
+
+/*! A user-defined function
+
+  The optional batch function is the same function called for many points at
+  once, with all numeric arguments and results as vectors of the points.
+  Callers that evaluate the operator for many points use it if it is set,
+  e.g., to call a Python function once rather than once per point.  The
+  batch function is not stored to file.
+*/
 template <typename R, typename... Args>
 struct CustomOperator {
-  using func_t = std::function<R(Args...)>;
+  using func_t  = std::function<R(Args...)>;
+  using batch_t = std::function<custom_operator_batch_t<R>(
+      custom_operator_batch_arg_t<Args>...)>;
   func_t f;
+  batch_t batch{};
 
   R operator()(Args... args) const {
     if (f) return f(args...);
@@ -82,6 +119,7 @@ struct xml_io_stream<CustomOperator<R, Args...>> {
     tag.check_name(type_name);
 
     xml_read_from_stream(is, x.f, pbifs);
+    x.batch = {};
 
     tag.read_from_stream(is);
     tag.check_end_name(type_name);
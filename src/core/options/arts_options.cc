@@ -292,13 +292,25 @@ allocate memory proportional to :math:`N`.
 The high performance computation time is :math:`O(M+N)`.  It will allocate
 memory proportional to :math:`MN`.  You should generally use this option
 unless you run into memory constraints.
+
+The streaming option runs the simulations in rounds of one per core.  After
+each round, the simulations are summed up directly into *measurement_vec*
+and *measurement_jac*, where every observation element is summed up by one
+owning core in a fixed order.  So no lock is needed and the result does not
+depend on the timing of the simulations.  Its computation time is
+:math:`O(M+N)` and its memory per core is that of a single simulation.
+The cores wait for each other after every round, so it balances less well
+than the other options if some simulations take much longer than others.
 )",
       .values_and_desc = {Value{"LowMem",
                                 "Low Memory",
                                 "Use the low memory kernel"},
                           Value{"HighPerf",
                                 "High Performance",
-                                "Use the high performance kernel"}},
+                                "Use the high performance kernel"},
+                          Value{"Streaming",
+                                "Streaming",
+                                "Use the streaming kernel"}},
   });
 
   opts.emplace_back(EnumeratedOption{
@@ -614,6 +626,27 @@ parameters that are mapped to the species identifier.
                "[WIP] [UNTESTED] Voigt using error-corrected sudden for line mixing of spherical top molecules (CH4)"}},
   });
 
+  opts.emplace_back(EnumeratedOption{
+      .name = "LookupTableStorage",
+      .desc = R"(How the cross sections of an absorption lookup table are stored.
+
+All reduced storage modes keep the logarithm of the cross section, since the
+values span many decades.  They require non-negative cross sections.  Zero is
+represented exactly.  The values are decoded on the fly when the table is
+interpolated.
+)",
+      .values_and_desc =
+          {Value{"Double", "Full double precision, 8 bytes per value"},
+           Value{"LogFloat32",
+                 "Natural logarithm as single precision, 4 bytes per value"},
+           Value{
+               "LogFloat16",
+               "Natural logarithm relative to the table mean as half precision, 2 bytes per value.  Relative errors are in the per mille range"},
+           Value{
+               "ScaledInt16",
+               "Natural logarithm quantized to 16 bits using a per pressure and frequency offset and scale, 2 bytes per value plus 8 bytes per pressure and frequency.  Pays off when there are several temperature and water perturbations"}},
+  });
+
   opts.emplace_back(EnumeratedOption{
       .name = "PlanetOrMoonType",
       .desc = R"(The type of planetary body that should be considered.
@@ -19,12 +19,15 @@ ArrayOfAtmPoint &atm_path_resize(ArrayOfAtmPoint &atm_path,
 void forward_atm_path(ArrayOfAtmPoint &atm_path,
                       const ArrayOfPropagationPathPoint &rad_path,
                       const AtmField &atm) {
+  std::vector<Vector3> pos(rad_path.size());
   stdr::transform(rad_path,
-                  atm_path.begin(),
-                  [&atm](const PropagationPathPoint &pp) -> AtmPoint {
-                    if (pp.has(PathPositionType::atm)) return atm.at(pp.pos);
-                    return atm.at(atm.top_of_atmosphere, pp.pos[1], pp.pos[2]);
+                  pos.begin(),
+                  [&atm](const PropagationPathPoint &pp) -> Vector3 {
+                    if (pp.has(PathPositionType::atm)) return pp.pos;
+                    return {atm.top_of_atmosphere, pp.pos[1], pp.pos[2]};
                   });
+
+  atm.at(atm_path, pos);
 }
 
 ArrayOfAtmPoint forward_atm_path(const ArrayOfPropagationPathPoint &rad_path,
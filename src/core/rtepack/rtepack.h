@@ -8,6 +8,7 @@
 #include "rtepack_scattering.h"
 #include "rtepack_source.h"
 #include "rtepack_spectral_matrix.h"
+#include "rtepack_spectral_path.h"
 #include "rtepack_stokes_vector.h"
 #include "rtepack_surface.h"
 #include "rtepack_transmission.h"
@@ -19,6 +20,7 @@ using PropmatConstVectorView      = rtepack::propmat_vector_const_view;
 using PropmatMatrix               = rtepack::propmat_matrix;
 using PropmatMatrixView           = rtepack::propmat_matrix_view;
 using PropmatConstMatrixView      = rtepack::propmat_matrix_const_view;
+using PropmatTensor3              = rtepack::propmat_tensor3;
 using ArrayOfPropmatVector        = Array<PropmatVector>;
 using ArrayOfPropmatMatrix        = Array<PropmatMatrix>;
 using ArrayOfArrayOfPropmatVector = Array<ArrayOfPropmatVector>;
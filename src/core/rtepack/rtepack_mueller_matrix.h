@@ -175,6 +175,12 @@ struct muelmat final : Matrix44 {
            data[8] != 0.0 or data[9] != 0.0 or data[11] != 0.0 or
            data[12] != 0.0 or data[13] != 0.0 or data[14] != 0.0;
   }
+
+  //! Check if the matrix is a scalar times the identity matrix
+  [[nodiscard]] constexpr bool is_scalar() const noexcept {
+    return not is_polarized() and data[0] == data[5] and
+           data[0] == data[10] and data[0] == data[15];
+  }
 };
 
 //! Addition between muelmat matrices
@@ -262,6 +262,21 @@ void nlte_step(stokvec_vector_view I,
 }
 
 namespace {
+/*! The Mueller matrix, or its scalar value on unpolarized paths
+
+  All matrices of an unpolarized path are scalars times the identity matrix,
+  so the Stokes components can be propagated with scalar arithmetic.
+*/
+template <bool polarized>
+constexpr decltype(auto) mat(const muelmat &m) {
+  if constexpr (polarized) {
+    return m;
+  } else {
+    return m[0, 0];
+  }
+}
+
+template <bool polarized>
 void constant(stokvec_vector_view &Is,
               stokvec_tensor3_view &dIs,
               const muelmat_matrix_const_view &Ts,
@@ -285,8 +300,8 @@ void constant(stokvec_vector_view &Is,
     const stokvec_matrix_const_view dJv  = dJs[iv];
 
     for (Size i = np - 2; i < np; i--) {
-      const muelmat &T = Tv[i + 1];
-      const stokvec J  = avg(Jv[i], Jv[i + 1]);
+      const auto &T   = mat<polarized>(Tv[i + 1]);
+      const stokvec J = avg(Jv[i], Jv[i + 1]);
 
       Iv -= J;
 
@@ -297,11 +312,13 @@ void constant(stokvec_vector_view &Is,
         const auto &&dT1 = dT1v[i + 1];
         const auto &&dJ0 = dJv[i];
         const auto &&dJ1 = dJv[i + 1];
-        const auto &P    = Pi[iv, i];
+        const auto &P    = mat<polarized>(Pi[iv, i]);
 
         for (Size iq = 0; iq < nq; iq++) {
-          dI0[iq] += P * (dT0[iq] * Iv + avg(dJ0[iq], -(T * dJ0[iq])));
-          dI1[iq] += P * (dT1[iq] * Iv + avg(dJ1[iq], -(T * dJ1[iq])));
+          dI0[iq] += P * (mat<polarized>(dT0[iq]) * Iv +
+                          avg(dJ0[iq], -(T * dJ0[iq])));
+          dI1[iq] += P * (mat<polarized>(dT1[iq]) * Iv +
+                          avg(dJ1[iq], -(T * dJ1[iq])));
         }
       }
 
@@ -310,6 +327,7 @@ void constant(stokvec_vector_view &Is,
   }
 }
 
+template <bool polarized>
 void linevo(stokvec_vector_view &Is,
             stokvec_tensor3_view &dIs,
             const muelmat_matrix_const_view &Ts,
@@ -339,8 +357,8 @@ void linevo(stokvec_vector_view &Is,
     const stokvec_matrix_const_view dJv  = dJs[iv];
 
     for (Size i = np - 2; i < np; i--) {
-      const muelmat &T    = Tv[i + 1];
-      const muelmat &L    = Lv[i + 1];
+      const auto &T       = mat<polarized>(Tv[i + 1]);
+      const auto &L       = mat<polarized>(Lv[i + 1]);
       const stokvec &J0   = Jv[i + 1];
       const stokvec &J1   = Jv[i];
       const stokvec ImJ0  = Iv - J0;
@@ -355,12 +373,14 @@ void linevo(stokvec_vector_view &Is,
         const auto &&dL1 = dL1v[i + 1];
         const auto &&dJ0 = dJv[i];
         const auto &&dJ1 = dJv[i + 1];
-        const auto &P    = Pi[iv, i];
+        const auto &P    = mat<polarized>(Pi[iv, i]);
 
         for (Size iq = 0; iq < nq; iq++) {
-          dI0[iq] +=
-              P * (dJ1[iq] - L * dJ0[iq] + dT0[iq] * ImJ0 + dL0[iq] * J0mJ1);
-          dI1[iq] += P * (dT1[iq] * ImJ0 + dL1[iq] * J0mJ1 + L * dJ1[iq] -
+          dI0[iq] += P * (dJ1[iq] - L * dJ0[iq] +
+                          mat<polarized>(dT0[iq]) * ImJ0 +
+                          mat<polarized>(dL0[iq]) * J0mJ1);
+          dI1[iq] += P * (mat<polarized>(dT1[iq]) * ImJ0 +
+                          mat<polarized>(dL1[iq]) * J0mJ1 + L * dJ1[iq] -
                           T * dJ0[iq]);
         }
       }
@@ -369,41 +389,54 @@ void linevo(stokvec_vector_view &Is,
     }
   }
 }
-}  // namespace
 
-void rte_emission(stokvec_vector_view I,
-                  stokvec_tensor3_view dI,
-                  const TransmittanceMatrix &tramat,
-                  const SourceVector &srcvec) {
+template <bool polarized>
+void emission(stokvec_vector_view I,
+              stokvec_tensor3_view dI,
+              const TransmittanceMatrix &tramat,
+              const SourceVector &srcvec) {
   switch (tramat.option) {
     case TransmittanceOption::constant:
-      constant(I,
-               dI,
-               tramat.T,
-               tramat.P,
-               tramat.dT[0],
-               tramat.dT[1],
-               srcvec.J,
-               srcvec.dJ);
+      constant<polarized>(I,
+                          dI,
+                          tramat.T,
+                          tramat.P,
+                          tramat.dT[0],
+                          tramat.dT[1],
+                          srcvec.J,
+                          srcvec.dJ);
       break;
     case TransmittanceOption::linsrc:
     case TransmittanceOption::linprop:
-      linevo(I,
-             dI,
-             tramat.T,
-             tramat.L,
-             tramat.P,
-             tramat.dT[0],
-             tramat.dT[1],
-             tramat.dL[0],
-             tramat.dL[1],
-             srcvec.J,
-             srcvec.dJ);
+      linevo<polarized>(I,
+                        dI,
+                        tramat.T,
+                        tramat.L,
+                        tramat.P,
+                        tramat.dT[0],
+                        tramat.dT[1],
+                        tramat.dL[0],
+                        tramat.dL[1],
+                        srcvec.J,
+                        srcvec.dJ);
       break;
   }
 }
+}  // namespace
+
+void rte_emission(stokvec_vector_view I,
+                  stokvec_tensor3_view dI,
+                  const TransmittanceMatrix &tramat,
+                  const SourceVector &srcvec) {
+  if (tramat.is_polarized()) {
+    emission<true>(I, dI, tramat, srcvec);
+  } else {
+    emission<false>(I, dI, tramat, srcvec);
+  }
+}
 
 namespace {
+template <bool polarized>
 void constant(stokvec_matrix_view Is,
               const muelmat_matrix_const_view &Ts,
               const stokvec_matrix_const_view &Js) {
@@ -413,13 +446,14 @@ void constant(stokvec_matrix_view Is,
 #pragma omp parallel for if (not arts_omp_in_parallel())
   for (Size iv = 0; iv < nv; iv++) {
     for (Size i = np - 2; i < np; i--) {
-      const muelmat &T = Ts[iv, i + 1];
-      const stokvec J  = avg(Js[iv, i], Js[iv, i + 1]);
-      Is[iv, i]        = T * (Is[iv, i + 1] - J) + J;
+      const auto &T   = mat<polarized>(Ts[iv, i + 1]);
+      const stokvec J = avg(Js[iv, i], Js[iv, i + 1]);
+      Is[iv, i]       = T * (Is[iv, i + 1] - J) + J;
     }
   }
 }
 
+template <bool polarized>
 void linevo(stokvec_matrix_view Is,
             const muelmat_matrix_const_view &Ts,
             const muelmat_matrix_const_view &Ls,
@@ -430,8 +464,8 @@ void linevo(stokvec_matrix_view Is,
 #pragma omp parallel for if (not arts_omp_in_parallel())
   for (Size iv = 0; iv < nv; iv++) {
     for (Size i = np - 2; i < np; i--) {
-      const muelmat &T  = Ts[iv, i + 1];
-      const muelmat &L  = Ls[iv, i + 1];
+      const auto &T     = mat<polarized>(Ts[iv, i + 1]);
+      const auto &L     = mat<polarized>(Ls[iv, i + 1]);
       const stokvec &J0 = Js[iv, i + 1];
       const stokvec &J1 = Js[iv, i];
       Is[iv, i]         = T * (Is[iv, i + 1] - J0) + L * (J0 - J1) + J1;
@@ -445,14 +479,29 @@ void rte_emission_path(stokvec_matrix_view Is,
                        const SourceVector &Js) {
   if (Is.size() == 0) return;
 
+  const bool polarized = Ts.is_polarized();
+
   switch (Ts.option) {
-    case TransmittanceOption::constant: constant(Is, Ts.T, Js.J); break;
+    case TransmittanceOption::constant:
+      if (polarized) {
+        constant<true>(Is, Ts.T, Js.J);
+      } else {
+        constant<false>(Is, Ts.T, Js.J);
+      }
+      break;
     case TransmittanceOption::linsrc:
-    case TransmittanceOption::linprop:  linevo(Is, Ts.T, Ts.L, Js.J); break;
+    case TransmittanceOption::linprop:
+      if (polarized) {
+        linevo<true>(Is, Ts.T, Ts.L, Js.J);
+      } else {
+        linevo<false>(Is, Ts.T, Ts.L, Js.J);
+      }
+      break;
   }
 }
 
 namespace {
+template <bool polarized>
 void all(stokvec_vector_view I,
          stokvec_tensor3_view dI,
          const muelmat_matrix_const_view &Ts,
@@ -468,7 +517,9 @@ void all(stokvec_vector_view I,
   dI = 0;
 
 #pragma omp parallel for if (!arts_omp_in_parallel())
-  for (Size iv = 0; iv < nv; iv++) I[iv] = Pi[iv, N - 1] * I0[iv];
+  for (Size iv = 0; iv < nv; iv++) {
+    I[iv] = mat<polarized>(Pi[iv, N - 1]) * I0[iv];
+  }
 
   if (nq == 0 or N == 1) return;
 
@@ -477,19 +528,23 @@ void all(stokvec_vector_view I,
   for (Size iv = 0; iv < nv; iv++) {
     const auto src = I0[iv];
 
-    muelmat P = 1.0;
+    std::conditional_t<polarized, muelmat, Numeric> P = 1.0;
     for (Size i = N - 2; i > 0; i--) {
-      const muelmat R = Ts[i + 1][iv] * P;
+      const auto R = mat<polarized>(Ts[iv, i + 1]) * P;
       for (Size iq = 0; iq < nq; iq++) {
-        dI[iv, i, iq]     += Pi[iv, i] * dTs[0, iv, i, iq] * P * src;
-        dI[iv, i - 1, iq] += Pi[iv, i - 1] * dTs[1, iv, i, iq] * R * src;
+        dI[iv, i, iq] += mat<polarized>(Pi[iv, i]) *
+                         mat<polarized>(dTs[0, iv, i, iq]) * P * src;
+        dI[iv, i - 1, iq] += mat<polarized>(Pi[iv, i - 1]) *
+                             mat<polarized>(dTs[1, iv, i, iq]) * R * src;
       }
       P = R;
     }
 
     for (Size iq = 0; iq < nq; iq++) {
-      dI[iv, 0, iq]     += Pi[iv, 0] * dTs[0, iv, 0, iq] * P * src;
-      dI[iv, N - 1, iq] += Pi[iv, N - 2] * dTs[1, iv, N - 1, iq] * src;
+      dI[iv, 0, iq] += mat<polarized>(Pi[iv, 0]) *
+                       mat<polarized>(dTs[0, iv, 0, iq]) * P * src;
+      dI[iv, N - 1, iq] += mat<polarized>(Pi[iv, N - 2]) *
+                           mat<polarized>(dTs[1, iv, N - 1, iq]) * src;
     }
   }
 }
@@ -499,6 +554,10 @@ void rte_transmission(stokvec_vector_view I,
                       stokvec_tensor3_view dI,
                       const TransmittanceMatrix &tramat,
                       const stokvec_vector_const_view &I0) {
-  all(I, dI, tramat.T, tramat.P, tramat.dT, I0);
+  if (tramat.is_polarized()) {
+    all<true>(I, dI, tramat.T, tramat.P, tramat.dT, I0);
+  } else {
+    all<false>(I, dI, tramat.T, tramat.P, tramat.dT, I0);
+  }
 }
 }  // namespace rtepack
\ No newline at end of file
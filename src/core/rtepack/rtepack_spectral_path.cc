@@ -0,0 +1,104 @@
+#include "rtepack_spectral_path.h"
+
+#include <arts_omp.h>
+
+#include <algorithm>
+
+namespace rtepack {
+namespace {
+//! Frequencies copied together, so that both reads and writes are runs
+constexpr Size block = 64;
+
+/*! dst[f, i, ...] = src[i][..., f] for a block of frequencies
+
+  Each path point is read as contiguous runs of the block size, and the
+  block of output rows stays in cache while the path points are looped.
+*/
+template <typename T>
+void transpose(matpack::view_t<T, 2> dst,
+               const std::span<const matpack::data_t<T, 1>>& src,
+               const Size f0,
+               const Size f1) {
+  for (Size i = 0; i < src.size(); i++) {
+    const auto& s = src[i];
+    for (Size f = f0; f < f1; f++) dst[f, i] = s[f];
+  }
+}
+
+template <typename T>
+void transpose(matpack::view_t<T, 3> dst,
+               const std::span<const matpack::data_t<T, 2>>& src,
+               const Size f0,
+               const Size f1) {
+  for (Size i = 0; i < src.size(); i++) {
+    const auto& s = src[i];
+    for (Index q = 0; q < s.nrows(); q++) {
+      for (Size f = f0; f < f1; f++) dst[f, i, q] = s[q, f];
+    }
+  }
+}
+}  // namespace
+
+void spectral_path::resize(Size nf, Size np, Size nq) {
+  freq.resize(nf, np);
+  propmat.resize(nf, np);
+  nlte.resize(nf, np);
+  propmat_jac.resize(nf, np, nq);
+  nlte_jac.resize(nf, np, nq);
+}
+
+void spectral_path::set_point(Size ip,
+                              const ConstVectorView& freq_grid,
+                              const propmat_vector_const_view& K,
+                              const stokvec_vector_const_view& S,
+                              const propmat_matrix_const_view& dK,
+                              const stokvec_matrix_const_view& dS) {
+  freq[joker, ip]    = freq_grid;
+  propmat[joker, ip] = K;
+  nlte[joker, ip]    = S;
+
+  const Size nf = K.size();
+  const Size nq = static_cast<Size>(dK.nrows());
+  for (Size f = 0; f < nf; f++) {
+    for (Size q = 0; q < nq; q++) {
+      propmat_jac[f, ip, q] = dK[q, f];
+      nlte_jac[f, ip, q]    = dS[q, f];
+    }
+  }
+}
+
+void spectral_path::set(const std::span<const AscendingGrid>& freq_grid,
+                        const std::span<const propmat_vector>& K,
+                        const std::span<const stokvec_vector>& S,
+                        const std::span<const propmat_matrix>& dK,
+                        const std::span<const stokvec_matrix>& dS) {
+  const Size np = K.size();
+  const Size nf = np == 0 ? 0 : K.front().size();
+  const Size nq = np == 0 ? 0 : static_cast<Size>(dK.front().nrows());
+
+  resize(nf, np, nq);
+
+  const Size nb = (nf + block - 1) / block;
+
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Size b = 0; b < nb; b++) {
+    const Size f0 = b * block;
+    const Size f1 = std::min(nf, f0 + block);
+
+    for (Size i = 0; i < np; i++) {
+      for (Size f = f0; f < f1; f++) freq[f, i] = freq_grid[i][f];
+    }
+
+    transpose<propmat>(propmat, K, f0, f1);
+    transpose<stokvec>(nlte, S, f0, f1);
+    transpose<propmat>(propmat_jac, dK, f0, f1);
+    transpose<stokvec>(nlte_jac, dS, f0, f1);
+  }
+}
+
+std::array<Size, 3> spectral_path::shape() const noexcept {
+  return {static_cast<Size>(propmat_jac.npages()),
+          static_cast<Size>(propmat_jac.nrows()),
+          static_cast<Size>(propmat_jac.ncols())};
+}
+}  // namespace rtepack
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <matpack.h>
+
+#include <span>
+
+#include "rtepack_propagation_matrix.h"
+#include "rtepack_stokes_vector.h"
+
+namespace rtepack {
+/*! Frequency-major spectral variables along a path
+
+  The other path variables are stored per path point, with the frequency as
+  the inner dimension.  Radiative transfer is solved per frequency, so here
+  the path point is the inner dimension instead:  The variables at frequency
+  index f for all path points are the contiguous rows freq[f], propmat[f],
+  and so on.  The jacobian variables are (nf, np, nq).
+*/
+struct spectral_path {
+  Matrix freq{};
+  propmat_matrix propmat{};
+  stokvec_matrix nlte{};
+  propmat_tensor3 propmat_jac{};
+  stokvec_tensor3 nlte_jac{};
+
+  //! Sets the shape to nf frequencies, np path points, and nq targets
+  void resize(Size nf, Size np, Size nq);
+
+  /*! Sets the variables of a single path point
+
+    The shape must already be set by resize() and the inputs must match it.
+    This is not checked.
+
+    @param[in] ip The path point
+    @param[in] freq_grid The frequency grid (nf)
+    @param[in] K The propagation matrices (nf)
+    @param[in] S The NLTE source vectors (nf)
+    @param[in] dK The propagation matrix jacobians (nq, nf)
+    @param[in] dS The NLTE source vector jacobians (nq, nf)
+  */
+  void set_point(Size ip,
+                 const ConstVectorView& freq_grid,
+                 const propmat_vector_const_view& K,
+                 const stokvec_vector_const_view& S,
+                 const propmat_matrix_const_view& dK,
+                 const stokvec_matrix_const_view& dS);
+
+  /*! Transposes the point-major path variables
+
+    The inputs must be valid for the spectral radiative transfer, i.e.,
+    all have the same path size and the same number of frequencies at all
+    path points.  This is not checked.
+
+    @param[in] freq_grid The frequency grid per path point (np; nf)
+    @param[in] K The propagation matrices (np; nf)
+    @param[in] S The NLTE source vectors (np; nf)
+    @param[in] dK The propagation matrix jacobians (np; nq, nf)
+    @param[in] dS The NLTE source vector jacobians (np; nq, nf)
+  */
+  void set(const std::span<const AscendingGrid>& freq_grid,
+           const std::span<const propmat_vector>& K,
+           const std::span<const stokvec_vector>& S,
+           const std::span<const propmat_matrix>& dK,
+           const std::span<const stokvec_matrix>& dS);
+
+  //! Should return nf, np, nq [unchecked]
+  [[nodiscard]] std::array<Size, 3> shape() const noexcept;
+};
+}  // namespace rtepack
+
+using SpectralPath = rtepack::spectral_path;
+
+template <>
+struct xml_io_stream_name<SpectralPath> {
+  static constexpr std::string_view name = "SpectralPath";
+};
+
+template <>
+struct xml_io_stream_aggregate<SpectralPath> {
+  static constexpr bool value = true;
+};
+
+template <>
+struct std::formatter<SpectralPath> {
+  format_tags tags;
+
+  [[nodiscard]] constexpr auto& inner_fmt() { return *this; }
+  [[nodiscard]] constexpr auto& inner_fmt() const { return *this; }
+
+  constexpr std::format_parse_context::iterator parse(
+      std::format_parse_context& ctx) {
+    return parse_format_tags(tags, ctx);
+  }
+
+  template <class FmtContext>
+  FmtContext::iterator format(const SpectralPath& v, FmtContext& ctx) const {
+    const std::string_view sep = tags.sep();
+    return tags.format(ctx,
+                       v.freq,
+                       sep,
+                       v.propmat,
+                       sep,
+                       v.nlte,
+                       sep,
+                       v.propmat_jac,
+                       sep,
+                       v.nlte_jac);
+  }
+};
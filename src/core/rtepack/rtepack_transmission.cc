@@ -673,6 +673,626 @@ muelmat tran::deriv(const muelmat &t,
   // clang-format on
 }
 
+namespace {
+//! The number of frequencies evaluated together by tran_batch
+constexpr Size tran_chunk = 64;
+
+using tran_lane = std::array<Numeric, tran_chunk>;
+
+//! A chunk of Mueller matrices, one array per element
+using muelmat_lanes = std::array<tran_lane, 16>;
+
+/*! The members of tran for a chunk of frequencies, one array per member
+
+  The polarized state is computed for all lanes without branching, and the
+  result of each lane is selected in the end.  Chunks without polarization
+  skip the polarized state altogether.
+*/
+struct tran_lanes {
+  Size n{0};
+  bool any_polarized{false};
+
+  tran_lane a, exp_a;
+  tran_lane b, c, d, u, v, w;
+  tran_lane b2, c2, d2, u2, v2, w2;
+  tran_lane B, S;
+  tran_lane x2, y2, x, y, cy, sy, cx, sx;
+  tran_lane ix, iy, inv_x2y2;
+  tran_lane C0, C1, C2, C3;
+  std::array<bool, tran_chunk> polarized, x_zero, y_zero, both_zero,
+      either_zero;
+
+  void set(const propmat_vector_const_view &k1,
+           const propmat_vector_const_view &k2,
+           const Numeric r,
+           const Size i0) {
+    any_polarized = false;
+    for (Size l = 0; l < n; l++) {
+      const propmat &p1 = k1[i0 + l];
+      const propmat &p2 = k2[i0 + l];
+
+      a[l]           = -0.5 * r * (p1.A() + p2.A());
+      b[l]           = -0.5 * r * (p1.B() + p2.B());
+      c[l]           = -0.5 * r * (p1.C() + p2.C());
+      d[l]           = -0.5 * r * (p1.D() + p2.D());
+      u[l]           = -0.5 * r * (p1.U() + p2.U());
+      v[l]           = -0.5 * r * (p1.V() + p2.V());
+      w[l]           = -0.5 * r * (p1.W() + p2.W());
+      polarized[l]   = p1.is_polarized() or p2.is_polarized();
+      any_polarized |= polarized[l];
+    }
+
+#pragma omp simd
+    for (Size l = 0; l < n; l++) exp_a[l] = std::exp(a[l]);
+
+    if (not any_polarized) return;
+
+#pragma omp simd
+    for (Size l = 0; l < n; l++) {
+      b2[l] = b[l] * b[l];
+      c2[l] = c[l] * c[l];
+      d2[l] = d[l] * d[l];
+      u2[l] = u[l] * u[l];
+      v2[l] = v[l] * v[l];
+      w2[l] = w[l] * w[l];
+
+      B[l] = u2[l] + v2[l] + w2[l] - b2[l] - c2[l] - d2[l];
+      const Numeric C =
+          -Math::pow2(d[l] * u[l] - c[l] * v[l] + b[l] * w[l]);
+      S[l] = std::sqrt(std::max<Numeric>(0.0, B[l] * B[l] - 4 * C));
+
+      x2[l] = std::sqrt(std::max<Numeric>(0.0, 0.5 * (S[l] - B[l])));
+      y2[l] = std::sqrt(std::max<Numeric>(0.0, 0.5 * (S[l] + B[l])));
+      x[l]  = std::sqrt(x2[l]);
+      y[l]  = std::sqrt(y2[l]);
+    }
+
+    for (Size l = 0; l < n; l++) {
+      cy[l] = std::cos(y[l]);
+      sy[l] = std::sin(y[l]);
+      cx[l] = std::cosh(x[l]);
+      sx[l] = std::sinh(x[l]);
+    }
+
+#pragma omp simd
+    for (Size l = 0; l < n; l++) {
+      x_zero[l]      = x[l] < too_small;
+      y_zero[l]      = y[l] < too_small;
+      both_zero[l]   = y_zero[l] and x_zero[l];
+      either_zero[l] = y_zero[l] or x_zero[l];
+
+      ix[l]       = x_zero[l] ? 0.0 : 1.0 / x[l];
+      iy[l]       = y_zero[l] ? 0.0 : 1.0 / y[l];
+      inv_x2y2[l] = both_zero[l] ? 1.0 : 1.0 / (x2[l] + y2[l]);
+
+      C0[l] = either_zero[l]
+                  ? 1.0
+                  : (cy[l] * x2[l] + cx[l] * y2[l]) * inv_x2y2[l];
+      C1[l] = either_zero[l] ? 1.0
+                             : (sy[l] * x2[l] * iy[l] + sx[l] * y2[l] * ix[l]) *
+                                   inv_x2y2[l];
+      C2[l] = both_zero[l] ? 0.5 : (cx[l] - cy[l]) * inv_x2y2[l];
+      C3[l] = both_zero[l] ? 1.0 / 6.0
+                           : ((x_zero[l] ? 1.0 : sx[l] * ix[l]) -
+                              (y_zero[l] ? 1.0 : sy[l] * iy[l])) *
+                                 inv_x2y2[l];
+
+      polarized[l] = polarized[l] and std::isfinite(C0[l]) and
+                     std::isfinite(C1[l]) and std::isfinite(C2[l]) and
+                     std::isfinite(C3[l]);
+    }
+  }
+
+  //! As tran::operator()
+  void transmission(muelmat_lanes &t) const {
+    if (not any_polarized) {
+      for (auto &lane : t) lane.fill(0.0);
+      for (Size l = 0; l < n; l++) {
+        t[0][l] = t[5][l] = t[10][l] = t[15][l] = exp_a[l];
+      }
+      return;
+    }
+
+#pragma omp simd
+    for (Size l = 0; l < n; l++) {
+      const Numeric b_ = b[l], c_ = c[l], d_ = d[l];
+      const Numeric u_ = u[l], v_ = v[l], w_ = w[l];
+      const Numeric C1_ = C1[l], C2_ = C2[l], C3_ = C3[l], B_ = B[l];
+
+      const Numeric C2b = C2_ * (c_ * u_ + d_ * v_);
+      const Numeric C2c = C2_ * (b_ * u_ - d_ * w_);
+      const Numeric C2d = C2_ * (b_ * v_ + c_ * w_);
+      const Numeric C2u = C2_ * (b_ * c_ - v_ * w_);
+      const Numeric C2v = C2_ * (b_ * d_ + u_ * w_);
+      const Numeric C2w = C2_ * (c_ * d_ - u_ * v_);
+
+      const Numeric C3b = C3_ * (b_ * (B_ - w2[l]) + w_ * (c_ * v_ - d_ * u_));
+      const Numeric C3c = C3_ * (c_ * (v2[l] - B_) - v_ * (d_ * u_ + b_ * w_));
+      const Numeric C3d = C3_ * (d_ * (u2[l] - B_) - u_ * (c_ * v_ - b_ * w_));
+      const Numeric C3u = C3_ * (d_ * (c_ * v_ - b_ * w_) - u_ * (B_ + d2[l]));
+      const Numeric C3v = C3_ * (c_ * (d_ * u_ + b_ * w_) - v_ * (B_ + c2[l]));
+      const Numeric C3w = C3_ * (b_ * (c_ * v_ - d_ * u_) - w_ * (B_ + b2[l]));
+
+      const Numeric M00 = C0[l] + C2_ * (b2[l] + c2[l] + d2[l]);
+      const Numeric M11 = C0[l] + C2_ * (b2[l] - u2[l] - v2[l]);
+      const Numeric M22 = C0[l] + C2_ * (c2[l] - u2[l] - w2[l]);
+      const Numeric M33 = C0[l] + C2_ * (d2[l] - v2[l] - w2[l]);
+
+      const bool p    = polarized[l];
+      const Numeric e = exp_a[l];
+
+      t[0][l]  = p ? e * M00 : e;
+      t[1][l]  = p ? e * (C1_ * b_ - C2b - C3b) : 0.0;
+      t[2][l]  = p ? e * (C1_ * c_ + C2c + C3c) : 0.0;
+      t[3][l]  = p ? e * (C1_ * d_ + C2d + C3d) : 0.0;
+      t[4][l]  = p ? e * (C1_ * b_ + C2b - C3b) : 0.0;
+      t[5][l]  = p ? e * M11 : e;
+      t[6][l]  = p ? e * (C1_ * u_ + C2u + C3u) : 0.0;
+      t[7][l]  = p ? e * (C1_ * v_ + C2v + C3v) : 0.0;
+      t[8][l]  = p ? e * (C1_ * c_ - C2c + C3c) : 0.0;
+      t[9][l]  = p ? e * (-C1_ * u_ + C2u - C3u) : 0.0;
+      t[10][l] = p ? e * M22 : e;
+      t[11][l] = p ? e * (C1_ * w_ + C2w + C3w) : 0.0;
+      t[12][l] = p ? e * (C1_ * d_ - C2d + C3d) : 0.0;
+      t[13][l] = p ? e * (-C1_ * v_ + C2v - C3v) : 0.0;
+      t[14][l] = p ? e * (-C1_ * w_ + C2w - C3w) : 0.0;
+      t[15][l] = p ? e * M33 : e;
+    }
+  }
+
+  //! As tran::deriv for the derivative dk[i0 + l] of one of the inputs
+  void deriv(muelmat_lanes &dt,
+             const muelmat_lanes &t,
+             const propmat_vector_const_view &k1,
+             const propmat_vector_const_view &k2,
+             const matpack::strided_view_t<const propmat, 1> &dk,
+             const Numeric r,
+             const Numeric dr,
+             const Size i0) const {
+    tran_lane da;
+    for (Size l = 0; l < n; l++) {
+      da[l] = -0.5 * (r * dk[i0 + l].A() +
+                      dr * (k1[i0 + l].A() + k2[i0 + l].A()));
+    }
+
+    if (not any_polarized) {
+      for (auto &lane : dt) lane.fill(0.0);
+      for (Size l = 0; l < n; l++) {
+        dt[0][l] = dt[5][l] = dt[10][l] = dt[15][l] = da[l] * exp_a[l];
+      }
+      return;
+    }
+
+    std::array<tran_lane, 6> dpol;
+    for (Size l = 0; l < n; l++) {
+      const propmat &p1 = k1[i0 + l];
+      const propmat &p2 = k2[i0 + l];
+      const propmat &q  = dk[i0 + l];
+
+      dpol[0][l] = -0.5 * (r * q.B() + dr * (p1.B() + p2.B()));
+      dpol[1][l] = -0.5 * (r * q.C() + dr * (p1.C() + p2.C()));
+      dpol[2][l] = -0.5 * (r * q.D() + dr * (p1.D() + p2.D()));
+      dpol[3][l] = -0.5 * (r * q.U() + dr * (p1.U() + p2.U()));
+      dpol[4][l] = -0.5 * (r * q.V() + dr * (p1.V() + p2.V()));
+      dpol[5][l] = -0.5 * (r * q.W() + dr * (p1.W() + p2.W()));
+    }
+
+#pragma omp simd
+    for (Size l = 0; l < n; l++) {
+      const Numeric b_ = b[l], c_ = c[l], d_ = d[l];
+      const Numeric u_ = u[l], v_ = v[l], w_ = w[l];
+      const Numeric db = dpol[0][l], dc = dpol[1][l], dd = dpol[2][l];
+      const Numeric du = dpol[3][l], dv = dpol[4][l], dw = dpol[5][l];
+
+      const Numeric db2 = 2 * db * b_;
+      const Numeric dc2 = 2 * dc * c_;
+      const Numeric dd2 = 2 * dd * d_;
+      const Numeric du2 = 2 * du * u_;
+      const Numeric dv2 = 2 * dv * v_;
+      const Numeric dw2 = 2 * dw * w_;
+
+      const Numeric dB = du2 + dv2 + dw2 - db2 - dc2 - dd2;
+      const Numeric dC =
+          -2 * (d_ * u_ - c_ * v_ + b_ * w_) *
+          (dd * u_ + d_ * du - dc * v_ - c_ * dv + db * w_ + b_ * dw);
+      const Numeric dS = (B[l] * dB - 2 * dC) / S[l];
+
+      const Numeric dx2 = 0.25 * (dS - dB) / x2[l];
+      const Numeric dy2 = 0.25 * (dS + dB) / y2[l];
+      const Numeric dx  = 0.5 * dx2 / x[l];
+      const Numeric dy  = 0.5 * dy2 / y[l];
+
+      const Numeric dcy    = -sy[l] * dy;
+      const Numeric dsy    = cy[l] * dy;
+      const Numeric dcx    = sx[l] * dx;
+      const Numeric dsx    = cx[l] * dx;
+      const Numeric dix    = -dx * ix[l] * ix[l];
+      const Numeric diy    = -dy * iy[l] * iy[l];
+      const Numeric dx2dy2 = dx2 + dy2;
+
+      const Numeric C0_ = C0[l], C1_ = C1[l], C2_ = C2[l], C3_ = C3[l];
+      const Numeric B_ = B[l];
+
+      const Numeric dC0 =
+          either_zero[l] ? 0.0
+                         : (dcy * x2[l] + cy[l] * dx2 + dcx * y2[l] +
+                            cx[l] * dy2 - C0_ * dx2dy2) *
+                               inv_x2y2[l];
+      const Numeric dC1 =
+          either_zero[l]
+              ? 0.0
+              : (dsy * x2[l] * iy[l] + sy[l] * dx2 * iy[l] +
+                 sy[l] * x2[l] * diy + dsx * y2[l] * ix[l] +
+                 sx[l] * dy2 * ix[l] + sx[l] * y2[l] * dix - C1_ * dx2dy2) *
+                    inv_x2y2[l];
+      const Numeric dC2 = both_zero[l]
+                              ? 0.0
+                              : ((x_zero[l] ? 0.0 : (dcx - C2_ * dx2)) -
+                                 (y_zero[l] ? 0.0 : (dcy + C2_ * dy2))) *
+                                    inv_x2y2[l];
+      const Numeric dC3 =
+          both_zero[l]
+              ? 0.0
+              : ((x_zero[l] ? 0.0 : (dsx * ix[l] + sx[l] * dix - C3_ * dx2)) -
+                 (y_zero[l] ? 0.0 : (dsy * iy[l] + sy[l] * diy + C3_ * dy2))) *
+                    inv_x2y2[l];
+
+      const Numeric dC2b = dC2 * (c_ * u_ + d_ * v_) +
+                           C2_ * (dc * u_ + c_ * du + dd * v_ + d_ * dv);
+      const Numeric dC2c = dC2 * (b_ * u_ - d_ * w_) +
+                           C2_ * (db * u_ + b_ * du - dd * w_ - d_ * dw);
+      const Numeric dC2d = dC2 * (b_ * v_ + c_ * w_) +
+                           C2_ * (db * v_ + b_ * dv + dc * w_ + c_ * dw);
+      const Numeric dC2u = dC2 * (b_ * c_ - v_ * w_) +
+                           C2_ * (db * c_ + b_ * dc - dv * w_ - v_ * dw);
+      const Numeric dC2v = dC2 * (b_ * d_ + u_ * w_) +
+                           C2_ * (db * d_ + b_ * dd + du * w_ + u_ * dw);
+      const Numeric dC2w = dC2 * (c_ * d_ - u_ * v_) +
+                           C2_ * (dc * d_ + c_ * dd - du * v_ - u_ * dv);
+
+      const Numeric dC3b =
+          dC3 * (b_ * (B_ - w2[l]) + w_ * (c_ * v_ - d_ * u_)) +
+          C3_ * (db * (B_ - w2[l]) + b_ * (dB - dw2) +
+                 dw * (c_ * v_ - d_ * u_) +
+                 w_ * (dc * v_ + c_ * dv - dd * u_ - d_ * du));
+      const Numeric dC3c =
+          dC3 * (c_ * (v2[l] - B_) - v_ * (d_ * u_ + b_ * w_)) +
+          C3_ * (dc * (v2[l] - B_) + c_ * (dv2 - dB) -
+                 dv * (d_ * u_ + b_ * w_) -
+                 v_ * (dd * u_ + d_ * du + db * w_ + b_ * dw));
+      const Numeric dC3d =
+          dC3 * (d_ * (u2[l] - B_) - u_ * (c_ * v_ - b_ * w_)) +
+          C3_ * (dd * (u2[l] - B_) + d_ * (du2 - dB) -
+                 du * (c_ * v_ - b_ * w_) -
+                 u_ * (dc * v_ + c_ * dv - db * w_ - b_ * dw));
+      const Numeric dC3u =
+          dC3 * (d_ * (c_ * v_ - b_ * w_) - u_ * (B_ + d2[l])) +
+          C3_ * (dd * (c_ * v_ - b_ * w_) +
+                 d_ * (dc * v_ + c_ * dv - db * w_ - b_ * dw) -
+                 du * (B_ + d2[l]) - u_ * (dB + dd2));
+      const Numeric dC3v =
+          dC3 * (c_ * (d_ * u_ + b_ * w_) - v_ * (B_ + c2[l])) +
+          C3_ * (dc * (d_ * u_ + b_ * w_) +
+                 c_ * (dd * u_ + d_ * du + db * w_ + b_ * dw) -
+                 dv * (B_ + c2[l]) - v_ * (dB + dc2));
+      const Numeric dC3w =
+          dC3 * (b_ * (c_ * v_ - d_ * u_) - w_ * (B_ + b2[l])) +
+          C3_ * (db * (c_ * v_ - d_ * u_) +
+                 b_ * (dc * v_ + c_ * dv - dd * u_ - d_ * du) -
+                 dw * (B_ + b2[l]) - w_ * (dB + db2));
+
+      const Numeric dM00 =
+          dC0 + dC2 * (b2[l] + c2[l] + d2[l]) + C2_ * (db2 + dc2 + dd2);
+      const Numeric dM11 =
+          dC0 + dC2 * (b2[l] - u2[l] - v2[l]) + C2_ * (db2 - du2 - dv2);
+      const Numeric dM22 =
+          dC0 + dC2 * (c2[l] - u2[l] - w2[l]) + C2_ * (dc2 - du2 - dw2);
+      const Numeric dM33 =
+          dC0 + dC2 * (d2[l] - v2[l] - w2[l]) + C2_ * (dd2 - dv2 - dw2);
+
+      const std::array<Numeric, 16> dm{
+          dM00,
+          dC1 * b_ + C1_ * db - dC2b - dC3b,
+          dC1 * c_ + C1_ * dc + dC2c + dC3c,
+          dC1 * d_ + C1_ * dd + dC2d + dC3d,
+          dC1 * b_ + C1_ * db + dC2b - dC3b,
+          dM11,
+          dC1 * u_ + C1_ * du + dC2u + dC3u,
+          dC1 * v_ + C1_ * dv + dC2v + dC3v,
+          dC1 * c_ + C1_ * dc - dC2c + dC3c,
+          -dC1 * u_ - C1_ * du + dC2u - dC3u,
+          dM22,
+          dC1 * w_ + C1_ * dw + dC2w + dC3w,
+          dC1 * d_ + C1_ * dd - dC2d + dC3d,
+          -dC1 * v_ - C1_ * dv + dC2v - dC3v,
+          -dC1 * w_ - C1_ * dw + dC2w - dC3w,
+          dM33};
+
+      const bool p    = polarized[l];
+      const Numeric e = exp_a[l];
+      for (Size k = 0; k < 16; k++) {
+        const Numeric diag = (k % 5 == 0) ? da[l] * e : 0.0;
+        dt[k][l]           = p ? da[l] * t[k][l] + e * dm[k] : diag;
+      }
+    }
+  }
+
+  //! The tran of lane l, for the branches that are not vectorized
+  [[nodiscard]] tran lane(const Size l) const {
+    tran t;
+    t.a         = a[l];
+    t.exp_a     = exp_a[l];
+    t.polarized = polarized[l];
+    if (not t.polarized) return t;
+
+    t.x_zero      = x_zero[l];
+    t.y_zero      = y_zero[l];
+    t.both_zero   = both_zero[l];
+    t.either_zero = either_zero[l];
+    t.b           = b[l];
+    t.c           = c[l];
+    t.d           = d[l];
+    t.u           = u[l];
+    t.v           = v[l];
+    t.w           = w[l];
+    t.b2          = b2[l];
+    t.c2          = c2[l];
+    t.d2          = d2[l];
+    t.u2          = u2[l];
+    t.v2          = v2[l];
+    t.w2          = w2[l];
+    t.B           = B[l];
+    t.C           = -Math::pow2(d[l] * u[l] - c[l] * v[l] + b[l] * w[l]);
+    t.S           = S[l];
+    t.x2          = x2[l];
+    t.y2          = y2[l];
+    t.x           = x[l];
+    t.y           = y[l];
+    t.cy          = cy[l];
+    t.sy          = sy[l];
+    t.cx          = cx[l];
+    t.sx          = sx[l];
+    t.ix          = ix[l];
+    t.iy          = iy[l];
+    t.inv_x2y2    = inv_x2y2[l];
+    t.C0          = C0[l];
+    t.C1          = C1[l];
+    t.C2          = C2[l];
+    t.C3          = C3[l];
+    return t;
+  }
+
+  //! As tran::linsrc
+  void linsrc(muelmat_lanes &lam) const {
+    for (auto &m : lam) m.fill(0.0);
+
+#pragma omp simd
+    for (Size l = 0; l < n; l++) {
+      const Numeric z = a[l];
+      const Numeric F =
+          std::abs(z) < 1e-8 ? 1.0 + z * 0.5 + z * z / 6.0 : std::expm1(z) / z;
+      lam[0][l] = lam[5][l] = lam[10][l] = lam[15][l] = F;
+    }
+
+    if (not any_polarized) return;
+
+    for (Size l = 0; l < n; l++) {
+      if (polarized[l]) put(lam, l, lane(l).linsrc());
+    }
+  }
+
+  //! As tran::linsrc_deriv for the derivative dk[i0 + l] of one of the inputs
+  void linsrc_deriv(muelmat_lanes &dlam,
+                    const matpack::strided_view_t<const propmat, 1> &dk,
+                    const Numeric r,
+                    const Numeric dr,
+                    const Size i0) const {
+    const Numeric inv_r = (std::abs(r) > 1e-20) ? 1.0 / r : 0.0;
+    const Numeric dr_r  = dr * inv_r;
+
+    tran_lane dka;
+    for (Size l = 0; l < n; l++) dka[l] = dk[i0 + l].A();
+
+    for (auto &m : dlam) m.fill(0.0);
+
+#pragma omp simd
+    for (Size l = 0; l < n; l++) {
+      const Numeric z  = a[l];
+      const Numeric da = dr_r * z - 0.5 * r * dka[l];
+      const Numeric Fp = std::abs(z) < too_small
+                             ? 0.5 + z / 3.0 + z * z / 8.0
+                             : (std::exp(z) * (z - 1.0) + 1.0) / (z * z);
+      dlam[0][l] = dlam[5][l] = dlam[10][l] = dlam[15][l] = Fp * da;
+    }
+
+    if (not any_polarized) return;
+
+    for (Size l = 0; l < n; l++) {
+      if (polarized[l]) put(dlam, l, lane(l).linsrc_deriv(dk[i0 + l], r, dr));
+    }
+  }
+
+  /*! As tran::linsrc_linprop, given lam from linsrc
+
+    Only the lanes with a positive gradient of the absorption are changed,
+    the others keep the linear source.
+  */
+  void linprop(muelmat_lanes &lam,
+               const muelmat_lanes &t,
+               const propmat_vector_const_view &k1,
+               const propmat_vector_const_view &k2,
+               const Numeric r,
+               const Size i0) const {
+    for (Size l = 0; l < n; l++) {
+      const propmat &p1 = k1[i0 + l];
+      const propmat &p2 = k2[i0 + l];
+      if ((p2.A() - p1.A()) / (2.0 * r) < 1e-8) continue;
+      put(lam, l, lane(l).linsrc_linprop(load(t, l), p1, p2, r));
+    }
+  }
+
+  /*! As tran::linsrc_linprop_deriv, given dlam from linsrc_deriv
+
+    Only the lanes with a positive gradient of the absorption are changed.
+  */
+  void linprop_deriv(muelmat_lanes &dlam,
+                     const muelmat_lanes &lam,
+                     const muelmat_lanes &t,
+                     const muelmat_lanes &dt,
+                     const propmat_vector_const_view &k1,
+                     const propmat_vector_const_view &k2,
+                     const matpack::strided_view_t<const propmat, 1> &dk,
+                     const Numeric r,
+                     const Numeric dr,
+                     const Size i0,
+                     const bool k1_deriv) const {
+    for (Size l = 0; l < n; l++) {
+      const propmat &p1 = k1[i0 + l];
+      const propmat &p2 = k2[i0 + l];
+      if ((p2.A() - p1.A()) / (2.0 * r) < 1e-8) continue;
+      put(dlam,
+          l,
+          lane(l).linsrc_linprop_deriv(load(lam, l),
+                                       load(t, l),
+                                       p1,
+                                       p2,
+                                       dk[i0 + l],
+                                       load(dt, l),
+                                       r,
+                                       dr,
+                                       k1_deriv));
+    }
+  }
+
+  static muelmat load(const muelmat_lanes &m, const Size l) {
+    muelmat out;
+    for (Size k = 0; k < 16; k++) out.data[k] = m[k][l];
+    return out;
+  }
+
+  static void put(muelmat_lanes &m, const Size l, const muelmat &x) {
+    for (Size k = 0; k < 16; k++) m[k][l] = x.data[k];
+  }
+};
+
+void store(matpack::strided_view_t<muelmat, 1> out,
+           const muelmat_lanes &m,
+           const Size i0,
+           const Size n) {
+  for (Size l = 0; l < n; l++) {
+    auto &o = out[i0 + l];
+    for (Size k = 0; k < 16; k++) o.data[k] = m[k][l];
+  }
+}
+}  // namespace
+
+void tran_batch(matpack::strided_view_t<muelmat, 1> T,
+                matpack::strided_view_t<muelmat, 2> dT1,
+                matpack::strided_view_t<muelmat, 2> dT2,
+                const propmat_vector_const_view &k1,
+                const propmat_vector_const_view &k2,
+                const matpack::strided_view_t<const propmat, 2> &dk1,
+                const matpack::strided_view_t<const propmat, 2> &dk2,
+                const Numeric r,
+                const ConstVectorView &dr1,
+                const ConstVectorView &dr2) {
+  const Size nf = T.size();
+  const Size nq = dr1.size();
+
+  assert(k1.size() == nf and k2.size() == nf);
+  assert(static_cast<Size>(dT1.nrows()) == nf and
+         static_cast<Size>(dT1.ncols()) == nq);
+  assert(dT1.shape() == dT2.shape());
+  assert(static_cast<Size>(dk1.nrows()) == nq and
+         static_cast<Size>(dk1.ncols()) == nf);
+  assert(dk1.shape() == dk2.shape());
+  assert(dr2.size() == nq);
+
+  tran_lanes s;
+  muelmat_lanes t, dt;
+
+  for (Size i0 = 0; i0 < nf; i0 += tran_chunk) {
+    s.n = std::min(tran_chunk, nf - i0);
+    s.set(k1, k2, r, i0);
+
+    s.transmission(t);
+    store(T, t, i0, s.n);
+
+    for (Size iq = 0; iq < nq; iq++) {
+      s.deriv(dt, t, k1, k2, dk1[iq], r, dr1[iq], i0);
+      store(dT1[joker, iq], dt, i0, s.n);
+
+      s.deriv(dt, t, k1, k2, dk2[iq], r, dr2[iq], i0);
+      store(dT2[joker, iq], dt, i0, s.n);
+    }
+  }
+}
+
+void tran_batch(matpack::strided_view_t<muelmat, 1> T,
+                matpack::strided_view_t<muelmat, 2> dT1,
+                matpack::strided_view_t<muelmat, 2> dT2,
+                matpack::strided_view_t<muelmat, 1> L,
+                matpack::strided_view_t<muelmat, 2> dL1,
+                matpack::strided_view_t<muelmat, 2> dL2,
+                const propmat_vector_const_view &k1,
+                const propmat_vector_const_view &k2,
+                const matpack::strided_view_t<const propmat, 2> &dk1,
+                const matpack::strided_view_t<const propmat, 2> &dk2,
+                const Numeric r,
+                const ConstVectorView &dr1,
+                const ConstVectorView &dr2,
+                const bool linprop) {
+  const Size nf = T.size();
+  const Size nq = dr1.size();
+
+  assert(k1.size() == nf and k2.size() == nf and L.size() == nf);
+  assert(static_cast<Size>(dT1.nrows()) == nf and
+         static_cast<Size>(dT1.ncols()) == nq);
+  assert(dT1.shape() == dT2.shape());
+  assert(dL1.shape() == dT1.shape() and dL2.shape() == dT1.shape());
+  assert(static_cast<Size>(dk1.nrows()) == nq and
+         static_cast<Size>(dk1.ncols()) == nf);
+  assert(dk1.shape() == dk2.shape());
+  assert(dr2.size() == nq);
+
+  tran_lanes s;
+  muelmat_lanes t, dt, lam, dlam;
+
+  for (Size i0 = 0; i0 < nf; i0 += tran_chunk) {
+    s.n = std::min(tran_chunk, nf - i0);
+    s.set(k1, k2, r, i0);
+
+    s.transmission(t);
+    store(T, t, i0, s.n);
+
+    s.linsrc(lam);
+    if (linprop) s.linprop(lam, t, k1, k2, r, i0);
+    store(L, lam, i0, s.n);
+
+    for (Size iq = 0; iq < nq; iq++) {
+      s.deriv(dt, t, k1, k2, dk1[iq], r, dr1[iq], i0);
+      store(dT1[joker, iq], dt, i0, s.n);
+
+      s.linsrc_deriv(dlam, dk1[iq], r, dr1[iq], i0);
+      if (linprop) {
+        s.linprop_deriv(
+            dlam, lam, t, dt, k1, k2, dk1[iq], r, dr1[iq], i0, true);
+      }
+      store(dL1[joker, iq], dlam, i0, s.n);
+
+      s.deriv(dt, t, k1, k2, dk2[iq], r, dr2[iq], i0);
+      store(dT2[joker, iq], dt, i0, s.n);
+
+      s.linsrc_deriv(dlam, dk2[iq], r, dr2[iq], i0);
+      if (linprop) {
+        s.linprop_deriv(
+            dlam, lam, t, dt, k1, k2, dk2[iq], r, dr2[iq], i0, false);
+      }
+      store(dL2[joker, iq], dlam, i0, s.n);
+    }
+  }
+}
+
 muelmat exp(propmat k, Numeric r) { return tran(k, k, r)(); }
 
 propmat logK(const muelmat &m) {
@@ -1117,44 +1737,40 @@ void TransmittanceMatrix::constant(const std::span<const propmat_vector> &K,
                                    const ConstTensor3View &dr) {
   const Size nf = dT.npages();
   const Size np = dT.nrows();
-  const Size nq = dT.ncols();
 
   auto dT0 = dT[0];
   auto dT1 = dT[1];
   auto dr0 = dr[0];
   auto dr1 = dr[1];
 
+  const Size nb = (nf + tran_chunk - 1) / tran_chunk;
+
 #pragma omp parallel for collapse(2) if (!arts_omp_in_parallel())
   for (Size i = 1; i < np; i++) {
-    for (Size iv = 0; iv < nf; ++iv) {
-      const tran tran_state{K[i - 1][iv], K[i][iv], r[i - 1]};
-      T[iv, i] = tran_state();
-
-      for (Size j = 0; j < nq; j++) {
-        dT0[iv, i - 1, j] = tran_state.deriv(T[iv, i],
-                                             K[i - 1][iv],
-                                             K[i][iv],
-                                             dK[i - 1][j, iv],
-                                             r[i - 1],
-                                             dr0[i - 1, j]);
-        dT1[iv, i, j]     = tran_state.deriv(T[iv, i],
-                                         K[i - 1][iv],
-                                         K[i][iv],
-                                         dK[i][j, iv],
-                                         r[i - 1],
-                                         dr1[i - 1, j]);
-      }
+    for (Size ib = 0; ib < nb; ib++) {
+      const Size f0 = ib * tran_chunk;
+      const Range f{f0, std::min(tran_chunk, nf - f0)};
+
+      tran_batch(T[f, i],
+                 dT0[f, i - 1, joker],
+                 dT1[f, i, joker],
+                 K[i - 1][f],
+                 K[i][f],
+                 dK[i - 1][joker, f],
+                 dK[i][joker, f],
+                 r[i - 1],
+                 dr0[i - 1],
+                 dr1[i - 1]);
     }
   }
 }
 
 void TransmittanceMatrix::linsrc(const std::span<const propmat_vector> &K,
-                                 const std::span<const propmat_matrix> &dK,
-                                 const ConstVectorView &r,
-                                 const ConstTensor3View &dr) {
+                                const std::span<const propmat_matrix> &dK,
+                                const ConstVectorView &r,
+                                const ConstTensor3View &dr) {
   const Size nf = dT.npages();
   const Size np = dT.nrows();
-  const Size nq = dT.ncols();
 
   auto dT0 = dT[0];
   auto dT1 = dT[1];
@@ -1163,42 +1779,38 @@ void TransmittanceMatrix::linsrc(const std::span<const propmat_vector> &K,
   auto dr0 = dr[0];
   auto dr1 = dr[1];
 
+  const Size nb = (nf + tran_chunk - 1) / tran_chunk;
+
 #pragma omp parallel for collapse(2) if (!arts_omp_in_parallel())
   for (Size i = 1; i < np; i++) {
-    for (Size iv = 0; iv < nf; ++iv) {
-      const tran tran_state{K[i - 1][iv], K[i][iv], r[i - 1]};
-      T[iv, i] = tran_state();
-      L[iv, i] = tran_state.linsrc();
-
-      for (Size j = 0; j < nq; j++) {
-        dT0[iv, i - 1, j] = tran_state.deriv(T[iv, i],
-                                             K[i - 1][iv],
-                                             K[i][iv],
-                                             dK[i - 1][j, iv],
-                                             r[i - 1],
-                                             dr0[i - 1, j]);
-        dT1[iv, i, j]     = tran_state.deriv(T[iv, i],
-                                         K[i - 1][iv],
-                                         K[i][iv],
-                                         dK[i][j, iv],
-                                         r[i - 1],
-                                         dr1[i - 1, j]);
-        dL0[iv, i - 1, j] =
-            tran_state.linsrc_deriv(dK[i - 1][j, iv], r[i - 1], dr0[i - 1, j]);
-        dL1[iv, i, j] =
-            tran_state.linsrc_deriv(dK[i][j, iv], r[i - 1], dr1[i - 1, j]);
-      }
+    for (Size ib = 0; ib < nb; ib++) {
+      const Size f0 = ib * tran_chunk;
+      const Range f{f0, std::min(tran_chunk, nf - f0)};
+
+      tran_batch(T[f, i],
+                 dT0[f, i - 1, joker],
+                 dT1[f, i, joker],
+                 L[f, i],
+                 dL0[f, i - 1, joker],
+                 dL1[f, i, joker],
+                 K[i - 1][f],
+                 K[i][f],
+                 dK[i - 1][joker, f],
+                 dK[i][joker, f],
+                 r[i - 1],
+                 dr0[i - 1],
+                 dr1[i - 1],
+                 false);
     }
   }
 }
 
 void TransmittanceMatrix::linprop(const std::span<const propmat_vector> &K,
-                                  const std::span<const propmat_matrix> &dK,
-                                  const ConstVectorView &r,
-                                  const ConstTensor3View &dr) {
+                                 const std::span<const propmat_matrix> &dK,
+                                 const ConstVectorView &r,
+                                 const ConstTensor3View &dr) {
   const Size nf = dT.npages();
   const Size np = dT.nrows();
-  const Size nq = dT.ncols();
 
   auto dT0 = dT[0];
   auto dT1 = dT[1];
@@ -1207,46 +1819,28 @@ void TransmittanceMatrix::linprop(const std::span<const propmat_vector> &K,
   auto dr0 = dr[0];
   auto dr1 = dr[1];
 
+  const Size nb = (nf + tran_chunk - 1) / tran_chunk;
+
 #pragma omp parallel for collapse(2) if (!arts_omp_in_parallel())
   for (Size i = 1; i < np; i++) {
-    for (Size iv = 0; iv < nf; ++iv) {
-      const tran tran_state{K[i - 1][iv], K[i][iv], r[i - 1]};
-      T[iv, i] = tran_state();
-      L[iv, i] =
-          tran_state.linsrc_linprop(T[iv, i], K[i - 1][iv], K[i][iv], r[i - 1]);
-
-      for (Size j = 0; j < nq; j++) {
-        dT0[iv, i - 1, j] = tran_state.deriv(T[iv, i],
-                                             K[i - 1][iv],
-                                             K[i][iv],
-                                             dK[i - 1][j, iv],
-                                             r[i - 1],
-                                             dr0[i - 1, j]);
-        dT1[iv, i, j]     = tran_state.deriv(T[iv, i],
-                                         K[i - 1][iv],
-                                         K[i][iv],
-                                         dK[i][j, iv],
-                                         r[i - 1],
-                                         dr1[i - 1, j]);
-        dL0[iv, i - 1, j] = tran_state.linsrc_linprop_deriv(L[iv, i],
-                                                            T[iv, i],
-                                                            K[i - 1][iv],
-                                                            K[i][iv],
-                                                            dK[i - 1][j, iv],
-                                                            dT0[iv, i - 1, j],
-                                                            r[i - 1],
-                                                            dr1[i - 1, j],
-                                                            true);
-        dL1[iv, i, j]     = tran_state.linsrc_linprop_deriv(L[iv, i],
-                                                        T[iv, i],
-                                                        K[i - 1][iv],
-                                                        K[i][iv],
-                                                        dK[i][j, iv],
-                                                        dT1[iv, i, j],
-                                                        r[i - 1],
-                                                        dr1[i - 1, j],
-                                                        false);
-      }
+    for (Size ib = 0; ib < nb; ib++) {
+      const Size f0 = ib * tran_chunk;
+      const Range f{f0, std::min(tran_chunk, nf - f0)};
+
+      tran_batch(T[f, i],
+                 dT0[f, i - 1, joker],
+                 dT1[f, i, joker],
+                 L[f, i],
+                 dL0[f, i - 1, joker],
+                 dL1[f, i, joker],
+                 K[i - 1][f],
+                 K[i][f],
+                 dK[i - 1][joker, f],
+                 dK[i][joker, f],
+                 r[i - 1],
+                 dr0[i - 1],
+                 dr1[i - 1],
+                 true);
     }
   }
 }
@@ -1273,6 +1867,7 @@ void TransmittanceMatrix::init(const std::span<const propmat_vector> &K,
     P.resize(P.nrows(), 0);
     dT.resize(nt, dT.npages(), 0, dT.ncols());
     dL.resize(nt, dL.npages(), 0, dL.ncols());
+    polarized = false;
     return;
   }
 
@@ -1313,6 +1908,14 @@ void TransmittanceMatrix::init(const std::span<const propmat_vector> &K,
       P.resize(nf, np);
   }
 
+  // Unpolarized K and dK only give scalar matrices, see tran
+  constexpr auto pol = [](const propmat &k) { return k.is_polarized(); };
+  polarized =
+      stdr::any_of(K, [&](auto &k) { return stdr::any_of(k, pol); }) or
+      stdr::any_of(dK, [&](auto &dk) {
+        return stdr::any_of(dk.elem_begin(), dk.elem_end(), pol);
+      });
+
   switch (option) {
     case TransmittanceOption::constant: constant(K, dK, r, dr); break;
     case TransmittanceOption::linsrc:   linsrc(K, dK, r, dr); break;
@@ -1321,8 +1924,16 @@ void TransmittanceMatrix::init(const std::span<const propmat_vector> &K,
 
   for (Size i = 0; i < nf; i++) {
     P[i, 0] = muelmat::id();
-    for (Size j = 1; j < np; j++) {
-      P[i, j] = P[i, j - 1] * T[i, j];
+    if (polarized) {
+      for (Size j = 1; j < np; j++) {
+        P[i, j] = P[i, j - 1] * T[i, j];
+      }
+    } else {
+      Numeric p = 1.0;
+      for (Size j = 1; j < np; j++) {
+        p       *= T[i, j][0, 0];
+        P[i, j]  = p;
+      }
     }
   }
 }
@@ -1375,6 +1986,12 @@ void TransmittanceMatrix::init(const std::span<const propmat> &K,
       P.resize(nf, np);
   }
 
+  // Unpolarized K and dK only give scalar matrices, see tran
+  constexpr auto pol = [](const propmat &k) { return k.is_polarized(); };
+  polarized =
+      stdr::any_of(K, pol) or
+      stdr::any_of(dK, [&](auto &dk) { return stdr::any_of(dk, pol); });
+
   switch (option) {
     case TransmittanceOption::constant: constant(K, dK, r, dr); break;
     case TransmittanceOption::linsrc:   linsrc(K, dK, r, dr); break;
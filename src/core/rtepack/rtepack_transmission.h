@@ -17,6 +17,14 @@ struct TransmittanceMatrix {
   muelmat_tensor4 dT{};
   muelmat_tensor4 dL{};
 
+  /*! Whether or not any of the matrices may mix the Stokes components
+
+    Set by init() from K and dK, whose unpolarized values only give scalar
+    matrices.  It is true unless init() found otherwise, so that matrices
+    that are set by other means are never treated as scalars.
+  */
+  bool polarized{true};
+
   void init(const std::span<const propmat_vector> &K,
             const std::span<const propmat_matrix> &dK,
             const ConstVectorView &r,
@@ -31,6 +39,13 @@ struct TransmittanceMatrix {
 
   void check(Size np, Size nq, Size nf, const std::string_view caller) const;
 
+  /*! Whether or not any of the matrices may mix the Stokes components
+
+    If not, all matrices are scalars times the identity matrix, and the
+    radiative transfer can be solved with scalar arithmetic.
+  */
+  [[nodiscard]] bool is_polarized() const { return polarized; }
+
   //! Should return nf, np, nq [unchecked]
   [[nodiscard]] std::array<Size, 3> shape() const noexcept;
 
@@ -108,6 +123,75 @@ struct tran {
                                              bool k1_deriv) const;
 };
 
+/*! The transmission matrices and their derivatives for many frequencies
+
+  Gives the same results as, for all iv and iq,
+
+    const tran tr{k1[iv], k2[iv], r};
+    T[iv]       = tr();
+    dT1[iv, iq] = tr.deriv(T[iv], k1[iv], k2[iv], dk1[iq, iv], r, dr1[iq]);
+    dT2[iv, iq] = tr.deriv(T[iv], k1[iv], k2[iv], dk2[iq, iv], r, dr2[iq]);
+
+  but the frequencies are evaluated in chunks, one array per member of tran,
+  so that the arithmetic is vectorized over the frequencies.  Chunks where
+  no frequency is polarized skip the polarized arithmetic.
+
+  @param[out] T The transmission matrices (nf)
+  @param[out] dT1 The derivatives with regards to the first level (nf, nq)
+  @param[out] dT2 The derivatives with regards to the second level (nf, nq)
+  @param[in] k1 The propagation matrices at the first level (nf)
+  @param[in] k2 The propagation matrices at the second level (nf)
+  @param[in] dk1 The propagation matrix derivatives at k1 (nq, nf)
+  @param[in] dk2 The propagation matrix derivatives at k2 (nq, nf)
+  @param[in] r The distance between the levels
+  @param[in] dr1 The derivatives of r with regards to the first level (nq)
+  @param[in] dr2 The derivatives of r with regards to the second level (nq)
+*/
+void tran_batch(matpack::strided_view_t<muelmat, 1> T,
+                matpack::strided_view_t<muelmat, 2> dT1,
+                matpack::strided_view_t<muelmat, 2> dT2,
+                const propmat_vector_const_view &k1,
+                const propmat_vector_const_view &k2,
+                const matpack::strided_view_t<const propmat, 2> &dk1,
+                const matpack::strided_view_t<const propmat, 2> &dk2,
+                const Numeric r,
+                const ConstVectorView &dr1,
+                const ConstVectorView &dr2);
+
+/*! As tran_batch above, but also the linear source matrices of the layer
+
+  Gives the same results as, for all iv and iq,
+
+    const tran tr{k1[iv], k2[iv], r};
+    L[iv]       = tr.linsrc();
+    dL1[iv, iq] = tr.linsrc_deriv(dk1[iq, iv], r, dr1[iq]);
+    dL2[iv, iq] = tr.linsrc_deriv(dk2[iq, iv], r, dr2[iq]);
+
+  or, if linprop is true, the same using tr.linsrc_linprop and
+  tr.linsrc_linprop_deriv.  The unpolarized linear source is vectorized over
+  the frequencies.  Polarized frequencies and the Dawson function of the
+  linear propagation matrix are evaluated lane by lane from the chunk state.
+
+  @param[out] L The linear source matrices (nf)
+  @param[out] dL1 The derivatives of L with regards to k1 (nf, nq)
+  @param[out] dL2 The derivatives of L with regards to k2 (nf, nq)
+  @param[in] linprop Whether to use the linear propagation matrix source
+*/
+void tran_batch(matpack::strided_view_t<muelmat, 1> T,
+                matpack::strided_view_t<muelmat, 2> dT1,
+                matpack::strided_view_t<muelmat, 2> dT2,
+                matpack::strided_view_t<muelmat, 1> L,
+                matpack::strided_view_t<muelmat, 2> dL1,
+                matpack::strided_view_t<muelmat, 2> dL2,
+                const propmat_vector_const_view &k1,
+                const propmat_vector_const_view &k2,
+                const matpack::strided_view_t<const propmat, 2> &dk1,
+                const matpack::strided_view_t<const propmat, 2> &dk2,
+                const Numeric r,
+                const ConstVectorView &dr1,
+                const ConstVectorView &dr2,
+                const bool linprop);
+
 muelmat exp(propmat k, Numeric r = 1.0);
 
 propmat logK(const muelmat &m);
@@ -143,7 +227,19 @@ struct std::formatter<TransmittanceMatrix> {
   FmtContext::iterator format(const TransmittanceMatrix &v,
                               FmtContext &ctx) const {
     const std::string_view sep = tags.sep();
-    return tags.format(
-        ctx, v.option, sep, v.T, sep, v.L, sep, v.P, sep, v.dT, sep, v.dL);
+    return tags.format(ctx,
+                       v.option,
+                       sep,
+                       v.T,
+                       sep,
+                       v.L,
+                       sep,
+                       v.P,
+                       sep,
+                       v.dT,
+                       sep,
+                       v.dL,
+                       sep,
+                       v.polarized);
   }
 };
@@ -175,6 +175,164 @@ Numeric test_transmittance_matrix_init_linprop(
 
   return sum;
 }
+
+//! The sum of the path data at a frequency, as read by the solver
+Numeric path_sum(const ConstVectorView& f,
+                 const PropmatConstVectorView& K,
+                 const StokvecConstVectorView& S,
+                 const PropmatConstMatrixView& dK,
+                 const StokvecConstMatrixView& dS) {
+  Numeric sum{};
+  for (Size i = 0; i < K.size(); i++) {
+    sum += f[i] + K[i].A() + S[i].I() + dK[i, 0].A() + dS[i, 0].I();
+  }
+  return sum;
+}
+
+//! Per-frequency gather of the path, as the point-major frequency loop did
+Numeric test_spectral_path_gather(const std::vector<AscendingGrid>& f,
+                                  const std::vector<PropmatVector>& K,
+                                  const std::vector<StokvecVector>& S,
+                                  const std::vector<PropmatMatrix>& dK,
+                                  const std::vector<StokvecMatrix>& dS) {
+  ARTS_NAMED_TIME_REPORT(std::format("test_spectral_path_gather; threads {}",
+                                     omp_get_max_threads()));
+
+  const Size np  = K.size();
+  const Size nf  = K.front().size();
+  const Index nq = dK.front().nrows();
+
+  Vector fs(np);
+  PropmatVector Ks(np);
+  StokvecVector Ss(np);
+  PropmatMatrix dKs(np, nq);
+  StokvecMatrix dSs(np, nq);
+
+  Numeric sum{};
+#pragma omp parallel for firstprivate(fs, Ks, Ss, dKs, dSs) reduction(+ : sum)
+  for (Size iv = 0; iv < nf; iv++) {
+    for (Size i = 0; i < np; i++) {
+      fs[i]  = f[i][iv];
+      Ks[i]  = K[i][iv];
+      Ss[i]  = S[i][iv];
+      dKs[i] = dK[i][joker, iv];
+      dSs[i] = dS[i][joker, iv];
+    }
+    sum += path_sum(fs, Ks, Ss, dKs, dSs);
+  }
+
+  return sum;
+}
+
+/*! The frequency-major path, as spectral_pathFromPath sets it
+
+  Each path point is written with set_point in parallel over the points,
+  as the points come out of the propagation matrix agenda, and the
+  frequency loop then reads contiguous rows.
+*/
+Numeric test_spectral_path_set_point(const std::vector<AscendingGrid>& f,
+                                     const std::vector<PropmatVector>& K,
+                                     const std::vector<StokvecVector>& S,
+                                     const std::vector<PropmatMatrix>& dK,
+                                     const std::vector<StokvecMatrix>& dS) {
+  ARTS_NAMED_TIME_REPORT(std::format(
+      "test_spectral_path_set_point; threads {}", omp_get_max_threads()));
+
+  const Size np = K.size();
+  const Size nf = K.front().size();
+  const Size nq = static_cast<Size>(dK.front().nrows());
+
+  SpectralPath path;
+
+  {
+    ARTS_NAMED_TIME_REPORT(
+        std::format("test_spectral_path_set_point:set; threads {}",
+                    omp_get_max_threads()));
+
+    path.resize(nf, np, nq);
+
+#pragma omp parallel for
+    for (Size ip = 0; ip < np; ip++) {
+      path.set_point(ip, f[ip], K[ip], S[ip], dK[ip], dS[ip]);
+    }
+  }
+
+  Numeric sum{};
+
+  {
+    ARTS_NAMED_TIME_REPORT(
+        std::format("test_spectral_path_set_point:read; threads {}",
+                    omp_get_max_threads()));
+
+#pragma omp parallel for reduction(+ : sum)
+    for (Size iv = 0; iv < nf; iv++) {
+      sum += path_sum(path.freq[iv],
+                      path.propmat[iv],
+                      path.nlte[iv],
+                      path.propmat_jac[iv],
+                      path.nlte_jac[iv]);
+    }
+  }
+
+  return sum;
+}
+
+//! tran and tran::deriv per frequency, as before tran_batch
+Numeric test_tran_loop(MuelmatVector& T,
+                       MuelmatMatrix& dT1,
+                       MuelmatMatrix& dT2,
+                       const PropmatVector& k1,
+                       const PropmatVector& k2,
+                       const PropmatMatrix& dk1,
+                       const PropmatMatrix& dk2,
+                       const Vector& dr1,
+                       const Vector& dr2) {
+  ARTS_NAMED_TIME_REPORT("test_tran_loop");
+
+  for (Size iv = 0; iv < T.size(); iv++) {
+    const rtepack::tran tr{k1[iv], k2[iv], 1.0};
+    T[iv] = tr();
+    for (Size iq = 0; iq < dr1.size(); iq++) {
+      dT1[iv, iq] = tr.deriv(T[iv], k1[iv], k2[iv], dk1[iq, iv], 1.0, dr1[iq]);
+      dT2[iv, iq] = tr.deriv(T[iv], k1[iv], k2[iv], dk2[iq, iv], 1.0, dr2[iq]);
+    }
+  }
+
+  return T[0][0, 0];
+}
+
+//! The same as test_tran_loop, in frequency batches
+Numeric test_tran_batch(MuelmatVector& T,
+                        MuelmatMatrix& dT1,
+                        MuelmatMatrix& dT2,
+                        const PropmatVector& k1,
+                        const PropmatVector& k2,
+                        const PropmatMatrix& dk1,
+                        const PropmatMatrix& dk2,
+                        const Vector& dr1,
+                        const Vector& dr2) {
+  ARTS_NAMED_TIME_REPORT("test_tran_batch");
+
+  rtepack::tran_batch(T, dT1, dT2, k1, k2, dk1, dk2, 1.0, dr1, dr2);
+
+  return T[0][0, 0];
+}
+
+//! The largest relative difference between the elements of a and b
+Numeric max_rel_diff(const auto& a, const auto& b) {
+  Numeric out = 0.0;
+  auto ai     = a.elem_begin();
+  for (auto bi = b.elem_begin(); bi != b.elem_end(); ++ai, ++bi) {
+    for (Size i = 0; i < 4; i++) {
+      for (Size j = 0; j < 4; j++) {
+        const Numeric x = (*ai)[i, j];
+        const Numeric y = (*bi)[i, j];
+        out = std::max(out, std::abs(x - y) / std::max(std::abs(x), 1e-300));
+      }
+    }
+  }
+  return out;
+}
 }  // namespace
 
 int main() {
@@ -238,6 +396,89 @@ int main() {
     arts_omp_set_num_threads(x);
   }
 
+  {
+    constexpr Index M = 200;
+    constexpr Index N = 20'000;
+    constexpr Index P = 4;
+
+    std::vector<AscendingGrid> f(M, AscendingGrid{nlinspace(1e9, 1e12, N)});
+
+    std::vector<PropmatVector> K(M, PropmatVector(N));
+    std::vector<StokvecVector> S(M, StokvecVector(N));
+    std::vector<PropmatMatrix> dK(M, PropmatMatrix(P, N));
+    std::vector<StokvecMatrix> dS(M, StokvecMatrix(P, N));
+    for (Index i = 0; i < M; i++) {
+      MatrixView Kv{
+          MatrixView::base{reinterpret_cast<Numeric*>(K[i].data_handle()),
+                           std::array<Index, 2>{N, 7}}};
+      random_numbers(Kv, 0.0, 1.0);
+
+      Tensor3View dKv{
+          Tensor3View::base{reinterpret_cast<Numeric*>(dK[i].data_handle()),
+                            std::array<Index, 3>{P, N, 7}}};
+      random_numbers(dKv, 0.0, 1.0);
+    }
+
+    // Bytes of path data read per pass; the gather reads them with a stride
+    // of one frequency per path point, the frequency-major path reads rows
+    const Size bytes = M * N * (1 + 7 + 4 + P * (7 + 4)) * sizeof(Numeric);
+    std::println(std::cerr, "spectral path size: {} MB", bytes / 1'000'000);
+
+    const Numeric gather    = test_spectral_path_gather(f, K, S, dK, dS);
+    const Numeric set_point = test_spectral_path_set_point(f, K, S, dK, dS);
+    std::println(std::cerr,
+                 "spectral path relative difference: {}",
+                 std::abs(gather - set_point) / std::abs(gather));
+    buf += gather + set_point;
+
+    const int x = arts_omp_get_max_threads();
+    arts_omp_set_num_threads(1);
+
+    buf += test_spectral_path_gather(f, K, S, dK, dS);
+    buf += test_spectral_path_set_point(f, K, S, dK, dS);
+
+    arts_omp_set_num_threads(x);
+  }
+
+  for (const bool polarized : {true, false}) {
+    constexpr Index N = 1'000'000;
+    constexpr Index P = 4;
+
+    PropmatVector k1(N), k2(N);
+    PropmatMatrix dk1(P, N), dk2(P, N);
+    for (auto* k : {&k1, &k2}) {
+      MatrixView Kv{
+          MatrixView::base{reinterpret_cast<Numeric*>(k->data_handle()),
+                           std::array<Index, 2>{N, 7}}};
+      random_numbers(Kv, 0.0, 1.0);
+      if (not polarized) Kv[joker, Range(1, 6)] = 0.0;
+    }
+    for (auto* k : {&dk1, &dk2}) {
+      Tensor3View dKv{
+          Tensor3View::base{reinterpret_cast<Numeric*>(k->data_handle()),
+                            std::array<Index, 3>{P, N, 7}}};
+      random_numbers(dKv, 0.0, 1.0);
+    }
+    const Vector dr1 = random_numbers<1>({P});
+    const Vector dr2 = random_numbers<1>({P});
+
+    MuelmatVector T_loop(N), T_batch(N);
+    MuelmatMatrix dT1_loop(N, P), dT2_loop(N, P), dT1_batch(N, P),
+        dT2_batch(N, P);
+
+    buf += test_tran_loop(
+        T_loop, dT1_loop, dT2_loop, k1, k2, dk1, dk2, dr1, dr2);
+    buf += test_tran_batch(
+        T_batch, dT1_batch, dT2_batch, k1, k2, dk1, dk2, dr1, dr2);
+
+    std::println(std::cerr,
+                 "tran_batch (polarized: {}) max relative difference: {} {} {}",
+                 polarized,
+                 max_rel_diff(T_loop, T_batch),
+                 max_rel_diff(dT1_loop, dT1_batch),
+                 max_rel_diff(dT2_loop, dT2_batch));
+  }
+
   std::println(std::cerr, "Prevent optimizing away: {}", buf);
   arts::print_report();
 }
\ No newline at end of file
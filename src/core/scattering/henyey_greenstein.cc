@@ -5,6 +5,37 @@
 #include "math_funcs.h"
 
 namespace scattering {
+namespace {
+/*! The extinction and single scattering albedo at all frequencies
+
+  In a single call of the batch function of the callback if it has one.
+*/
+std::pair<Vector, Vector> ext_ssa_grid(const ExtSSACallback& ext_ssa_callback,
+                                       const Vector& f_grid,
+                                       const AtmPoint& atm_point) {
+  const Size nf = f_grid.size();
+
+  if (ext_ssa_callback.batch) {
+    auto out = ext_ssa_callback.batch(f_grid, atm_point);
+    ARTS_USER_ERROR_IF(
+        out.first.size() != nf or out.second.size() != nf,
+        "The batch callback gave {} extinction and {} ssa values for {} "
+        "frequencies",
+        out.first.size(),
+        out.second.size(),
+        nf)
+    return out;
+  }
+
+  std::pair<Vector, Vector> out{Vector(nf), Vector(nf)};
+  for (Size f_ind = 0; f_ind < nf; ++f_ind) {
+    std::tie(out.first[f_ind], out.second[f_ind]) =
+        ext_ssa_callback(f_grid[f_ind], atm_point);
+  }
+  return out;
+}
+}  // namespace
+
 ExtinctionSSALookup::ExtinctionSSALookup(
     ScatteringSpeciesProperty extinction_field_,
     ScatteringSpeciesProperty ssa_field_)
@@ -53,10 +84,12 @@ HenyeyGreensteinScatterer::get_bulk_scattering_properties_tro_gridded(
       t_grid, f_grid_ptr};
 
   auto zenith_angles = grid_vector(*zenith_angle_grid);
+
+  const auto [ext, alb] = ext_ssa_grid(ext_ssa_callback, f_grid, atm_point);
   for (Size f_ind = 0; f_ind < f_grid.size(); ++f_ind) {
-    float extinction, ssa;
-    std::tie(extinction, ssa) = ext_ssa_callback(f_grid[f_ind], atm_point);
-    float scattering_xsec     = extinction * ssa;
+    float extinction      = ext[f_ind];
+    float ssa             = alb[f_ind];
+    float scattering_xsec = extinction * ssa;
 
     emd[0, f_ind, 0] = extinction;
     av[0, f_ind, 0]  = extinction - scattering_xsec;
@@ -90,9 +123,10 @@ HenyeyGreensteinScatterer::get_bulk_scattering_properties_tro_spectral(
     f[ind] *= std::sqrt(2 * ind + 1) * std::pow(g, ind);
   }
 
+  const auto [ext, alb] = ext_ssa_grid(ext_ssa_callback, f_grid, atm_point);
   for (Size f_ind = 0; f_ind < f_grid.size(); ++f_ind) {
-    const auto [extinction, ssa] = ext_ssa_callback(f_grid[f_ind], atm_point);
-    const auto scattering_xsec   = extinction * ssa;
+    const Numeric extinction      = ext[f_ind];
+    const Numeric scattering_xsec = extinction * alb[f_ind];
 
     for (Index ind = 0; ind <= l; ++ind) {
       for (Index i = 0; i < 4; i++)
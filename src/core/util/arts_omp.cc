@@ -36,11 +36,15 @@ int arts_omp_get_max_threads() {
 /*! 
   This wrapper works with and without OMP support.
 
+  A parallel region nested as deep as the maximum number of active levels
+  allows runs on a single thread, so it counts as running parallelized.
+  With the default of one active level, this is omp_in_parallel().
+
   \return Returns true if the current region is running parallelized.
 */
 bool arts_omp_in_parallel() {
 #ifdef _OPENMP
-  return omp_in_parallel();
+  return omp_get_active_level() >= omp_get_max_active_levels();
 #else
   return false;
 #endif
@@ -113,6 +117,32 @@ void arts_omp_set_dynamic(int i [[maybe_unused]]) {
 #endif
 }
 
+//! Wrapper for omp_get_max_active_levels
+/*! 
+  This wrapper works with and without OMP support.
+
+  \return The maximum number of nested active parallel regions, or 1 without OMP.
+*/
+int arts_omp_get_max_active_levels() {
+#ifdef _OPENMP
+  return omp_get_max_active_levels();
+#else
+  return 1;
+#endif
+}
+
+//! Wrapper for omp_set_max_active_levels
+/*! 
+  This wrapper works with and without OMP support.
+
+  \param i The maximum number of nested active parallel regions.
+*/
+void arts_omp_set_max_active_levels(int i [[maybe_unused]]) {
+#ifdef _OPENMP
+  omp_set_max_active_levels(i);
+#endif
+}
+
 /*! Wrapper to determinie if parallel execution should be used.
 
   This wrapper works with and without OMP support.
@@ -35,6 +35,10 @@ void arts_omp_set_nested(int i);
 
 void arts_omp_set_dynamic(int i);
 
+int arts_omp_get_max_active_levels();
+
+void arts_omp_set_max_active_levels(int i);
+
 bool arts_omp_parallel(unsigned long long n = -1, bool additional_condition=true);
 
 #endif  // arts_omp_h
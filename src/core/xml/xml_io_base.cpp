@@ -18,10 +18,13 @@
 #include <file.h>
 
 #include <format>
+#include <fstream>
 #include <iomanip>
 #include <stdexcept>
 #include <string_view>
 
+#include "xml_io_buffer.h"
+
 constexpr Index ARTS_XML_VERSION = 3;
 
 namespace {
@@ -726,10 +729,21 @@ void parse_xml_tag_content_as_string(std::istream& is_xml, String& content) {
   if (!is_xml) throw std::runtime_error("Unexpected end of file.");
 }
 
-std::stringstream xml_read_from_file_base_buffer(const String& filename) {
+std::unique_ptr<std::istream> xml_read_from_file_base_buffer(
+    const String& filename) {
+  const bool zipped =
+      filename.size() > 2 && filename.substr(filename.length() - 3, 3) == ".gz";
+
+  // Plain files are parsed directly from the mapped file
+  if (not zipped) {
+    if (auto mapped = xml_memory_buffer::map(filename)) {
+      return std::make_unique<xml_memory_stream>(std::move(mapped));
+    }
+  }
+
   // Open input stream:
   std::unique_ptr<std::istream> ifs;
-  if (filename.size() > 2 && filename.substr(filename.length() - 3, 3) == ".gz")
+  if (zipped)
 #ifdef ENABLE_ZLIB
   {
     ifs = std::make_unique<igzstream>();
@@ -749,10 +763,11 @@ std::stringstream xml_read_from_file_base_buffer(const String& filename) {
 
   // Read the file into memory first to significantly speed up
   // the parsing (13x to 18x faster).
-  std::stringstream buffer;
+  std::ostringstream buffer;
   buffer << ifs->rdbuf();
 
-  return buffer;
+  return std::make_unique<xml_memory_stream>(
+      std::make_unique<xml_memory_buffer>(std::move(buffer).str()));
 }
 
 XMLStreamHandler::XMLStreamHandler(const String& filename,
@@ -207,7 +207,8 @@ struct XMLStreamHandler {
   operator bifstream*() { return bifs.get(); }
 };
 
-std::stringstream xml_read_from_file_base_buffer(const String& filename);
+std::unique_ptr<std::istream> xml_read_from_file_base_buffer(
+    const String& filename);
 
 //! Reads data from XML file
 /*!
@@ -222,10 +223,10 @@ void xml_read_from_file_base(const String& filename, T& type) try {
   ARTS_NAMED_TIME_REPORT("XmlRead of " +
                          std::string{xml_io_stream<T>::type_name})
 
-  std::stringstream buffer = xml_read_from_file_base_buffer(filename);
-  XMLStreamHandler xsh{filename, buffer};
-  xml_io_stream<T>::read(buffer, type, xsh);
-  xml_read_footer_from_stream(buffer);
+  const auto buffer = xml_read_from_file_base_buffer(filename);
+  XMLStreamHandler xsh{filename, *buffer};
+  xml_io_stream<T>::read(*buffer, type, xsh);
+  xml_read_footer_from_stream(*buffer);
 } catch (const std::runtime_error& e) {
   throw std::runtime_error(std::format(
       "Cannot read file with full filename: \"{}\":\n{}", filename, e.what()));
@@ -244,10 +245,10 @@ void xml_extend_from_file_base(const String& filename, T& type) try {
   ARTS_NAMED_TIME_REPORT("XmlExtend of " +
                          std::string{xml_io_stream<T>::type_name})
 
-  std::stringstream buffer = xml_read_from_file_base_buffer(filename);
-  XMLStreamHandler xsh{filename, buffer};
-  xml_io_stream<T>::extend(buffer, type, xsh);
-  xml_read_footer_from_stream(buffer);
+  const auto buffer = xml_read_from_file_base_buffer(filename);
+  XMLStreamHandler xsh{filename, *buffer};
+  xml_io_stream<T>::extend(*buffer, type, xsh);
+  xml_read_footer_from_stream(*buffer);
 } catch (const std::runtime_error& e) {
   throw std::runtime_error(std::format(
       "Cannot extend file with full filename: \"{}\":\n{}", filename, e.what()));
@@ -266,10 +267,10 @@ void xml_append_from_file_base(const String& filename, T& type) try {
   ARTS_NAMED_TIME_REPORT("XmlAppend of " +
                          std::string{xml_io_stream<T>::type_name})
 
-  std::stringstream buffer = xml_read_from_file_base_buffer(filename);
-  XMLStreamHandler xsh{filename, buffer};
-  xml_io_stream<T>::append(buffer, type, xsh);
-  xml_read_footer_from_stream(buffer);
+  const auto buffer = xml_read_from_file_base_buffer(filename);
+  XMLStreamHandler xsh{filename, *buffer};
+  xml_io_stream<T>::append(*buffer, type, xsh);
+  xml_read_footer_from_stream(*buffer);
 } catch (const std::runtime_error& e) {
   throw std::runtime_error(std::format(
       "Cannot append file with full filename: \"{}\":\n{}", filename, e.what()));
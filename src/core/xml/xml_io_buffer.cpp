@@ -0,0 +1,83 @@
+#include "xml_io_buffer.h"
+
+#include <algorithm>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ARTS_XML_MMAP 1
+#endif
+
+xml_memory_buffer::xml_memory_buffer(std::string content)
+    : owned(std::move(content)) {
+  setg(owned.data(), owned.data(), owned.data() + owned.size());
+}
+
+xml_memory_buffer::xml_memory_buffer(void* data, Size size)
+    : mapped(data), mapped_size(size) {
+  char* p = static_cast<char*>(mapped);
+  setg(p, p, p + mapped_size);
+}
+
+std::unique_ptr<xml_memory_buffer> xml_memory_buffer::map(
+    const String& filename [[maybe_unused]]) {
+#ifdef ARTS_XML_MMAP
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) return nullptr;
+
+  struct stat st {};
+  if (::fstat(fd, &st) != 0 or not S_ISREG(st.st_mode) or st.st_size <= 0) {
+    ::close(fd);
+    return nullptr;
+  }
+
+  const auto size = static_cast<Size>(st.st_size);
+  void* data      = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED) return nullptr;
+
+  ::madvise(data, size, MADV_WILLNEED);
+
+  return std::unique_ptr<xml_memory_buffer>(new xml_memory_buffer(data, size));
+#else
+  return nullptr;
+#endif
+}
+
+xml_memory_buffer::~xml_memory_buffer() {
+#ifdef ARTS_XML_MMAP
+  if (mapped) ::munmap(mapped, mapped_size);
+#endif
+}
+
+std::string_view xml_memory_buffer::remaining() const {
+  return {gptr(), static_cast<Size>(egptr() - gptr())};
+}
+
+void xml_memory_buffer::advance(Size n) {
+  setg(eback(), gptr() + std::min(n, remaining().size()), egptr());
+}
+
+xml_memory_buffer::pos_type xml_memory_buffer::seekoff(
+    off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) {
+  if (not(which & std::ios_base::in)) return pos_type(off_type(-1));
+
+  off_type pos = off;
+  if (dir == std::ios_base::cur) pos += gptr() - eback();
+  if (dir == std::ios_base::end) pos += egptr() - eback();
+
+  if (pos < 0 or pos > egptr() - eback()) return pos_type(off_type(-1));
+
+  setg(eback(), eback() + pos, egptr());
+  return pos_type(pos);
+}
+
+xml_memory_buffer::pos_type xml_memory_buffer::seekpos(
+    pos_type pos, std::ios_base::openmode which) {
+  return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+xml_memory_stream::xml_memory_stream(std::unique_ptr<xml_memory_buffer> buf)
+    : std::istream(buf.get()), buffer(std::move(buf)) {}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <configtypes.h>
+#include <mystring.h>
+
+#include <istream>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <string_view>
+
+//! A read-only stream buffer over the full content of a file
+/*!
+  Plain files are memory-mapped where the system supports it, all other
+  files are read into memory.  Parsers that find a stream to be backed by
+  this buffer may read the remaining content directly, and then advance
+  the buffer past what they have used.
+*/
+class xml_memory_buffer final : public std::streambuf {
+  std::string owned{};
+  void* mapped{nullptr};
+  Size mapped_size{0};
+
+ public:
+  explicit xml_memory_buffer(std::string content);
+
+  //! Memory-maps a file, returns nullptr if the file cannot be mapped
+  static std::unique_ptr<xml_memory_buffer> map(const String& filename);
+
+  xml_memory_buffer(const xml_memory_buffer&)            = delete;
+  xml_memory_buffer& operator=(const xml_memory_buffer&) = delete;
+
+  ~xml_memory_buffer() override;
+
+  //! The content that has not yet been read
+  [[nodiscard]] std::string_view remaining() const;
+
+  //! Skips the first n characters of the remaining content
+  void advance(Size n);
+
+ protected:
+  pos_type seekoff(off_type off,
+                   std::ios_base::seekdir dir,
+                   std::ios_base::openmode which) override;
+
+  pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+
+ private:
+  xml_memory_buffer(void* data, Size size);
+};
+
+//! An input stream that owns its xml_memory_buffer
+class xml_memory_stream final : public std::istream {
+  std::unique_ptr<xml_memory_buffer> buffer;
+
+ public:
+  explicit xml_memory_stream(std::unique_ptr<xml_memory_buffer> buf);
+};
@@ -1,8 +1,16 @@
 #include "xml_io_stream_core.h"
 
+#include <arts_omp.h>
 #include <double_imanip.h>
+#include <fast_float/fast_float.h>
+
+#include <algorithm>
+#include <string_view>
+#include <system_error>
+#include <vector>
 
 #include "xml_io_base.h"
+#include "xml_io_buffer.h"
 
 //! NUMERIC
 
@@ -29,7 +37,85 @@ void xml_io_stream<Numeric>::get(std::span<Numeric> v, bifstream* pbifs) {
   pbifs->readDoubleArray(v.data(), v.size());
 }
 
+namespace {
+constexpr bool is_space(char c) {
+  return c == ' ' or c == '\n' or c == '\t' or c == '\r' or c == '\v' or
+         c == '\f';
+}
+
+//! Below this many values, the values are parsed from the stream directly
+constexpr Size parallel_parse_limit = 1 << 14;
+
+/*! Parses v.size() whitespace-separated values from the start of text
+
+  The text is split at whitespace into parts that are first counted and then
+  parsed in parallel.  Returns the number of characters that were used, or
+  npos if any of the values is not a plain number that ends at whitespace.
+  The caller must then parse the values the regular way.
+*/
+Size parse_parallel(std::span<Numeric> v, std::string_view text) {
+  text = text.substr(0, text.find('<'));
+
+  const Size nparts = 4 * static_cast<Size>(arts_omp_get_max_threads());
+  std::vector<Size> first(nparts + 1, text.size());
+  first.front() = 0;
+  for (Size p = 1; p < nparts; p++) {
+    Size pos = std::max(first[p - 1], p * (text.size() / nparts));
+    while (pos < text.size() and not is_space(text[pos])) pos++;
+    first[p] = pos;
+  }
+
+  std::vector<Size> count(nparts + 1, 0);
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Size p = 0; p < nparts; p++) {
+    bool space = true;
+    for (Size i = first[p]; i < first[p + 1]; i++) {
+      const bool s = is_space(text[i]);
+      if (space and not s) count[p + 1]++;
+      space = s;
+    }
+  }
+
+  for (Size p = 0; p < nparts; p++) count[p + 1] += count[p];
+  if (count.back() < v.size()) return std::string_view::npos;
+
+  bool error = false;
+  Size end   = 0;
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Size p = 0; p < nparts; p++) {
+    const char* ptr  = text.data() + first[p];
+    const char* last = text.data() + first[p + 1];
+    for (Size k = count[p]; k < std::min(count[p + 1], v.size()); k++) {
+      while (is_space(*ptr)) ptr++;
+
+      const auto res = fast_float::from_chars(ptr, last, v[k]);
+      if (res.ec != std::errc{} or
+          (res.ptr != last and not is_space(*res.ptr))) {
+#pragma omp atomic write
+        error = true;
+        break;
+      }
+
+      ptr = res.ptr;
+      if (k + 1 == v.size()) end = static_cast<Size>(ptr - text.data());
+    }
+  }
+
+  return error ? std::string_view::npos : end;
+}
+}  // namespace
+
 void xml_io_stream<Numeric>::parse(std::span<Numeric> v, std::istream& is) {
+  if (v.size() >= parallel_parse_limit and is.good()) {
+    if (auto* buf = dynamic_cast<xml_memory_buffer*>(is.rdbuf())) {
+      if (const Size n = parse_parallel(v, buf->remaining());
+          n != std::string_view::npos) {
+        buf->advance(n);
+        return;
+      }
+    }
+  }
+
   for (auto& x : v) is >> double_imanip() >> x;
 }
 
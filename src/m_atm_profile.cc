@@ -1,30 +1,20 @@
-#include <arts_omp.h>
 #include <workspace.h>
 
-#include <stdexcept>
+#include <ranges>
+#include <vector>
 
 void atm_profileExtract(ArrayOfAtmPoint &atm_profile,
                         const AtmField &atm_field,
                         const AscendingGrid &alt_grid,
                         const Numeric &latitude,
                         const Numeric &longitude) {
-  const Size N = alt_grid.size();
-
-  atm_profile.clear();
-  atm_profile.resize(N);
-
-  String error;
-#pragma omp parallel for if (not arts_omp_in_parallel())
-  for (Size i = 0; i < N; i++) {
-    try {
-      atm_profile[i] = atm_field.at(alt_grid[i], latitude, longitude);
-    } catch (const std::exception &e) {
-#pragma omp critical
-      if (error.empty()) error = e.what();
-    }
-  }
-
-  if (not error.empty()) throw std::runtime_error(error);
+  const std::vector<Vector3> pos{
+      std::from_range,
+      alt_grid | stdv::transform([&](Numeric alt) -> Vector3 {
+        return {alt, latitude, longitude};
+      })};
+
+  atm_profile = atm_field.at(pos);
 }
 
 void atm_profileFromGrid(ArrayOfAtmPoint &atm_profile,
@@ -28,24 +28,24 @@ void spectral_rad_bkgAgendasAtEndOfPath(
       break;
     case unknown: ARTS_USER_ERROR("Undefined background type"); break;
     case space:
-      spectral_rad_space_agendaExecute(ws,
-                                       spectral_rad_bkg,
-                                       spectral_rad_bkg_jac,
-                                       freq_grid,
-                                       jac_targets,
-                                       ray_point,
-                                       spectral_rad_space_agenda);
+      spectral_rad_space_agendaRun(ws,
+                                   spectral_rad_bkg,
+                                   spectral_rad_bkg_jac,
+                                   freq_grid,
+                                   jac_targets,
+                                   ray_point,
+                                   spectral_rad_space_agenda);
       break;
     case surface:
-      spectral_rad_surface_agendaExecute(ws,
-                                         spectral_rad_bkg,
-                                         spectral_rad_bkg_jac,
-                                         freq_grid,
-                                         jac_targets,
-                                         ray_point,
-                                         surf_field,
-                                         subsurf_field,
-                                         spectral_rad_surface_agenda);
+      spectral_rad_surface_agendaRun(ws,
+                                     spectral_rad_bkg,
+                                     spectral_rad_bkg_jac,
+                                     freq_grid,
+                                     jac_targets,
+                                     ray_point,
+                                     surf_field,
+                                     subsurf_field,
+                                     spectral_rad_surface_agenda);
       break;
   }
 }
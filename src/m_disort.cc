@@ -20,12 +20,11 @@ void disort_spectral_rad_fieldCalc(DisortRadiance& disort_spectral_rad_field,
   const Index np    = disort_settings.layer_count();
   const Index nquad = disort_settings.quadrature_dimension;
 
-  disort::main_data dis = disort_settings.init();
   Tensor3 ims(np, phis.size(), nquad / 2);
   Tensor3 tms(np, phis.size(), nquad);
 
   //! Supplementary outputs
-  disort_quadrature = dis.gridded_weights();
+  disort_quadrature = disort_settings.lease()->gridded_weights();
 
   //! Main output
   disort_spectral_rad_field.resize(disort_settings.freq_grid,
@@ -33,13 +32,16 @@ void disort_spectral_rad_fieldCalc(DisortRadiance& disort_spectral_rad_field,
                                    phis,
                                    ZenGrid{disort_quadrature.grid<0>()});
 
+  // Neighbouring frequencies on the same thread reuse the eigensystem and
+  // factorization of the previous one if the optics allow it
   String error;
-#pragma omp parallel for if (not arts_omp_in_parallel()) \
-    firstprivate(dis, tms, ims)
+#pragma omp parallel for if (not arts_omp_in_parallel()) schedule(static) \
+    firstprivate(tms, ims)
   for (Index iv = 0; iv < nv; iv++) {
     try {
-      disort_settings.set(dis, iv);
-      dis.gridded_u_corr(disort_spectral_rad_field.data[iv], tms, ims, phis);
+      auto dis = disort_settings.lease();
+      disort_settings.set(*dis, iv);
+      dis->gridded_u_corr(disort_spectral_rad_field.data[iv], tms, ims, phis);
     } catch (const std::exception& e) {
 #pragma omp critical
       if (error.empty()) error = e.what();
@@ -47,7 +49,7 @@ void disort_spectral_rad_fieldCalc(DisortRadiance& disort_spectral_rad_field,
   }
 
   //! FIXME: It would be nice to remove this if the internal angles can be solved
-  disort_spectral_rad_field.sort(dis.mu());
+  disort_spectral_rad_field.sort(disort_settings.lease()->mu());
 
   ARTS_USER_ERROR_IF(
       error.size(), "Error occurred in disort-spectral:\n{}", error);
@@ -62,16 +64,17 @@ void disort_spectral_flux_fieldCalc(DisortFlux& disort_spectral_flux_field,
   disort_spectral_flux_field.resize(disort_settings.freq_grid,
                                     disort_settings.alt_grid);
 
-  disort::main_data dis = disort_settings.init();
-
   String error;
 
-#pragma omp parallel for if (not arts_omp_in_parallel()) firstprivate(dis)
+  // Neighbouring frequencies on the same thread reuse the eigensystem and
+  // factorization of the previous one if the optics allow it
+#pragma omp parallel for if (not arts_omp_in_parallel()) schedule(static)
   for (Index iv = 0; iv < nv; iv++) {
     try {
-      disort_settings.set(dis, iv);
+      auto dis = disort_settings.lease();
+      disort_settings.set(*dis, iv);
 
-      dis.gridded_flux(disort_spectral_flux_field.up[iv],
+      dis->gridded_flux(disort_spectral_flux_field.up[iv],
                        disort_spectral_flux_field.down_diffuse[iv],
                        disort_spectral_flux_field.down_direct[iv]);
     } catch (const std::exception& e) {
@@ -389,7 +389,7 @@ void disort_settingsDownwellingObserver(
     firstprivate(spectral_rad, spectral_rad_jac, ray_path_up)
   for (Index i = 0; i < N; i++) {
     try {
-      spectral_rad_observer_agendaExecute(
+      spectral_rad_observer_agendaRun(
           ws,
           spectral_rad,
           spectral_rad_jac,
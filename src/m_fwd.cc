@@ -215,7 +215,7 @@ void spectral_rad_fieldFromOperatorPath(
           for (Index iza = 0; iza < nza; ++iza) {
             for (Index iaa = 0; iaa < naa; ++iaa) {
               ArrayOfPropagationPathPoint ray_path;
-              ray_path_observer_agendaExecute(
+              ray_path_observer_agendaRun(
                   ws,
                   ray_path,
                   {alt_grid[ialt], lat_grid[ilat], lon_grid[ilon]},
@@ -244,7 +244,7 @@ void spectral_rad_fieldFromOperatorPath(
             for (Index iaa = 0; iaa < naa; ++iaa) {
               try {
                 ArrayOfPropagationPathPoint ray_path;
-                ray_path_observer_agendaExecute(
+                ray_path_observer_agendaRun(
                     ws,
                     ray_path,
                     {alt_grid[ialt], lat_grid[ilat], lon_grid[ilon]},
@@ -295,7 +295,7 @@ void measurement_vecFromOperatorPath(
 
     ArrayOfPropagationPathPoint ray_path;
 
-    ray_path_observer_agendaExecute(
+    ray_path_observer_agendaRun(
         ws, ray_path, poslos.pos, poslos.los, ray_path_observer_agenda);
 
     const StokvecVector spectral_rad{
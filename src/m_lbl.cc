@@ -21,9 +21,12 @@
 #include <xml_io_old.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <exception>
 #include <filesystem>
+#include <fstream>
 #include <iterator>
+#include <limits>
 #include <ranges>
 #include <unordered_map>
 
@@ -248,23 +251,52 @@ void spectral_propmatAddLines(PropmatVector& pm,
                               const SpeciesEnum& species,
                               const AbsorptionBands& abs_bands,
                               const LinemixingEcsData& abs_ecs_data,
+                              const LineByLineCache& abs_lbl_cache,
                               const AtmPoint& atm_point,
                               const PropagationPathPoint& path_point,
                               const Index& no_negative_absorption) try {
   ARTS_TIME_REPORT
 
+  // Jacobian calculations are never cached
+  const bool use_cache =
+      abs_lbl_cache.active() and dpm.nrows() == 0 and dsv.nrows() == 0;
+
+  // The bands are hashed once, for both the cache and the frequency index
+  const std::size_t bands_hash = lbl::content_hash(abs_bands, species);
+
+  LineByLineCache::key cache_key;
+  if (use_cache) {
+    cache_key = abs_lbl_cache.make_key(f_grid,
+                                       species,
+                                       bands_hash,
+                                       abs_ecs_data,
+                                       atm_point,
+                                       path_point.los,
+                                       no_negative_absorption);
+    if (abs_lbl_cache.add_cached(pm, sv, cache_key, f_grid)) return;
+  }
+
+  // Only the contribution of the lines may be stored in the cache
+  PropmatVector pm_lines(use_cache ? f_grid.size() : 0);
+  StokvecVector sv_lines(use_cache ? f_grid.size() : 0);
+  PropmatVectorView pm_out = use_cache ? pm_lines : pm;
+  StokvecVectorView sv_out = use_cache ? sv_lines : sv;
+
+  const auto bands_index =
+      lbl::frequency_index::shared(abs_bands, species, bands_hash);
+
   const Size n = arts_omp_get_max_threads();
   if (n == 1 or static_cast<Size>(arts_omp_in_parallel()) or
       n > f_grid.size()) {
-    lbl::calculate(pm,
-                   sv,
+    lbl::calculate(pm_out,
+                   sv_out,
                    dpm,
                    dsv,
                    f_grid,
                    Range(0, f_grid.size()),
                    jac_targets,
                    species,
-                   abs_bands,
+                   *bands_index,
                    abs_ecs_data,
                    atm_point,
                    path_point.los,
@@ -275,15 +307,15 @@ void spectral_propmatAddLines(PropmatVector& pm,
 #pragma omp parallel for
     for (Size i = 0; i < n; i++) {
       try {
-        lbl::calculate(pm,
-                       sv,
+        lbl::calculate(pm_out,
+                       sv_out,
                        dpm,
                        dsv,
                        f_grid,
                        f_ranges[i],
                        jac_targets,
                        species,
-                       abs_bands,
+                       *bands_index,
                        abs_ecs_data,
                        atm_point,
                        path_point.los,
@@ -296,15 +328,50 @@ void spectral_propmatAddLines(PropmatVector& pm,
 
     if (not error.empty()) throw std::runtime_error(error);
   }
+
+  if (use_cache) {
+    abs_lbl_cache.store(pm_lines, sv_lines, cache_key, f_grid);
+    for (Size i = 0; i < f_grid.size(); i++) pm[i] += pm_lines[i];
+    for (Size i = 0; i < f_grid.size(); i++) sv[i] += sv_lines[i];
+  }
 }
 ARTS_METHOD_ERROR_CATCH
 
+void abs_lbl_cacheInit(LineByLineCache& abs_lbl_cache,
+                       const Index& max_entries,
+                       const Numeric& pressure_tolerance,
+                       const Numeric& temperature_tolerance,
+                       const Numeric& vmr_tolerance,
+                       const Numeric& magnetic_tolerance,
+                       const Numeric& los_tolerance) {
+  ARTS_TIME_REPORT
+
+  ARTS_USER_ERROR_IF(max_entries < 0,
+                     "Must have non-negative max_entries, got {}",
+                     max_entries)
+  ARTS_USER_ERROR_IF(pressure_tolerance < 0 or temperature_tolerance < 0 or
+                         vmr_tolerance < 0 or magnetic_tolerance < 0 or
+                         los_tolerance < 0,
+                     "Must have non-negative tolerances")
+
+  abs_lbl_cache = LineByLineCache{{
+      .max_entries           = static_cast<Size>(max_entries),
+      .pressure_tolerance    = pressure_tolerance,
+      .temperature_tolerance = temperature_tolerance,
+      .vmr_tolerance         = vmr_tolerance,
+      .magnetic_tolerance    = magnetic_tolerance,
+      .los_tolerance         = los_tolerance,
+  }};
+}
+
 void abs_bandsReadHITRAN(AbsorptionBands& abs_bands,
                          const String& filename,
                          const Vector2& frequency_range,
                          const ArrayOfString& file_formatter,
                          const String& line_strength_option,
-                         const Index& compute_zeeman_parameters) try {
+                         const Index& compute_zeeman_parameters,
+                         const ArrayOfSpeciesEnum& species,
+                         const String& cache_file) try {
   ARTS_TIME_REPORT
 
   using namespace Quantum;
@@ -323,8 +390,40 @@ void abs_bandsReadHITRAN(AbsorptionBands& abs_bands,
 
   const bool do_zeeman = static_cast<bool>(compute_zeeman_parameters);
 
-  const auto data = lbl::read_hitran_par(
-      open_input_file(filename), format_order, frequency_range);
+  const auto data = [&]() {
+    if (cache_file.empty()) {
+      return lbl::read_hitran_par(
+          open_input_file(filename), format_order, frequency_range, species);
+    }
+
+    auto file                = open_input_file(filename);
+    const std::uint64_t hash = lbl::hitran_content_hash(file, format_order);
+
+    if (std::filesystem::exists(cache_file.c_str())) {
+      std::ifstream is(cache_file.c_str(), std::ios::binary);
+      if (auto cached = lbl::read_hitran_cache(
+              is, hash, frequency_range, species)) {
+        return *std::move(cached);
+      }
+    }
+
+    file.clear();
+    file.seekg(0);
+    {
+      std::ofstream os(cache_file.c_str(), std::ios::binary);
+      ARTS_USER_ERROR_IF(not os, "Cannot write to cache file {}", cache_file)
+      lbl::write_hitran_cache(
+          os,
+          lbl::read_hitran_par(file,
+                               format_order,
+                               {-std::numeric_limits<Numeric>::infinity(),
+                                std::numeric_limits<Numeric>::infinity()}),
+          hash);
+    }
+
+    std::ifstream is(cache_file.c_str(), std::ios::binary);
+    return lbl::read_hitran_cache(is, hash, frequency_range, species).value();
+  }();
 
   abs_bands = {};
   for (auto& line : data) {
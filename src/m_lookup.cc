@@ -1,3 +1,5 @@
+#include <array_algo.h>
+#include <lookup_mapped.h>
 #include <workspace.h>
 
 #include <algorithm>
@@ -9,6 +11,20 @@ void abs_lookup_dataInit(AbsorptionLookupTables& abs_lookup_data) {
   abs_lookup_data.clear();
 }
 
+void abs_lookup_dataReadMapped(AbsorptionLookupTables& abs_lookup_data,
+                               const String& filename) {
+  ARTS_TIME_REPORT
+
+  abs_lookup_data = lookup::read_mapped(filename);
+}
+
+void abs_lookup_dataWriteMapped(const AbsorptionLookupTables& abs_lookup_data,
+                                const String& filename) {
+  ARTS_TIME_REPORT
+
+  lookup::write_mapped(filename, abs_lookup_data);
+}
+
 namespace {
 template <bool calc>
 std::conditional_t<calc, Vector, void> _spectral_propmatAddLookup(
@@ -172,6 +188,157 @@ void spectral_propmatAddLookup(
 }
 ARTS_METHOD_ERROR_CATCH
 
+namespace {
+Matrix lookup_path_absorption(const AbsorptionLookupTables& abs_lookup_data,
+                              const SpeciesEnum& select_species,
+                              const ArrayOfAtmPoint& atm_path,
+                              const AscendingGrid& freq_grid,
+                              const Index& p_interp_order,
+                              const Index& t_interp_order,
+                              const Index& water_interp_order,
+                              const Index& f_interp_order,
+                              const Numeric& extpolfac) {
+  Matrix absorption(atm_path.size(), freq_grid.size(), 0.0);
+
+  if (select_species == "Bath"_spec) {
+    for (auto& [spec, data] : abs_lookup_data) {
+      data.absorption(absorption,
+                      spec,
+                      p_interp_order,
+                      t_interp_order,
+                      water_interp_order,
+                      f_interp_order,
+                      atm_path,
+                      freq_grid,
+                      extpolfac);
+    }
+  } else {
+    abs_lookup_data.at(select_species)
+        .absorption(absorption,
+                    select_species,
+                    p_interp_order,
+                    t_interp_order,
+                    water_interp_order,
+                    f_interp_order,
+                    atm_path,
+                    freq_grid,
+                    extpolfac);
+  }
+
+  return absorption;
+}
+}  // namespace
+
+void spectral_propmat_pathAddLookup(
+    ArrayOfPropmatVector& spectral_propmat_path,
+    ArrayOfPropmatMatrix& spectral_propmat_jac_path,
+    const AscendingGrid& freq_grid,
+    const JacobianTargets& jac_targets,
+    const SpeciesEnum& select_species,
+    const AbsorptionLookupTables& abs_lookup_data,
+    const ArrayOfAtmPoint& atm_path,
+    const Index& no_negative_absorption,
+    const Index& p_interp_order,
+    const Index& t_interp_order,
+    const Index& water_interp_order,
+    const Index& f_interp_order,
+    const Numeric& extpolfac) try {
+  ARTS_TIME_REPORT
+
+  const Size np = atm_path.size();
+  const Size nf = freq_grid.size();
+  const Size nj = jac_targets.target_count();
+
+  ARTS_USER_ERROR_IF(
+      not arr::same_size(spectral_propmat_path, spectral_propmat_jac_path) or
+          spectral_propmat_path.size() != np,
+      R"(Not same size:
+
+atm_path                  size: {} element(s)
+spectral_propmat_path     size: {} element(s)
+spectral_propmat_jac_path size: {} element(s)
+)",
+      np,
+      spectral_propmat_path.size(),
+      spectral_propmat_jac_path.size())
+
+  for (Size ip = 0; ip < np; ip++) {
+    ARTS_USER_ERROR_IF(
+        spectral_propmat_path[ip].size() != nf or
+            spectral_propmat_jac_path[ip].shape() !=
+                std::array{static_cast<Index>(nj), static_cast<Index>(nf)},
+        R"(Bad shape at path point {}:
+
+spectral_propmat_path     shape: {:B,}
+spectral_propmat_jac_path shape: {:B,}
+Expected [{}] and [{}, {}]
+)",
+        ip,
+        spectral_propmat_path[ip].shape(),
+        spectral_propmat_jac_path[ip].shape(),
+        nf,
+        nj,
+        nf)
+  }
+
+  const auto calc = [&](const ArrayOfAtmPoint& atm,
+                        const AscendingGrid& f) {
+    return lookup_path_absorption(abs_lookup_data,
+                                  select_species,
+                                  atm,
+                                  f,
+                                  p_interp_order,
+                                  t_interp_order,
+                                  water_interp_order,
+                                  f_interp_order,
+                                  extpolfac);
+  };
+
+  const Matrix absorption = calc(atm_path, freq_grid);
+
+  for (Size ip = 0; ip < np; ip++) {
+    for (Size i = 0; i < nf; i++) {
+      if (no_negative_absorption == 0 or absorption[ip, i] > 0.0) {
+        spectral_propmat_path[ip][i].A() += absorption[ip, i];
+      }
+    }
+  }
+
+  // Each point only depends on its own state, so the whole path is perturbed
+  for (auto& jacobian_target : jac_targets.atm) {
+    ARTS_USER_ERROR_IF(
+        not std::isnormal(jacobian_target.d),
+        "The target {} is not good, it lacks a perturbation value.",
+        jacobian_target);
+
+    Matrix d_absorption;
+    if (is_wind(jacobian_target)) {
+      const AscendingGrid freq_grid2(
+          freq_grid.begin(),
+          freq_grid.end(),
+          [d = jacobian_target.d](Numeric x) { return x + d; });
+      d_absorption = calc(atm_path, freq_grid2);
+    } else {
+      ArrayOfAtmPoint atm_path2 = atm_path;
+      for (auto& atm_point : atm_path2) {
+        atm_point[jacobian_target.type] += jacobian_target.d;
+      }
+      d_absorption = calc(atm_path2, freq_grid);
+    }
+
+    const Numeric d_inv = 1.0 / jacobian_target.d;
+    for (Size ip = 0; ip < np; ip++) {
+      for (Size i = 0; i < nf; i++) {
+        if (no_negative_absorption == 0 or d_absorption[ip, i] > 0.0) {
+          spectral_propmat_jac_path[ip][jacobian_target.target_pos, i].A() =
+              (d_absorption[ip, i] - absorption[ip, i]) * d_inv;
+        }
+      }
+    }
+  }
+}
+ARTS_METHOD_ERROR_CATCH
+
 void abs_lookup_dataPrecompute(AbsorptionLookupTables& abs_lookup_data,
                                const ArrayOfAtmPoint& atm_profile,
                                const AscendingGrid& freq_grid,
@@ -179,21 +346,53 @@ void abs_lookup_dataPrecompute(AbsorptionLookupTables& abs_lookup_data,
                                const LinemixingEcsData& abs_ecs_data,
                                const SpeciesEnum& select_species,
                                const AscendingGrid& temperature_perturbation,
-                               const AscendingGrid& water_perturbation) {
+                               const AscendingGrid& water_perturbation,
+                               const Index& frequency_block_size,
+                               const String& filename,
+                               const String& storage) {
   ARTS_TIME_REPORT
 
-  abs_lookup_data[select_species] = {
-      select_species,
-      atm_profile,
-      std::make_shared<const AscendingGrid>(freq_grid),
-      abs_bands,
-      abs_ecs_data,
+  ARTS_USER_ERROR_IF(frequency_block_size < 0,
+                     "Frequency block size must be non-negative, got {}",
+                     frequency_block_size)
+
+  const auto storage_type = to<LookupTableStorage>(storage);
+  ARTS_USER_ERROR_IF(
+      not filename.empty() and storage_type != LookupTableStorage::Double,
+      "Tables streamed to file must be stored as Double, got {}",
+      storage_type)
+
+  const auto f = std::make_shared<const AscendingGrid>(freq_grid);
+  const auto t =
       temperature_perturbation.empty()
           ? nullptr
-          : std::make_shared<const AscendingGrid>(temperature_perturbation),
+          : std::make_shared<const AscendingGrid>(temperature_perturbation);
+  const auto w =
       water_perturbation.empty()
           ? nullptr
-          : std::make_shared<const AscendingGrid>(water_perturbation)};
+          : std::make_shared<const AscendingGrid>(water_perturbation);
+
+  if (filename.empty()) {
+    abs_lookup_data[select_species] = {select_species,
+                                       atm_profile,
+                                       f,
+                                       abs_bands,
+                                       abs_ecs_data,
+                                       t,
+                                       w,
+                                       static_cast<Size>(frequency_block_size)};
+    abs_lookup_data[select_species].compress(storage_type);
+  } else {
+    abs_lookup_data[select_species] =
+        lookup::precompute_mapped(filename,
+                                  {{select_species, {.t = t, .w = w}}},
+                                  atm_profile,
+                                  f,
+                                  abs_bands,
+                                  abs_ecs_data,
+                                  static_cast<Size>(frequency_block_size))
+            .at(select_species);
+  }
 }
 
 void abs_lookup_dataPrecomputeAll(
@@ -204,10 +403,21 @@ void abs_lookup_dataPrecomputeAll(
     const LinemixingEcsData& abs_ecs_data,
     const AscendingGrid& temperature_perturbation,
     const AscendingGrid& water_perturbation,
-    const ArrayOfSpeciesEnum& water_affected_species) {
+    const ArrayOfSpeciesEnum& water_affected_species,
+    const Index& frequency_block_size,
+    const String& filename,
+    const String& storage) {
   ARTS_TIME_REPORT
 
-  const AscendingGrid empty{};
+  ARTS_USER_ERROR_IF(frequency_block_size < 0,
+                     "Frequency block size must be non-negative, got {}",
+                     frequency_block_size)
+
+  const auto storage_type = to<LookupTableStorage>(storage);
+  ARTS_USER_ERROR_IF(
+      not filename.empty() and storage_type != LookupTableStorage::Double,
+      "Tables streamed to file must be stored as Double, got {}",
+      storage_type)
 
   ArrayOfSpeciesEnum lut_species;
   const auto species_not_in_lut =
@@ -243,15 +453,37 @@ void abs_lookup_dataPrecomputeAll(
           ? nullptr
           : std::make_shared<const AscendingGrid>(water_perturbation);
 
+  const auto nb = static_cast<Size>(frequency_block_size);
+
+  if (not filename.empty()) {
+    std::unordered_map<SpeciesEnum, lookup::table_setup> setup;
+    for (SpeciesEnum s : lut_species) {
+      const bool do_water_perturb =
+          stdr::any_of(water_affected_species, Cmp::eq(s));
+      setup[s] = {.t = t, .w = do_water_perturb ? w : nullptr};
+    }
+
+    for (auto&& [s, data] : lookup::precompute_mapped(
+             filename, setup, atm_profile, f, abs_bands, abs_ecs_data, nb)) {
+      abs_lookup_data[s] = std::move(data);
+    }
+    return;
+  }
+
   for (SpeciesEnum s : lut_species) {
     const bool do_water_perturb =
         stdr::any_of(water_affected_species, Cmp::eq(s));
 
     if (do_water_perturb) {
-      abs_lookup_data[s] = {s, atm_profile, f, abs_bands, abs_ecs_data, t, w};
+      abs_lookup_data[s] = {
+          s, atm_profile, f, abs_bands, abs_ecs_data, t, w, nb};
     } else {
-      abs_lookup_data[s] = {s, atm_profile, f, abs_bands, abs_ecs_data, t};
+      abs_lookup_data[s] = {
+          s, atm_profile, f, abs_bands, abs_ecs_data, t, nullptr, nb};
     }
+
+    // Compress as we go so that only one double table is held at a time
+    abs_lookup_data[s].compress(storage_type);
   }
 }
 
@@ -266,7 +498,8 @@ void abs_lookup_dataFromProfiles(
     const AscendingGrid& temperature_perturbation,
     const AscendingGrid& water_perturbation,
     const ArrayOfSpeciesEnum& water_affected_species,
-    const String& isoratio_option) {
+    const String& isoratio_option,
+    const String& storage) {
   ARTS_TIME_REPORT
 
   abs_lookup_dataInit(abs_lookup_data);
@@ -301,7 +534,10 @@ void abs_lookup_dataFromProfiles(
                                abs_ecs_data,
                                temperature_perturbation,
                                water_perturbation,
-                               water_affected_species);
+                               water_affected_species,
+                               Index{0},
+                               String{},
+                               storage);
 }
 
 void abs_lookup_dataSimpleWide(AbsorptionLookupTables& abs_lookup_data,
@@ -380,5 +616,6 @@ void abs_lookup_dataSimpleWide(AbsorptionLookupTables& abs_lookup_data,
                               temperature_perturbation,
                               water_perturbation,
                               water_affected_species,
-                              isoratio_option);
+                              isoratio_option,
+                              String{"Double"});
 }
@@ -17,15 +17,31 @@
   === External declarations
   ===========================================================================*/
 
+#include <arts_omp.h>
 #include <array.h>
 #include <atm.h>
 #include <config.h>
 #include <debug.h>
+#include <file.h>
 #include <jacobian.h>
 #include <workspace.h>
+#include <lbl_hash.h>
+#include <xml_io.h>
 
+#include <boost/container_hash/hash.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #ifndef _MSC_VER
 #pragma GCC diagnostic ignored "-Wconversion"
@@ -48,72 +64,283 @@ void measurement_vec_fitFromMeasurement(Vector& yf, const Vector& y) {
 }
 
 /* Workspace method: Doxygen documentation will be auto-generated */
-void OEM(const Workspace& ws,
-         Vector& model_state_vec,
-         Vector& measurement_vec_fit,
-         Matrix& measurement_jac,
-         AtmField& atm_field,
-         AbsorptionBands& abs_bands,
-         ArrayOfSensorObsel& measurement_sensor,
-         SurfaceField& surf_field,
-         SubsurfaceField& subsurf_field,
-         Matrix& measurement_gain_mat,
-         Vector& oem_diagnostics,
-         Vector& lm_ga_history,
-         ArrayOfString& errors,
-         const JacobianTargets& jac_targets,
-         const Vector& model_state_vec_apriori,
-         const CovarianceMatrix& model_state_covmat,
-         const Vector& measurement_vec,
-         const CovarianceMatrix& measurement_vec_error_covmat,
-         const Agenda& inversion_iterate_agenda,
-         const String& method,
-         const Numeric& max_start_cost,
-         const Vector& model_state_covmat_normalization,
-         const Index& max_iter,
-         const Numeric& stop_dx,
-         const Vector& lm_ga_settings,
-         const Index& clear_matrices,
-         const Index& display_progress) {
-  ARTS_TIME_REPORT
+namespace {
+//! The a priori covariance matrix of the LM methods, the inverse diagonal
+CovarianceMatrix lm_covmat(const CovarianceMatrix& model_state_covmat) {
+  const Index n = model_state_covmat.nrows();
+
+  Sparse diagonal = Sparse::diagonal(model_state_covmat.inverse_diagonal());
+  CovarianceMatrix SaDiag{};
+  SaDiag.add_correlation_inverse(Block(Range(0, n),
+                                       Range(0, n),
+                                       std::make_pair(0, 0),
+                                       std::make_shared<Sparse>(diagonal)));
+  return SaDiag;
+}
+
+void hash_numeric(std::size_t& seed, Numeric x) {
+  boost::hash_combine(seed, std::bit_cast<std::uint64_t>(x));
+}
+
+void hash_matrix(std::size_t& seed, const ConstMatrixView& x) {
+  boost::hash_combine(seed, x.nrows());
+  boost::hash_combine(seed, x.ncols());
+  for (Index i = 0; i < x.nrows(); i++) {
+    for (Index j = 0; j < x.ncols(); j++) hash_numeric(seed, x[i, j]);
+  }
+}
+
+void hash_blocks(std::size_t& seed, const std::vector<Block>& blocks) {
+  using Iter = Eigen::SparseMatrix<Numeric, Eigen::RowMajor>::InnerIterator;
+
+  boost::hash_combine(seed, blocks.size());
+  for (auto& b : blocks) {
+    boost::hash_combine(seed, b.get_row_range().offset);
+    boost::hash_combine(seed, b.get_row_range().nelem);
+    boost::hash_combine(seed, b.get_column_range().offset);
+    boost::hash_combine(seed, b.get_column_range().nelem);
+
+    if (b.is_dense()) {
+      hash_matrix(seed, b.get_dense());
+    } else if (b.is_sparse()) {
+      const auto& sp = b.get_sparse().matrix;
+      for (Index i = 0; i < sp.outerSize(); i++) {
+        for (Iter it(sp, i); it; ++it) {
+          boost::hash_combine(seed, it.row());
+          boost::hash_combine(seed, it.col());
+          hash_numeric(seed, it.value());
+        }
+      }
+    }
+  }
+}
+
+//! Combine the hash of the XML text of x, which has all of its values
+template <typename T>
+void hash_xml(std::size_t& seed, const T& x) try {
+  std::ostringstream os;
+  xml_set_stream_precision(os);
+  xml_write_to_stream(os, x);
+  boost::hash_combine(seed, std::hash<std::string>{}(os.str()));
+} catch (const std::exception& e) {
+  throw std::runtime_error(
+      std::format("Cannot hash the input for the checkpoint:\n{}", e.what()));
+}
+
+/*! A hash of the input of OEMBatch that decides the result of its rows
+
+  Stored in the checkpoint, so that it is not resumed with other input.
+*/
+std::size_t batch_hash(const Matrix& measurement_vecs,
+                       const Vector& model_state_vec_apriori,
+                       const CovarianceMatrix& model_state_covmat,
+                       const CovarianceMatrix& measurement_vec_error_covmat,
+                       const String& method,
+                       const AtmField& atm_field,
+                       const AbsorptionBands& abs_bands,
+                       const ArrayOfSensorObsel& measurement_sensor,
+                       const SurfaceField& surf_field,
+                       const SubsurfaceField& subsurf_field,
+                       const JacobianTargets& jac_targets,
+                       const Vector& model_state_covmat_normalization,
+                       const Index& max_iter,
+                       const Numeric& stop_dx,
+                       const Vector& lm_ga_settings) {
+  std::size_t seed = std::hash<String>{}(method);
+  hash_matrix(seed, measurement_vecs);
+  for (auto x : model_state_vec_apriori) hash_numeric(seed, x);
+  for (auto* S : {&model_state_covmat, &measurement_vec_error_covmat}) {
+    hash_blocks(seed, S->get_blocks());
+    hash_blocks(seed, S->get_inverse_blocks());
+  }
+
+  hash_xml(seed, atm_field);
+  boost::hash_combine(seed, lbl::content_hash(abs_bands));
+  hash_xml(seed, measurement_sensor);
+  hash_xml(seed, surf_field);
+  hash_xml(seed, subsurf_field);
+  hash_xml(seed, jac_targets);
+
+  for (auto* v : {&model_state_covmat_normalization, &lm_ga_settings}) {
+    boost::hash_combine(seed, v->size());
+    for (auto x : *v) hash_numeric(seed, x);
+  }
+  boost::hash_combine(seed, max_iter);
+  hash_numeric(seed, stop_dx);
+  return seed;
+}
+
+/*! The append-only checkpoint of OEMBatch
+
+  The file is a header of the magic bytes, the hash of the input, and the
+  sizes nr, n, and m of the batch, followed by one record per inversion that
+  is done.  A record is the row of the inversion followed by its 5
+  diagnostics, its n states, and its m fits, all as native Numeric.  Records
+  are only ever appended, so a checkpoint costs the size of the new records
+  and not of the whole batch.  A later record of the same row replaces an
+  earlier one.  A record that an interruption cut short is dropped when the
+  checkpoint is resumed.
+*/
+class batch_checkpoint {
+  static constexpr std::array<char, 8> magic{
+      'A', 'R', 'T', 'S', 'O', 'E', 'M', 'B'};
+  static constexpr std::streamoff header_size = 40;
+
+  String path;
+  Index nr, n, m;
+
+  //! Serializes the appends of the threads
+  std::mutex mtx;
+  std::ofstream file;
+
+ public:
+  batch_checkpoint(String path_, Index nr_, Index n_, Index m_)
+      : path(std::move(path_)), nr(nr_), n(n_), m(m_) {}
 
+  [[nodiscard]] Index record_size() const { return 6 + n + m; }
+
+  /*! Read the records of an existing checkpoint and open it for appending
+
+    A new checkpoint is started if there is none.
+
+    @return The records of the checkpoint, record_size() values each
+  */
+  std::vector<Numeric> open(const std::uint64_t hash) {
+    std::vector<Numeric> records;
+
+    if (std::filesystem::exists(path)) {
+      std::ifstream is(path, std::ios::binary);
+
+      std::array<char, 8> m_magic{};
+      std::uint64_t m_hash{};
+      std::array<std::int64_t, 3> sizes{};
+      is.read(m_magic.data(), m_magic.size());
+      is.read(reinterpret_cast<char*>(&m_hash), sizeof(m_hash));
+      is.read(reinterpret_cast<char*>(sizes.data()), sizeof(sizes));
+      ARTS_USER_ERROR_IF(not is or m_magic != magic,
+                         "The checkpoint \"{}\" is not an OEMBatch checkpoint",
+                         path)
+      ARTS_USER_ERROR_IF(sizes != std::array<std::int64_t, 3>{nr, n, m},
+                         "The checkpoint \"{}\" has {} rows of {} states and "
+                         "{} fits, expected {} rows of {} states and {} fits",
+                         path,
+                         sizes[0],
+                         sizes[1],
+                         sizes[2],
+                         nr,
+                         n,
+                         m)
+      ARTS_USER_ERROR_IF(m_hash != hash,
+                         R"(The checkpoint "{}" is from other input
+
+The measurements, the a priori state, the covariance matrices, the fields, the
+sensor, the Jacobian targets, or the settings of the method differ from those
+of the batch that wrote it.  Remove it to start over.)",
+                         path)
+
+      const auto bytes = static_cast<std::streamoff>(
+          std::filesystem::file_size(path));
+      const auto record_bytes =
+          static_cast<std::streamoff>(record_size() * sizeof(Numeric));
+      const auto count = (bytes - header_size) / record_bytes;
+
+      records.resize(count * record_size());
+      is.read(reinterpret_cast<char*>(records.data()), count * record_bytes);
+      ARTS_USER_ERROR_IF(not is, "Cannot read the checkpoint \"{}\"", path)
+      is.close();
+
+      // Drop a record that was cut short, the next are appended after it
+      if (header_size + count * record_bytes != bytes) {
+        std::filesystem::resize_file(path, header_size + count * record_bytes);
+      }
+
+      file.open(path, std::ios::binary | std::ios::app);
+    } else {
+      const std::array<std::int64_t, 3> sizes{nr, n, m};
+      file.open(path, std::ios::binary | std::ios::trunc);
+      file.write(magic.data(), magic.size());
+      file.write(reinterpret_cast<const char*>(&hash), sizeof(hash));
+      file.write(reinterpret_cast<const char*>(sizes.data()), sizeof(sizes));
+      file.flush();
+    }
+
+    ARTS_USER_ERROR_IF(not file, "Cannot write the checkpoint \"{}\"", path)
+    return records;
+  }
+
+  //! Add the record of row i to the end of records
+  void record(std::vector<Numeric>& records,
+              const Index i,
+              const ConstVectorView diagnostics,
+              const ConstVectorView model_state_vec,
+              const ConstVectorView measurement_vec_fit) const {
+    records.push_back(static_cast<Numeric>(i));
+    records.insert(records.end(), diagnostics.begin(), diagnostics.end());
+    records.insert(
+        records.end(), model_state_vec.begin(), model_state_vec.end());
+    records.insert(
+        records.end(), measurement_vec_fit.begin(), measurement_vec_fit.end());
+  }
+
+  //! Append records to the file, thread-safe
+  void append(const std::vector<Numeric>& records) {
+    std::lock_guard lock(mtx);
+    file.write(reinterpret_cast<const char*>(records.data()),
+               static_cast<std::streamsize>(records.size() * sizeof(Numeric)));
+    file.flush();
+    ARTS_USER_ERROR_IF(not file, "Cannot write the checkpoint \"{}\"", path)
+  }
+};
+
+bool is_lm(const String& method) {
+  return method == "ml" || method == "lm" || method == "ml_cg" ||
+         method == "lm_cg";
+}
+
+/*! The inversion of OEM
+
+  The inputs are checked and the inverses of the covariance matrices are
+  computed.  SaDiag is the lm_covmat of the LM methods.  With a positive
+  jac_chunk_size, the CG methods run on the products of the Jacobian only.
+*/
+void oem_inversion(const Workspace& ws,
+                   Vector& model_state_vec,
+                   Vector& measurement_vec_fit,
+                   Matrix& measurement_jac,
+                   AtmField& atm_field,
+                   AbsorptionBands& abs_bands,
+                   ArrayOfSensorObsel& measurement_sensor,
+                   SurfaceField& surf_field,
+                   SubsurfaceField& subsurf_field,
+                   Matrix& measurement_gain_mat,
+                   Vector& oem_diagnostics,
+                   Vector& lm_ga_history,
+                   ArrayOfString& errors,
+                   const JacobianTargets& jac_targets,
+                   const Vector& model_state_vec_apriori,
+                   const CovarianceMatrix& model_state_covmat,
+                   const Vector& measurement_vec,
+                   const CovarianceMatrix& measurement_vec_error_covmat,
+                   const Agenda& inversion_iterate_agenda,
+                   const String& method,
+                   const Numeric& max_start_cost,
+                   const Vector& model_state_covmat_normalization,
+                   const Index& max_iter,
+                   const Numeric& stop_dx,
+                   const Vector& lm_ga_settings,
+                   const Index& clear_matrices,
+                   const Index& display_progress,
+                   const Index& jac_chunk_size,
+                   const CovarianceMatrix& SaDiag) {
   // Main sizes
   const Index n = model_state_covmat.nrows();
   const Index m = measurement_vec.size();
 
-  // Checks
-  model_state_covmat.compute_inverse();
-  measurement_vec_error_covmat.compute_inverse();
-
-  OEM_checks(ws,
-             model_state_vec,
-             measurement_vec_fit,
-             measurement_jac,
-             atm_field,
-             abs_bands,
-             measurement_sensor,
-             surf_field,
-             subsurf_field,
-             jac_targets,
-             inversion_iterate_agenda,
-             model_state_vec_apriori,
-             model_state_covmat,
-             measurement_vec,
-             measurement_vec_error_covmat,
-             method,
-             model_state_covmat_normalization,
-             max_iter,
-             stop_dx,
-             lm_ga_settings,
-             clear_matrices,
-             display_progress);
-
   // Size diagnostic output and init with NaNs
   oem_diagnostics.resize(5);
   oem_diagnostics = NAN;
   //
-  if (method == "ml" || method == "lm" || method == "ml_cg" ||
-      method == "lm_cg") {
+  if (is_lm(method)) {
     lm_ga_history.resize(max_iter + 1);
     lm_ga_history = NAN;
   } else {
@@ -130,19 +357,19 @@ void OEM(const Workspace& ws,
   // If no precomputed value given, we compute yf and jacobian to
   // compute initial cost (and use in the first OEM iteration).
   if (measurement_vec_fit.size() == 0) {
-    inversion_iterate_agendaExecute(ws,
-                                    atm_field,
-                                    abs_bands,
-                                    measurement_sensor,
-                                    surf_field,
-                                    subsurf_field,
-                                    measurement_vec_fit,
-                                    measurement_jac,
-                                    jac_targets,
-                                    model_state_vec_apriori,
-                                    1,
-                                    0,
-                                    inversion_iterate_agenda);
+    inversion_iterate_agendaRun(ws,
+                                atm_field,
+                                abs_bands,
+                                measurement_sensor,
+                                surf_field,
+                                subsurf_field,
+                                measurement_vec_fit,
+                                measurement_jac,
+                                jac_targets,
+                                model_state_vec_apriori,
+                                jac_chunk_size > 0 ? 0 : 1,
+                                0,
+                                inversion_iterate_agenda);
   }
 
   ARTS_USER_ERROR_IF(
@@ -207,6 +434,78 @@ void OEM(const Workspace& ws,
         Sa(model_state_covmat);
     oem::Vector xa_oem(model_state_vec_apriori), y_oem(measurement_vec),
         x_oem(model_state_vec);
+    int oem_verbosity = static_cast<int>(display_progress);
+
+    // The CG methods only need the products of the Jacobian, so these can
+    // be run without the dense Jacobian, which is then never returned
+    if (jac_chunk_size > 0) {
+      measurement_jac.resize(0, 0);
+      measurement_gain_mat.resize(0, 0);
+
+      oem::MatrixFreeAgendaWrapper aw(static_cast<Size>(jac_chunk_size),
+                                      &ws,
+                                      (unsigned int)m,
+                                      (unsigned int)n,
+                                      measurement_jac,
+                                      measurement_vec_fit,
+                                      &atm_field,
+                                      &abs_bands,
+                                      &measurement_sensor,
+                                      &surf_field,
+                                      &subsurf_field,
+                                      &jac_targets,
+                                      &inversion_iterate_agenda);
+      oem::OEM_STANDARD<oem::MatrixFreeAgendaWrapper> oem(
+          aw, xa_oem, Sa, Se);
+
+      try {
+        oem::CG cg(T, apply_norm, 1e-10, 0);
+        if (method == "li_cg") {
+          oem::GN_CG gn(stop_dx, 1, cg);  // Linear case, only one step.
+          oem_diagnostics[0] = oem.compute<oem::GN_CG, oem::ArtsLog>(
+              x_oem, y_oem, gn, oem_verbosity, lm_ga_history, true);
+        } else if (method == "gn_cg") {
+          oem::GN_CG gn(stop_dx, (unsigned int)max_iter, cg);
+          oem_diagnostics[0] = oem.compute<oem::GN_CG, oem::ArtsLog>(
+              x_oem, y_oem, gn, oem_verbosity, lm_ga_history);
+        } else {
+          oem::LM_CG lm(SaDiag, cg);
+
+          lm.set_maximum_iterations((unsigned int)max_iter);
+          lm.set_lambda(lm_ga_settings[0]);
+          lm.set_lambda_decrease(lm_ga_settings[1]);
+          lm.set_lambda_increase(lm_ga_settings[2]);
+          lm.set_lambda_threshold(lm_ga_settings[3]);
+          lm.set_lambda_maximum(lm_ga_settings[4]);
+
+          oem_diagnostics[0] = oem.compute<oem::LM_CG&, oem::ArtsLog>(
+              x_oem, y_oem, lm, oem_verbosity, lm_ga_history);
+          if (lm.get_lambda() > lm.get_lambda_maximum()) {
+            oem_diagnostics[0] = 2;
+          }
+        }
+
+        oem_diagnostics[2] = oem.cost / static_cast<Numeric>(m);
+        oem_diagnostics[3] = oem.cost_y / static_cast<Numeric>(m);
+        oem_diagnostics[4] = static_cast<Numeric>(oem.iterations);
+      } catch (const std::exception& e) {
+        oem_diagnostics[0]  = 9;
+        oem_diagnostics[2]  = oem.cost;
+        oem_diagnostics[3]  = oem.cost_y;
+        oem_diagnostics[4]  = static_cast<Numeric>(oem.iterations);
+        x_oem              *= NAN;
+        for (auto& s : oem::handle_nested_exception(e)) {
+          std::stringstream ss{s};
+          std::string t{};
+          while (std::getline(ss, t)) errors.push_back(t.c_str());
+        }
+      }
+
+      model_state_vec     = x_oem;
+      measurement_vec_fit = aw.get_measurement_vec();
+      return;
+    }
+
     oem::AgendaWrapper aw(&ws,
                           (unsigned int)m,
                           (unsigned int)n,
@@ -221,7 +520,6 @@ void OEM(const Workspace& ws,
                           &inversion_iterate_agenda);
     oem::OEM_STANDARD<oem::AgendaWrapper> oem(aw, xa_oem, Sa, Se);
     oem::OEM_MFORM<oem::AgendaWrapper> oem_m(aw, xa_oem, Sa, Se);
-    int oem_verbosity = static_cast<int>(display_progress);
 
     int return_code = 0;
 
@@ -278,14 +576,6 @@ void OEM(const Workspace& ws,
         oem_diagnostics[0] = static_cast<Index>(return_code);
       } else if ((method == "lm") || (method == "ml")) {
         oem::Std s(T, apply_norm);
-        Sparse diagonal =
-            Sparse::diagonal(model_state_covmat.inverse_diagonal());
-        CovarianceMatrix SaDiag{};
-        SaDiag.add_correlation_inverse(
-            Block(Range(0, n),
-                  Range(0, n),
-                  std::make_pair(0, 0),
-                  std::make_shared<Sparse>(diagonal)));
         oem::CovarianceMatrix SaInvLM = inv(oem::CovarianceMatrix(SaDiag));
         oem::LM lm(SaInvLM, s);
 
@@ -307,14 +597,6 @@ void OEM(const Workspace& ws,
       } else if ((method == "lm_cg") || (method == "ml_cg")) {
         oem::CG cg(T, apply_norm, 1e-10, 0);
 
-        Sparse diagonal =
-            Sparse::diagonal(model_state_covmat.inverse_diagonal());
-        CovarianceMatrix SaDiag{};
-        SaDiag.add_correlation_inverse(
-            Block(Range(0, n),
-                  Range(0, n),
-                  std::make_pair(0, 0),
-                  std::make_shared<Sparse>(diagonal)));
         oem::LM_CG lm(SaDiag, cg);
 
         lm.set_maximum_iterations((unsigned int)max_iter);
@@ -371,6 +653,340 @@ void OEM(const Workspace& ws,
     }
   }
 }
+}  // namespace
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void OEM(const Workspace& ws,
+         Vector& model_state_vec,
+         Vector& measurement_vec_fit,
+         Matrix& measurement_jac,
+         AtmField& atm_field,
+         AbsorptionBands& abs_bands,
+         ArrayOfSensorObsel& measurement_sensor,
+         SurfaceField& surf_field,
+         SubsurfaceField& subsurf_field,
+         Matrix& measurement_gain_mat,
+         Vector& oem_diagnostics,
+         Vector& lm_ga_history,
+         ArrayOfString& errors,
+         const JacobianTargets& jac_targets,
+         const Vector& model_state_vec_apriori,
+         const CovarianceMatrix& model_state_covmat,
+         const Vector& measurement_vec,
+         const CovarianceMatrix& measurement_vec_error_covmat,
+         const Agenda& inversion_iterate_agenda,
+         const String& method,
+         const Numeric& max_start_cost,
+         const Vector& model_state_covmat_normalization,
+         const Index& max_iter,
+         const Numeric& stop_dx,
+         const Vector& lm_ga_settings,
+         const Index& clear_matrices,
+         const Index& display_progress,
+         const Index& jac_chunk_size) {
+  ARTS_TIME_REPORT
+
+  // Checks
+  model_state_covmat.compute_inverse();
+  measurement_vec_error_covmat.compute_inverse();
+
+  OEM_checks(ws,
+             model_state_vec,
+             measurement_vec_fit,
+             measurement_jac,
+             atm_field,
+             abs_bands,
+             measurement_sensor,
+             surf_field,
+             subsurf_field,
+             jac_targets,
+             inversion_iterate_agenda,
+             model_state_vec_apriori,
+             model_state_covmat,
+             measurement_vec,
+             measurement_vec_error_covmat,
+             method,
+             model_state_covmat_normalization,
+             max_iter,
+             stop_dx,
+             lm_ga_settings,
+             clear_matrices,
+             display_progress,
+             jac_chunk_size);
+
+  oem_inversion(ws,
+                model_state_vec,
+                measurement_vec_fit,
+                measurement_jac,
+                atm_field,
+                abs_bands,
+                measurement_sensor,
+                surf_field,
+                subsurf_field,
+                measurement_gain_mat,
+                oem_diagnostics,
+                lm_ga_history,
+                errors,
+                jac_targets,
+                model_state_vec_apriori,
+                model_state_covmat,
+                measurement_vec,
+                measurement_vec_error_covmat,
+                inversion_iterate_agenda,
+                method,
+                max_start_cost,
+                model_state_covmat_normalization,
+                max_iter,
+                stop_dx,
+                lm_ga_settings,
+                clear_matrices,
+                display_progress,
+                jac_chunk_size,
+                is_lm(method) ? lm_covmat(model_state_covmat)
+                              : CovarianceMatrix{});
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void OEMBatch(const Workspace& ws,
+              Matrix& model_state_vecs,
+              Matrix& measurement_vec_fits,
+              Matrix& oem_diagnostics,
+              ArrayOfString& errors,
+              const AtmField& atm_field,
+              const AbsorptionBands& abs_bands,
+              const ArrayOfSensorObsel& measurement_sensor,
+              const SurfaceField& surf_field,
+              const SubsurfaceField& subsurf_field,
+              const JacobianTargets& jac_targets,
+              const Vector& model_state_vec_apriori,
+              const CovarianceMatrix& model_state_covmat,
+              const CovarianceMatrix& measurement_vec_error_covmat,
+              const Agenda& inversion_iterate_agenda,
+              const Matrix& measurement_vecs,
+              const String& method,
+              const Numeric& max_start_cost,
+              const Vector& model_state_covmat_normalization,
+              const Index& max_iter,
+              const Numeric& stop_dx,
+              const Vector& lm_ga_settings,
+              const String& checkpoint_file,
+              const Index& checkpoint_interval,
+              const Index& display_progress,
+              const Index& jac_chunk_size) {
+  ARTS_TIME_REPORT
+
+  // Main sizes
+  const Index nr = measurement_vecs.nrows();
+  const Index n  = model_state_covmat.nrows();
+  const Index m  = measurement_vecs.ncols();
+
+  ARTS_USER_ERROR_IF(nr == 0, "No measurements in *measurement_vecs*")
+  ARTS_USER_ERROR_IF(checkpoint_interval < 1,
+                     "The checkpoint interval must be > 0, is {}",
+                     checkpoint_interval)
+
+  // The covariance matrices are shared, so they are inverted once
+  model_state_covmat.compute_inverse();
+  measurement_vec_error_covmat.compute_inverse();
+  const CovarianceMatrix SaDiag =
+      is_lm(method) ? lm_covmat(model_state_covmat) : CovarianceMatrix{};
+
+  // All retrievals start at the a priori state, so the checks and the
+  // simulation of the a priori state are shared
+  Vector x{}, yf{};
+  Matrix jac{};
+  AtmField atm_field_a{atm_field};
+  AbsorptionBands abs_bands_a{abs_bands};
+  ArrayOfSensorObsel measurement_sensor_a{measurement_sensor};
+  SurfaceField surf_field_a{surf_field};
+  SubsurfaceField subsurf_field_a{subsurf_field};
+
+  OEM_checks(ws,
+             x,
+             yf,
+             jac,
+             atm_field_a,
+             abs_bands_a,
+             measurement_sensor_a,
+             surf_field_a,
+             subsurf_field_a,
+             jac_targets,
+             inversion_iterate_agenda,
+             model_state_vec_apriori,
+             model_state_covmat,
+             Vector{measurement_vecs[0]},
+             measurement_vec_error_covmat,
+             method,
+             model_state_covmat_normalization,
+             max_iter,
+             stop_dx,
+             lm_ga_settings,
+             1,
+             display_progress,
+             jac_chunk_size);
+
+  model_state_vecs.resize(nr, n);
+  model_state_vecs = NAN;
+  measurement_vec_fits.resize(nr, m);
+  measurement_vec_fits = NAN;
+  oem_diagnostics.resize(nr, 5);
+  oem_diagnostics = NAN;
+  errors.clear();
+
+  // Only the inversions that are not in the checkpoint are done
+  std::vector<bool> done(nr, false);
+  std::optional<batch_checkpoint> checkpoint;
+  if (not checkpoint_file.empty()) {
+    const auto hash = static_cast<std::uint64_t>(
+        batch_hash(measurement_vecs,
+                   model_state_vec_apriori,
+                   model_state_covmat,
+                   measurement_vec_error_covmat,
+                   method,
+                   atm_field,
+                   abs_bands,
+                   measurement_sensor,
+                   surf_field,
+                   subsurf_field,
+                   jac_targets,
+                   model_state_covmat_normalization,
+                   max_iter,
+                   stop_dx,
+                   lm_ga_settings));
+
+    checkpoint.emplace(add_basedir(checkpoint_file), nr, n, m);
+    const std::vector<Numeric> records = checkpoint->open(hash);
+
+    const Index nrec = checkpoint->record_size();
+    for (Size k = 0; k < records.size(); k += nrec) {
+      const auto i = static_cast<Index>(records[k]);
+      ARTS_USER_ERROR_IF(
+          i < 0 or i >= nr or records[k] != static_cast<Numeric>(i),
+                         "The checkpoint \"{}\" has a record of row {}",
+                         checkpoint_file,
+                         records[k])
+
+      const auto rec = records.begin() + k + 1;
+      done[i]        = true;
+      std::copy(rec, rec + 5, oem_diagnostics[i].begin());
+      std::copy(rec + 5, rec + 5 + n, model_state_vecs[i].begin());
+      std::copy(rec + 5 + n, rec + 5 + n + m, measurement_vec_fits[i].begin());
+    }
+  }
+
+  Index ndone = stdr::count(done, true);
+  std::string error{};
+
+  // The records of the inversions done since the last append, the appends
+  // themselves are not in the critical section
+  std::vector<Numeric> pending;
+  Index npending = 0;
+
+  // Retrievals take very different times, so they are scheduled dynamically
+#pragma omp parallel for schedule(dynamic) if (arts_omp_parallel(-1, nr > 1))
+  for (Index i = 0; i < nr; i++) {
+    if (done[i]) continue;
+
+    Vector model_state_vec{x}, measurement_vec_fit{yf};
+    Vector diagnostics, lm_ga_history;
+    Matrix measurement_jac{jac}, measurement_gain_mat;
+    ArrayOfString errs;
+
+    try {
+      AtmField atm_field_i{atm_field_a};
+      AbsorptionBands abs_bands_i{abs_bands_a};
+      ArrayOfSensorObsel measurement_sensor_i{measurement_sensor_a};
+      SurfaceField surf_field_i{surf_field_a};
+      SubsurfaceField subsurf_field_i{subsurf_field_a};
+
+      oem_inversion(ws,
+                    model_state_vec,
+                    measurement_vec_fit,
+                    measurement_jac,
+                    atm_field_i,
+                    abs_bands_i,
+                    measurement_sensor_i,
+                    surf_field_i,
+                    subsurf_field_i,
+                    measurement_gain_mat,
+                    diagnostics,
+                    lm_ga_history,
+                    errs,
+                    jac_targets,
+                    model_state_vec_apriori,
+                    model_state_covmat,
+                    Vector{measurement_vecs[i]},
+                    measurement_vec_error_covmat,
+                    inversion_iterate_agenda,
+                    method,
+                    max_start_cost,
+                    model_state_covmat_normalization,
+                    max_iter,
+                    stop_dx,
+                    lm_ga_settings,
+                    1,
+                    0,
+                    jac_chunk_size,
+                    SaDiag);
+    } catch (const std::exception& e) {
+      diagnostics.resize(5);
+      diagnostics    = NAN;
+      diagnostics[0] = 9;
+      model_state_vec.resize(n);
+      model_state_vec = NAN;
+      measurement_vec_fit.resize(m);
+      measurement_vec_fit = NAN;
+      errs.push_back(e.what());
+    }
+
+    std::vector<Numeric> to_append;
+
+#pragma omp critical
+    {
+      try {
+        oem_diagnostics[i]      = diagnostics;
+        model_state_vecs[i]     = model_state_vec;
+        measurement_vec_fits[i] = measurement_vec_fit;
+        for (auto& e : errs) errors.push_back(std::format("{}: {}", i, e));
+
+        ndone++;
+        if (display_progress) {
+          std::cout << std::format("   OEM retrieval {} done ({} of {})\n",
+                                   i,
+                                   ndone,
+                                   nr);
+        }
+
+        if (checkpoint) {
+          checkpoint->record(pending,
+                             i,
+                             oem_diagnostics[i],
+                             model_state_vecs[i],
+                             measurement_vec_fits[i]);
+          if (++npending == checkpoint_interval) {
+            to_append.swap(pending);
+            npending = 0;
+          }
+        }
+      } catch (const std::exception& e) {
+        if (error.empty()) error = e.what();
+      }
+    }
+
+    if (not to_append.empty()) {
+      try {
+        checkpoint->append(to_append);
+      } catch (const std::exception& e) {
+#pragma omp critical
+        if (error.empty()) error = e.what();
+      }
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+
+  if (not pending.empty()) checkpoint->append(pending);
+}
 
 void measurement_vec_error_covmat_observation_systemCalc(
     Matrix& measurement_vec_error_covmat_observation_system,
@@ -13,7 +13,7 @@ Numeric surf_tangent_zenithFromAgenda(const Workspace& ws,
   Numeric za0 = 180.0, za1 = 90.0;
   while (std::nextafter(za0, za1) != za1) {
     const Numeric za = std::midpoint(za0, za1);
-    ray_path_observer_agendaExecute(
+    ray_path_observer_agendaRun(
         ws, ray_path, pos, {za, azimuth}, ray_path_observer_agenda);
 
     // za0 points at surface, za1 points at space
@@ -181,21 +181,21 @@ void ray_path_fieldFluxProfile(
   // 4 extra points already added by
   ray_path_field.resize(looking_down.size() + looking_up.size());
 
-  ray_path_observer_agendaExecute(ws,
-                                  ray_path_field.front(),
-                                  {alt_g.front(), lat, lon},
-                                  {0, azimuth},
-                                  ray_path_observer_agenda);
+  ray_path_observer_agendaRun(ws,
+                              ray_path_field.front(),
+                              {alt_g.front(), lat, lon},
+                              {0, azimuth},
+                              ray_path_observer_agenda);
 
   String error;
 #pragma omp parallel for if (not arts_omp_in_parallel())
   for (Size i = 1; i < looking_up.size() - 1; i++) {
     try {
-      ray_path_observer_agendaExecute(ws,
-                                      ray_path_field[i],
-                                      {alt_g.front(), lat, lon},
-                                      {looking_up[i], azimuth},
-                                      ray_path_observer_agenda);
+      ray_path_observer_agendaRun(ws,
+                                  ray_path_field[i],
+                                  {alt_g.front(), lat, lon},
+                                  {looking_up[i], azimuth},
+                                  ray_path_observer_agenda);
     } catch (const std::exception& e) {
 #pragma omp critical
       if (error.empty()) error = e.what();
@@ -203,26 +203,26 @@ void ray_path_fieldFluxProfile(
   }
   if (not error.empty()) throw std::runtime_error(error);
 
-  ray_path_observer_agendaExecute(ws,
-                                  ray_path_field[looking_up.size() - 1],
-                                  {alt_g.back(), lat, lon},
-                                  {za_limb_miss, azimuth},
-                                  ray_path_observer_agenda);
+  ray_path_observer_agendaRun(ws,
+                              ray_path_field[looking_up.size() - 1],
+                              {alt_g.back(), lat, lon},
+                              {za_limb_miss, azimuth},
+                              ray_path_observer_agenda);
 
-  ray_path_observer_agendaExecute(ws,
-                                  ray_path_field[looking_up.size()],
-                                  {alt_g.back(), lat, lon},
-                                  {za_limb_hit, azimuth},
-                                  ray_path_observer_agenda);
+  ray_path_observer_agendaRun(ws,
+                              ray_path_field[looking_up.size()],
+                              {alt_g.back(), lat, lon},
+                              {za_limb_hit, azimuth},
+                              ray_path_observer_agenda);
 
 #pragma omp parallel for if (not arts_omp_in_parallel())
   for (Size i = 1; i < looking_down.size() - 1; i++) {
     try {
-      ray_path_observer_agendaExecute(ws,
-                                      ray_path_field[looking_up.size() + i],
-                                      {alt_g.back(), lat, lon},
-                                      {looking_down[i], azimuth},
-                                      ray_path_observer_agenda);
+      ray_path_observer_agendaRun(ws,
+                                  ray_path_field[looking_up.size() + i],
+                                  {alt_g.back(), lat, lon},
+                                  {looking_down[i], azimuth},
+                                  ray_path_observer_agenda);
     } catch (const std::exception& e) {
 #pragma omp critical
       if (error.empty()) error = e.what();
@@ -230,11 +230,11 @@ void ray_path_fieldFluxProfile(
   }
   if (not error.empty()) throw std::runtime_error(error);
 
-  ray_path_observer_agendaExecute(ws,
-                                  ray_path_field.back(),
-                                  {alt_g.back(), lat, lon},
-                                  {180, azimuth},
-                                  ray_path_observer_agenda);
+  ray_path_observer_agendaRun(ws,
+                              ray_path_field.back(),
+                              {alt_g.back(), lat, lon},
+                              {180, azimuth},
+                              ray_path_observer_agenda);
 
   std::erase_if(ray_path_field, [](const auto& x) { return x.size() < 2; });
 }
@@ -256,11 +256,11 @@ void ray_path_fieldFromObserverAgenda(
 #pragma omp parallel for if (not arts_omp_in_parallel())
   for (Size i = 0; i < N; i++) {
     try {
-      ray_path_observer_agendaExecute(ws,
-                                      ray_path_field[i],
-                                      ray_path_observers[i].pos,
-                                      ray_path_observers[i].los,
-                                      ray_path_observer_agenda);
+      ray_path_observer_agendaRun(ws,
+                                  ray_path_field[i],
+                                  ray_path_observers[i].pos,
+                                  ray_path_observers[i].los,
+                                  ray_path_observer_agenda);
     } catch (const std::exception& e) {
 #pragma omp critical
       error = e.what();
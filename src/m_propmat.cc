@@ -42,18 +42,18 @@ freq_wind_shift_jac_path size: {} element(s)
 #pragma omp parallel for if (!arts_omp_in_parallel())
   for (Size ip = 0; ip < np; ip++) {
     try {
-      spectral_propmat_agendaExecute(ws,
-                                     spectral_propmat_path[ip],
-                                     spectral_nlte_srcvec_path[ip],
-                                     spectral_propmat_jac_path[ip],
-                                     spectral_nlte_srcvec_jac_path[ip],
-                                     freq_grid_path[ip],
-                                     freq_wind_shift_jac_path[ip],
-                                     jac_targets,
-                                     {},
-                                     ray_path[ip],
-                                     atm_path[ip],
-                                     spectral_propmat_agenda);
+      spectral_propmat_agendaRun(ws,
+                                 spectral_propmat_path[ip],
+                                 spectral_nlte_srcvec_path[ip],
+                                 spectral_propmat_jac_path[ip],
+                                 spectral_nlte_srcvec_jac_path[ip],
+                                 freq_grid_path[ip],
+                                 freq_wind_shift_jac_path[ip],
+                                 jac_targets,
+                                 {},
+                                 ray_path[ip],
+                                 atm_path[ip],
+                                 spectral_propmat_agenda);
     } catch (const std::runtime_error &e) {
 #pragma omp critical
       if (error.empty()) error = e.what();
@@ -64,6 +64,136 @@ freq_wind_shift_jac_path size: {} element(s)
 }
 ARTS_METHOD_ERROR_CATCH
 
+void spectral_pathFromPath(const Workspace &ws,
+                           SpectralPath &spectral_path,
+                           const Agenda &spectral_propmat_agenda,
+                           const ArrayOfAscendingGrid &freq_grid_path,
+                           const ArrayOfVector3 &freq_wind_shift_jac_path,
+                           const JacobianTargets &jac_targets,
+                           const ArrayOfPropagationPathPoint &ray_path,
+                           const ArrayOfAtmPoint &atm_path) try {
+  ARTS_TIME_REPORT
+
+  ARTS_USER_ERROR_IF(
+      not arr::same_size(
+          ray_path, atm_path, freq_grid_path, freq_wind_shift_jac_path),
+      R"(Not same size:
+
+ray_path                 size: {} element(s)
+atm_path                 size: {} element(s)
+freq_grid_path           size: {} element(s)
+freq_wind_shift_jac_path size: {} element(s)
+)",
+      ray_path.size(),
+      atm_path.size(),
+      freq_grid_path.size(),
+      freq_wind_shift_jac_path.size())
+
+  ARTS_USER_ERROR_IF(not arr::elemwise_same_size(freq_grid_path),
+                     "All frequency grids of *freq_grid_path* must be of "
+                     "the same size")
+
+  const Size np = ray_path.size();
+  const Size nf = np == 0 ? 0 : freq_grid_path.front().size();
+  const Size nq = jac_targets.target_count();
+  spectral_path.resize(nf, np, nq);
+
+  String error{};
+
+  // Each point is written to its column as soon as it is computed, so only
+  // one point per thread is ever held in the point-major layout
+#pragma omp parallel for if (!arts_omp_in_parallel())
+  for (Size ip = 0; ip < np; ip++) {
+    try {
+      PropmatVector spectral_propmat;
+      StokvecVector spectral_nlte_srcvec;
+      PropmatMatrix spectral_propmat_jac;
+      StokvecMatrix spectral_nlte_srcvec_jac;
+
+      spectral_propmat_agendaRun(ws,
+                                 spectral_propmat,
+                                 spectral_nlte_srcvec,
+                                 spectral_propmat_jac,
+                                 spectral_nlte_srcvec_jac,
+                                 freq_grid_path[ip],
+                                 freq_wind_shift_jac_path[ip],
+                                 jac_targets,
+                                 {},
+                                 ray_path[ip],
+                                 atm_path[ip],
+                                 spectral_propmat_agenda);
+
+      ARTS_USER_ERROR_IF(
+          spectral_propmat.size() != nf or spectral_nlte_srcvec.size() != nf or
+              not same_shape({nq, nf}, spectral_propmat_jac) or
+              not same_shape({nq, nf}, spectral_nlte_srcvec_jac),
+          "Bad shapes of the spectral_propmat_agenda output at point {}",
+          ip)
+
+      spectral_path.set_point(ip,
+                              freq_grid_path[ip],
+                              spectral_propmat,
+                              spectral_nlte_srcvec,
+                              spectral_propmat_jac,
+                              spectral_nlte_srcvec_jac);
+    } catch (const std::runtime_error &e) {
+#pragma omp critical
+      if (error.empty()) error = e.what();
+    }
+  }
+
+  if (not error.empty()) throw std::runtime_error(error);
+}
+ARTS_METHOD_ERROR_CATCH
+
+void spectral_pathFromPropmatPath(
+    SpectralPath &spectral_path,
+    const ArrayOfAscendingGrid &freq_grid_path,
+    const ArrayOfPropmatVector &spectral_propmat_path,
+    const ArrayOfStokvecVector &spectral_nlte_srcvec_path,
+    const ArrayOfPropmatMatrix &spectral_propmat_jac_path,
+    const ArrayOfStokvecMatrix &spectral_nlte_srcvec_jac_path) try {
+  ARTS_TIME_REPORT
+
+  ARTS_USER_ERROR_IF(not arr::same_size(freq_grid_path,
+                                        spectral_propmat_path,
+                                        spectral_nlte_srcvec_path,
+                                        spectral_propmat_jac_path,
+                                        spectral_nlte_srcvec_jac_path),
+                     R"(Not same sizes:
+
+freq_grid_path.size()                = {},
+spectral_propmat_path.size()         = {},
+spectral_nlte_srcvec_path.size()     = {},
+spectral_propmat_jac_path.size()     = {},
+spectral_nlte_srcvec_jac_path.size() = {}
+)",
+                     freq_grid_path.size(),
+                     spectral_propmat_path.size(),
+                     spectral_nlte_srcvec_path.size(),
+                     spectral_propmat_jac_path.size(),
+                     spectral_nlte_srcvec_jac_path.size());
+
+  ARTS_USER_ERROR_IF(
+      not arr::elemwise_same_size(
+          freq_grid_path, spectral_propmat_path, spectral_nlte_srcvec_path),
+      "Not same sizes elemwise: freq_grid_path, spectral_propmat_path, "
+      "and spectral_nlte_srcvec_path")
+
+  ARTS_USER_ERROR_IF(
+      not arr::elemwise_same_size(spectral_propmat_jac_path,
+                                  spectral_nlte_srcvec_jac_path),
+      "Not same sizes elemwise: spectral_propmat_jac_path and "
+      "spectral_nlte_srcvec_jac_path")
+
+  spectral_path.set(freq_grid_path,
+                    spectral_propmat_path,
+                    spectral_nlte_srcvec_path,
+                    spectral_propmat_jac_path,
+                    spectral_nlte_srcvec_jac_path);
+}
+ARTS_METHOD_ERROR_CATCH
+
 void spectral_propmat_pathAdaptiveHalfPath(
     const Workspace &ws,
     ArrayOfPropmatVector &spectral_propmat_path,
@@ -207,7 +337,7 @@ void spectral_propmat_path_species_splitFromPath(
   for (Size is = 0; is < ns; is++) {
     for (Size ip = 0; ip < np; ip++) {
       try {
-        spectral_propmat_agendaExecute(
+        spectral_propmat_agendaRun(
             ws,
             spectral_propmat_path_species_split[is][ip],
             spectral_nlte_srcvec_path_species_split[is][ip],
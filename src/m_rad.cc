@@ -226,18 +226,18 @@ freq_grid.size()         = {}
                   const Vector3 &pos2,
                   const Vector2 &los2,
                   const Numeric d) {
-    spectral_rad_observer_agendaExecute(ws,
-                                        dsrad,
-                                        spectral_rad_jac_empty,
-                                        ray_path,
-                                        freq_grid_2,
-                                        jac_targets_empty,
-                                        pos2,
-                                        los2,
-                                        atm_field,
-                                        surf_field,
-                                        subsurf_field,
-                                        spectral_rad_observer_agenda);
+    spectral_rad_observer_agendaRun(ws,
+                                    dsrad,
+                                    spectral_rad_jac_empty,
+                                    ray_path,
+                                    freq_grid_2,
+                                    jac_targets_empty,
+                                    pos2,
+                                    los2,
+                                    atm_field,
+                                    surf_field,
+                                    subsurf_field,
+                                    spectral_rad_observer_agenda);
 
     // Convert to perturbed Jacobian
     dsrad -= spectral_rad;
@@ -329,18 +329,18 @@ void low_memory(
       StokvecMatrix spectral_rad_jac;
       ArrayOfPropagationPathPoint ray_path;
 
-      spectral_rad_observer_agendaExecute(ws,
-                                          spectral_rad,
-                                          spectral_rad_jac,
-                                          ray_path,
-                                          freq_grid,
-                                          jac_targets,
-                                          poslos.pos,
-                                          poslos.los,
-                                          atm_field,
-                                          surf_field,
-                                          subsurf_field,
-                                          spectral_rad_observer_agenda);
+      spectral_rad_observer_agendaRun(ws,
+                                      spectral_rad,
+                                      spectral_rad_jac,
+                                      ray_path,
+                                      freq_grid,
+                                      jac_targets,
+                                      poslos.pos,
+                                      poslos.los,
+                                      atm_field,
+                                      surf_field,
+                                      subsurf_field,
+                                      spectral_rad_observer_agenda);
 
       ARTS_USER_ERROR_IF(ray_path.empty(), "No ray path found");
       spectral_rad_transform_operator(
@@ -414,18 +414,18 @@ void high_performance(
       auto &[spectral_rad, spectral_rad_jac] =
           cache.at(&freq_grid).at(&poslos_vec).at(ip);
 
-      spectral_rad_observer_agendaExecute(ws,
-                                          spectral_rad,
-                                          spectral_rad_jac,
-                                          ray_path,
-                                          freq_grid,
-                                          jac_targets,
-                                          poslos_vec[ip].pos,
-                                          poslos_vec[ip].los,
-                                          atm_field,
-                                          surf_field,
-                                          subsurf_field,
-                                          spectral_rad_observer_agenda);
+      spectral_rad_observer_agendaRun(ws,
+                                      spectral_rad,
+                                      spectral_rad_jac,
+                                      ray_path,
+                                      freq_grid,
+                                      jac_targets,
+                                      poslos_vec[ip].pos,
+                                      poslos_vec[ip].los,
+                                      atm_field,
+                                      surf_field,
+                                      subsurf_field,
+                                      spectral_rad_observer_agenda);
 
       ARTS_USER_ERROR_IF(ray_path.empty(), "No ray path found");
       spectral_rad_transform_operator(
@@ -464,6 +464,119 @@ void high_performance(
     }
   }
 }
+
+//! A simulation of the streaming kernel, kept until its round is summed up
+struct streamed_simulation {
+  Size i{};
+  StokvecVector spectral_rad{};
+  StokvecMatrix spectral_rad_jac{};
+  ArrayOfPropagationPathPoint ray_path{};
+};
+
+void streaming(
+    const Workspace &ws,
+    Vector &measurement_vec,
+    Matrix &measurement_jac,
+    const ArrayOfSensorObsel &measurement_sensor,
+    const JacobianTargets &jac_targets,
+    const AtmField &atm_field,
+    const SurfaceField &surf_field,
+    const SubsurfaceField &subsurf_field,
+    const SpectralRadianceTransformOperator &spectral_rad_transform_operator,
+    const Agenda &spectral_rad_observer_agenda,
+    const SensorSimulations &simulations) {
+  ARTS_TIME_REPORT
+
+  const Size N = simulations.size();
+  const Size M = measurement_vec.size();
+  const Size S = arts_omp_get_max_threads();
+
+  //! Each owner sums up a contiguous block of rows of the measurement, so
+  //! that no two owners write to the same cache line but at the block edges
+  std::vector<std::unordered_map<const AscendingGrid *, std::vector<Size>>>
+      owned(S);
+  for (Size owner = 0; owner < S; owner++) {
+    const Size first = owner * M / S;
+    const Size last  = (owner + 1) * M / S;
+    for (Size iv = first; iv < last; ++iv) {
+      owned[owner][&measurement_sensor[iv].f_grid()].push_back(iv);
+    }
+  }
+
+  //! A few simulations per core and round, so that a single slow simulation
+  //! does not keep all other cores waiting for the end of the round
+  constexpr Size slots_per_core = 4;
+  std::vector<streamed_simulation> slots(slots_per_core * S);
+
+  std::string error{};
+
+  //! Rounds of one simulation per slot, each summed up before the next.  A
+  //! row of the measurement is only ever summed up by its owner, in slot
+  //! order, so the sum does not depend on the timing or the team size.
+#pragma omp parallel if (arts_omp_parallel(-1, N > 1))
+  for (Size i0 = 0; i0 < N; i0 += slots.size()) {
+#pragma omp for schedule(dynamic)
+    for (Size s = 0; s < slots.size(); s++) {
+      auto &slot = slots[s];
+      slot.i     = i0 + s;
+      if (slot.i >= N) continue;
+
+      try {
+        const Size ip         = simulations[slot.i].iposlos;
+        const auto &freq_grid = simulations[slot.i].freq_grid;
+        const auto &poslos    = simulations[slot.i].poslos_grid[ip];
+
+        spectral_rad_observer_agendaRun(ws,
+                                        slot.spectral_rad,
+                                        slot.spectral_rad_jac,
+                                        slot.ray_path,
+                                        freq_grid,
+                                        jac_targets,
+                                        poslos.pos,
+                                        poslos.los,
+                                        atm_field,
+                                        surf_field,
+                                        subsurf_field,
+                                        spectral_rad_observer_agenda);
+
+        ARTS_USER_ERROR_IF(slot.ray_path.empty(), "No ray path found");
+        spectral_rad_transform_operator(slot.spectral_rad,
+                                        slot.spectral_rad_jac,
+                                        freq_grid,
+                                        slot.ray_path.front());
+      } catch (const std::exception &e) {
+#pragma omp critical
+        if (error.empty()) {
+          error = std::format("Error in unflattening data for index {}: {}\n",
+                              slot.i,
+                              e.what());
+        }
+        slot.i = N;
+      }
+    }
+
+#pragma omp for schedule(static)
+    for (Size owner = 0; owner < S; owner++) {
+      const auto &rows = owned[owner];
+      for (auto &slot : slots) {
+        if (slot.i >= N) continue;
+
+        const auto ptr = rows.find(&simulations[slot.i].freq_grid);
+        if (ptr == rows.end()) continue;
+
+        const Size ip = simulations[slot.i].iposlos;
+        for (Size iv : ptr->second) {
+          const SensorObsel &obsel = measurement_sensor[iv];
+
+          measurement_vec[iv] += obsel.sumup(slot.spectral_rad, ip);
+          obsel.sumup(measurement_jac[iv], slot.spectral_rad_jac, ip);
+        }
+      }
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "Errors occurred:\n{:}", error);
+}
 }  // namespace
 
 void measurement_vecFromSensor(
@@ -521,6 +634,19 @@ void measurement_vecFromSensor(
                        spectral_rad_observer_agenda,
                        simulations);
       break;
+    case Streaming:
+      streaming(ws,
+                measurement_vec,
+                measurement_jac,
+                measurement_sensor,
+                jac_targets,
+                atm_field,
+                surf_field,
+                subsurf_field,
+                spectral_rad_transform_operator,
+                spectral_rad_observer_agenda,
+                simulations);
+      break;
   }
 }
 ARTS_METHOD_ERROR_CATCH
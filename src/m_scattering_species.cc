@@ -151,7 +151,7 @@ void spectral_propmat_scat_pathFromSpectralAgenda(
 #pragma omp parallel for if (not arts_omp_in_parallel())
   for (Size i = 0; i < N; i++) {
     try {
-      spectral_propmat_scat_spectral_agendaExecute(
+      spectral_propmat_scat_spectral_agendaRun(
           ws,
           spectral_propmat_scat_path[i],
           spectral_absvec_scat_path[i],
@@ -74,15 +74,16 @@ void spectral_radCumulativeTransmission(
 ARTS_METHOD_ERROR_CATCH
 
 namespace {
-void single_tramat_pathFromPath(MuelmatVector& single_tramat_path,
-                                MuelmatTensor3& single_tramat_jac_path,
-                                const PropmatVector& single_propmat_path,
-                                const PropmatMatrix& single_propmat_jac_path,
-                                const ArrayOfPropagationPathPoint& ray_path,
-                                const ArrayOfAtmPoint& atm_path,
-                                const SurfaceField& surf_field,
-                                const JacobianTargets& jac_targets,
-                                const Index& hse_derivative) try {
+void single_tramat_pathFromPath(
+    MuelmatVector& single_tramat_path,
+    MuelmatTensor3& single_tramat_jac_path,
+    const PropmatConstVectorView& single_propmat_path,
+    const PropmatConstMatrixView& single_propmat_jac_path,
+    const ArrayOfPropagationPathPoint& ray_path,
+    const ArrayOfAtmPoint& atm_path,
+    const SurfaceField& surf_field,
+    const JacobianTargets& jac_targets,
+    const Index& hse_derivative) try {
   ARTS_TIME_REPORT
 
   const Size N  = ray_path.size();
@@ -171,11 +172,11 @@ ARTS_METHOD_ERROR_CATCH
 void single_rad_srcvec_jacFromPropmat(
     StokvecVector& single_rad_srcvec_jac,
     StokvecMatrix& single_rad_srcvec_jac_path,
-    const PropmatVector& single_propmat_path,
-    const StokvecVector& single_nlte_srcvec_path,
-    const PropmatMatrix& single_propmat_jac_path,
-    const StokvecMatrix& single_nlte_srcvec_jac_path,
-    const Vector& single_freq_path,
+    const PropmatConstVectorView& single_propmat_path,
+    const StokvecConstVectorView& single_nlte_srcvec_path,
+    const PropmatConstMatrixView& single_propmat_jac_path,
+    const StokvecConstMatrixView& single_nlte_srcvec_jac_path,
+    const ConstVectorView& single_freq_path,
     const ArrayOfAtmPoint& atm_path,
     const JacobianTargets& jac_targets) try {
   ARTS_TIME_REPORT
@@ -362,25 +363,26 @@ single_rad_jac_path: (np, nq) = {:B,}
 }
 ARTS_METHOD_ERROR_CATCH
 
-void single_radFromPropagation(Stokvec& single_rad,
-                               StokvecVector& single_rad_jac,
-                               StokvecVector& single_rad_srcvec_jac,
-                               StokvecMatrix& single_rad_srcvec_jac_path,
-                               StokvecMatrix& single_rad_jac_path,
-                               MuelmatVector& single_tramat_path,
-                               MuelmatVector& single_tramat_cumulative_path,
-                               MuelmatTensor3& single_tramat_jac_path,
-                               const JacobianTargets& jac_targets,
-                               const ArrayOfPropagationPathPoint& ray_path,
-                               const Vector& single_freq_path,
-                               const ArrayOfAtmPoint& atm_path,
-                               const PropmatVector& single_propmat_path,
-                               const PropmatMatrix& single_propmat_jac_path,
-                               const StokvecVector& single_nlte_srcvec_path,
-                               const StokvecMatrix& single_nlte_srcvec_jac_path,
-                               const SurfaceField& surf_field,
-                               const AtmField& atm_field,
-                               const Index& hse_derivative) try {
+void single_radFromPropagation(
+    Stokvec& single_rad,
+    StokvecVector& single_rad_jac,
+    StokvecVector& single_rad_srcvec_jac,
+    StokvecMatrix& single_rad_srcvec_jac_path,
+    StokvecMatrix& single_rad_jac_path,
+    MuelmatVector& single_tramat_path,
+    MuelmatVector& single_tramat_cumulative_path,
+    MuelmatTensor3& single_tramat_jac_path,
+    const JacobianTargets& jac_targets,
+    const ArrayOfPropagationPathPoint& ray_path,
+    const ConstVectorView& single_freq_path,
+    const ArrayOfAtmPoint& atm_path,
+    const PropmatConstVectorView& single_propmat_path,
+    const PropmatConstMatrixView& single_propmat_jac_path,
+    const StokvecConstVectorView& single_nlte_srcvec_path,
+    const StokvecConstMatrixView& single_nlte_srcvec_jac_path,
+    const SurfaceField& surf_field,
+    const AtmField& atm_field,
+    const Index& hse_derivative) try {
   ARTS_TIME_REPORT
 
   single_tramat_pathFromPath(single_tramat_path,
@@ -437,12 +439,8 @@ void spectral_radSinglePathEmissionFrequencyLoop(
     StokvecMatrix& spectral_rad_jac,
     const JacobianTargets& jac_targets,
     const ArrayOfPropagationPathPoint& ray_path,
-    const ArrayOfAscendingGrid& freq_grid_path,
     const ArrayOfAtmPoint& atm_path,
-    const ArrayOfPropmatVector& spectral_propmat_path,
-    const ArrayOfStokvecVector& spectral_nlte_srcvec_path,
-    const ArrayOfPropmatMatrix& spectral_propmat_jac_path,
-    const ArrayOfStokvecMatrix& spectral_nlte_srcvec_jac_path,
+    const SpectralPath& spectral_path,
     const SurfaceField& surf_field,
     const AtmField& atm_field,
     const Index& hse_derivative) try {
@@ -465,53 +463,31 @@ Actual:   ({}, {})
                      spectral_rad_jac.nrows(),
                      spectral_rad_jac.ncols());
 
-  ARTS_USER_ERROR_IF(not arr::same_size(ray_path,
-                                        freq_grid_path,
-                                        atm_path,
-                                        spectral_propmat_path,
-                                        spectral_nlte_srcvec_path,
-                                        spectral_propmat_jac_path,
-                                        spectral_nlte_srcvec_jac_path),
+  ARTS_USER_ERROR_IF(not arr::same_size(ray_path, atm_path),
                      R"(Not same sizes:
 
-ray_path.size()                      = {},
-freq_grid_path.size()                = {},
-atm_path.size()                      = {},
-spectral_propmat_path.size()         = {},
-spectral_nlte_srcvec_path.size()     = {},
-spectral_propmat_jac_path.size()     = {},
-spectral_nlte_srcvec_jac_path.size() = {}
+ray_path.size() = {},
+atm_path.size() = {}
 )",
                      ray_path.size(),
-                     freq_grid_path.size(),
-                     atm_path.size(),
-                     spectral_propmat_path.size(),
-                     spectral_nlte_srcvec_path.size(),
-                     spectral_propmat_jac_path.size(),
-                     spectral_nlte_srcvec_jac_path.size());
+                     atm_path.size());
 
+  // Frequency-major, so that each frequency reads contiguous path rows
   ARTS_USER_ERROR_IF(
-      not arr::elemwise_same_size(
-          freq_grid_path, spectral_propmat_path, spectral_nlte_srcvec_path),
-      R"(Not same sizes elemwise:
-freq_grid_path.size()             = {}
-spectral_propmat_path.shape()     = {:B,}
-spectral_nlte_srcvec_path.shape() = {:B,}
-)",
-      freq_grid_path.size(),
-      spectral_propmat_path[0].shape(),
-      spectral_nlte_srcvec_path[0].shape());
-
-  ARTS_USER_ERROR_IF(not arr::elemwise_same_size(spectral_propmat_jac_path,
-                                                 spectral_nlte_srcvec_jac_path),
-                     R"(Not same sizes elemwise:
-spectral_propmat_jac_path.shape()     = {:B,}
-spectral_nlte_srcvec_jac_path.shape() = {:B,}
+      (spectral_path.shape() != std::array{nf, N, nq}) or
+          not same_shape({nf, N}, spectral_path.freq) or
+          not same_shape({nf, N}, spectral_path.propmat) or
+          not same_shape({nf, N}, spectral_path.nlte) or
+          not same_shape({nf, N, nq}, spectral_path.nlte_jac),
+      R"(spectral_path has wrong shape:
+Expected: ({}, {}, {}) (frequency x path x jacobian targets)
+Actual:   {:B,}
 )",
-                     spectral_propmat_jac_path[0].shape(),
-                     spectral_nlte_srcvec_jac_path[0].shape());
+      nf,
+      N,
+      nq,
+      spectral_path.shape());
 
-  Vector single_freq_path(N);
   StokvecVector single_rad_jac(nx);
   StokvecVector single_rad_srcvec_jac(N);
   StokvecMatrix single_rad_srcvec_jac_path(N, nq);
@@ -519,38 +495,20 @@ spectral_nlte_srcvec_jac_path.shape() = {:B,}
   MuelmatVector single_tramat_path(N);
   MuelmatVector single_tramat_cumulative_path(N);
   MuelmatTensor3 single_tramat_jac_path(N, 2, nq);
-  PropmatVector single_propmat_path(N);
-  PropmatMatrix single_propmat_jac_path(N, nq);
-  StokvecVector single_nlte_srcvec_path(N);
-  StokvecMatrix single_nlte_srcvec_jac_path(N, nq);
 
   std::string error{};
 
 #pragma omp parallel for firstprivate(     \
-        single_freq_path,                  \
-            single_rad_jac,                \
+        single_rad_jac,                    \
             single_rad_srcvec_jac,         \
             single_rad_srcvec_jac_path,    \
             single_rad_jac_path,           \
             single_tramat_path,            \
             single_tramat_cumulative_path, \
-            single_tramat_jac_path,        \
-            single_propmat_path,           \
-            single_propmat_jac_path,       \
-            single_nlte_srcvec_path,       \
-            single_nlte_srcvec_jac_path) if (arts_omp_parallel(nf))
+            single_tramat_jac_path) if (arts_omp_parallel(nf))
   for (Size f = 0; f < nf; f++) {
     try {
       Stokvec& single_rad = spectral_rad[f];
-      for (Size i = 0; i < N; i++) {
-        single_freq_path[i]        = freq_grid_path[i][f];
-        single_propmat_path[i]     = spectral_propmat_path[i][f];
-        single_nlte_srcvec_path[i] = spectral_nlte_srcvec_path[i][f];
-
-        single_propmat_jac_path[i] = spectral_propmat_jac_path[i][joker, f];
-        single_nlte_srcvec_jac_path[i] =
-            spectral_nlte_srcvec_jac_path[i][joker, f];
-      }
 
       single_rad_jac = spectral_rad_jac[joker, f];
 
@@ -564,12 +522,12 @@ spectral_nlte_srcvec_jac_path.shape() = {:B,}
                                 single_tramat_jac_path,
                                 jac_targets,
                                 ray_path,
-                                single_freq_path,
+                                spectral_path.freq[f],
                                 atm_path,
-                                single_propmat_path,
-                                single_propmat_jac_path,
-                                single_nlte_srcvec_path,
-                                single_nlte_srcvec_jac_path,
+                                spectral_path.propmat[f],
+                                spectral_path.propmat_jac[f],
+                                spectral_path.nlte[f],
+                                spectral_path.nlte_jac[f],
                                 surf_field,
                                 atm_field,
                                 hse_derivative);
@@ -648,26 +606,26 @@ void single_radClearskyEmissionPropagation(
       path::init_with_lostype(obs_pos, obs_los, atm_field, surf_field, true);
 
   if (ray_path.back().los_type == PathPositionType::space) {
-    single_rad_space_agendaExecute(ws,
-                                   single_rad,
-                                   single_rad_jac,
-                                   frequency_,
-                                   jac_targets,
-                                   ray_path.back(),
-                                   single_rad_space_agenda);
+    single_rad_space_agendaRun(ws,
+                               single_rad,
+                               single_rad_jac,
+                               frequency_,
+                               jac_targets,
+                               ray_path.back(),
+                               single_rad_space_agenda);
     return;
   }
 
   if (ray_path.back().los_type == PathPositionType::surface) {
-    single_rad_surface_agendaExecute(ws,
-                                     single_rad,
-                                     single_rad_jac,
-                                     frequency_,
-                                     jac_targets,
-                                     ray_path.back(),
-                                     surf_field,
-                                     subsurf_field,
-                                     single_rad_surface_agenda);
+    single_rad_surface_agendaRun(ws,
+                                 single_rad,
+                                 single_rad_jac,
+                                 frequency_,
+                                 jac_targets,
+                                 ray_path.back(),
+                                 surf_field,
+                                 subsurf_field,
+                                 single_rad_surface_agenda);
     return;
   }
 
@@ -681,26 +639,26 @@ void single_radClearskyEmissionPropagation(
     freqWindShift(frequency, freq_wind_shift_jac, atm_path.back(), ray_point);
     single_freq_path.push_back(frequency);
 
-    single_propmat_agendaExecute(ws,
-                                 single_propmat_path.emplace_back(),
-                                 single_nlte_srcvec_path.emplace_back(),
-                                 single_dispersion,
-                                 single_propmat_jac_path.emplace_back(),
-                                 single_nlte_srcvec_jac_path.emplace_back(),
-                                 single_dispersion_jac,
-                                 frequency,
-                                 freq_wind_shift_jac,
-                                 jac_targets,
-                                 "AIR"_spec,
-                                 ray_point,
-                                 atm_path.back(),
-                                 single_propmat_agenda);
+    single_propmat_agendaRun(ws,
+                             single_propmat_path.emplace_back(),
+                             single_nlte_srcvec_path.emplace_back(),
+                             single_dispersion,
+                             single_propmat_jac_path.emplace_back(),
+                             single_nlte_srcvec_jac_path.emplace_back(),
+                             single_dispersion_jac,
+                             frequency,
+                             freq_wind_shift_jac,
+                             jac_targets,
+                             "AIR"_spec,
+                             ray_point,
+                             atm_path.back(),
+                             single_propmat_agenda);
     single_dispersion += dot(polarization, single_propmat_path.back());
 
     const Numeric A = single_propmat_path.back().A();
     if (A == 0.0) {
       PropagationPathPoint tmp_point;
-      ray_point_back_propagation_agendaExecute(
+      ray_point_back_propagation_agendaRun(
           ws,
           tmp_point,
           ray_path,
@@ -711,7 +669,7 @@ void single_radClearskyEmissionPropagation(
       ray_path.push_back(tmp_point);
     } else {
       PropagationPathPoint tmp_point;
-      ray_point_back_propagation_agendaExecute(
+      ray_point_back_propagation_agendaRun(
           ws,
           tmp_point,
           ray_path,
@@ -723,26 +681,26 @@ void single_radClearskyEmissionPropagation(
     }
 
     if (ray_path.back().los_type == PathPositionType::space) {
-      single_rad_space_agendaExecute(ws,
-                                     single_rad,
-                                     single_rad_jac,
-                                     frequency,
-                                     jac_targets,
-                                     ray_path.back(),
-                                     single_rad_space_agenda);
+      single_rad_space_agendaRun(ws,
+                                 single_rad,
+                                 single_rad_jac,
+                                 frequency,
+                                 jac_targets,
+                                 ray_path.back(),
+                                 single_rad_space_agenda);
       break;
     }
 
     if (ray_path.back().los_type == PathPositionType::surface) {
-      single_rad_surface_agendaExecute(ws,
-                                       single_rad,
-                                       single_rad_jac,
-                                       frequency,
-                                       jac_targets,
-                                       ray_path.back(),
-                                       surf_field,
-                                       subsurf_field,
-                                       single_rad_surface_agenda);
+      single_rad_surface_agendaRun(ws,
+                                   single_rad,
+                                   single_rad_jac,
+                                   frequency,
+                                   jac_targets,
+                                   ray_path.back(),
+                                   surf_field,
+                                   subsurf_field,
+                                   single_rad_surface_agenda);
       break;
     }
 
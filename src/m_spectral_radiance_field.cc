@@ -28,18 +28,18 @@ auto spectral_propmat_pathProfile(const Workspace& ws,
 #pragma omp parallel for if (!arts_omp_in_parallel())
   for (Size ip = 0; ip < np; ip++) {
     try {
-      spectral_propmat_agendaExecute(ws,
-                                     out.k[ip],
-                                     out.s[ip],
-                                     out.dk[ip],
-                                     out.ds[ip],
-                                     freq_grid,
-                                     {},
-                                     {},
-                                     {},
-                                     {},
-                                     atm_path[ip],
-                                     spectral_propmat_agenda);
+      spectral_propmat_agendaRun(ws,
+                                 out.k[ip],
+                                 out.s[ip],
+                                 out.dk[ip],
+                                 out.ds[ip],
+                                 freq_grid,
+                                 {},
+                                 {},
+                                 {},
+                                 {},
+                                 atm_path[ip],
+                                 spectral_propmat_agenda);
     } catch (const std::runtime_error& e) {
 #pragma omp critical
       if (error.empty()) error = e.what();
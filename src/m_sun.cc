@@ -240,22 +240,22 @@ void spectral_propmat_scat_pathFromPath(
   spectral_propmat_scat_path.resize(np);
   if (arts_omp_in_parallel()) {
     for (Size ip = 0; ip < np; ip++) {
-      spectral_propmat_scat_agendaExecute(ws,
-                                          spectral_propmat_scat_path[ip],
-                                          freq_grid_path[ip],
-                                          atm_path[ip],
-                                          spectral_propmat_scat_agenda);
+      spectral_propmat_scat_agendaRun(ws,
+                                      spectral_propmat_scat_path[ip],
+                                      freq_grid_path[ip],
+                                      atm_path[ip],
+                                      spectral_propmat_scat_agenda);
     }
   } else {
     String error{};
 #pragma omp parallel for
     for (Size ip = 0; ip < np; ip++) {
       try {
-        spectral_propmat_scat_agendaExecute(ws,
-                                            spectral_propmat_scat_path[ip],
-                                            freq_grid_path[ip],
-                                            atm_path[ip],
-                                            spectral_propmat_scat_agenda);
+        spectral_propmat_scat_agendaRun(ws,
+                                        spectral_propmat_scat_path[ip],
+                                        freq_grid_path[ip],
+                                        atm_path[ip],
+                                        spectral_propmat_scat_agenda);
       } catch (const std::exception& e) {
 #pragma omp critical
         error += e.what();
@@ -165,14 +165,14 @@ void spectral_radSurfaceReflectance(
 
   MuelmatVector spectral_surf_refl;
   MuelmatMatrix spectral_surf_refl_jac;
-  spectral_surf_refl_agendaExecute(ws,
-                                   spectral_surf_refl,
-                                   spectral_surf_refl_jac,
-                                   freq_grid,
-                                   surf_field,
-                                   ray_point,
-                                   jac_targets,
-                                   spectral_surf_refl_agenda);
+  spectral_surf_refl_agendaRun(ws,
+                               spectral_surf_refl,
+                               spectral_surf_refl_jac,
+                               freq_grid,
+                               surf_field,
+                               ray_point,
+                               jac_targets,
+                               spectral_surf_refl_agenda);
 
   // Get the direction of the incoming radiation
   const Vector2 los = specular_losNormal(
@@ -182,28 +182,28 @@ void spectral_radSurfaceReflectance(
   StokvecVector spectral_rad_surface;
   StokvecMatrix spectral_rad_jac_surface;
 
-  spectral_rad_observer_agendaExecute(ws,
-                                      spectral_rad,
-                                      spectral_rad_jac,
-                                      ray_path,
-                                      freq_grid,
-                                      jac_targets,
-                                      ray_point.pos,
-                                      los,
-                                      atm_field,
-                                      surf_field,
-                                      subsurf_field,
-                                      spectral_rad_observer_agenda);
-
-  spectral_rad_surface_agendaExecute(ws,
-                                     spectral_rad_surface,
-                                     spectral_rad_jac_surface,
-                                     freq_grid,
-                                     jac_targets,
-                                     ray_point,
-                                     surf_field,
-                                     subsurf_field,
-                                     spectral_rad_closed_surface_agenda);
+  spectral_rad_observer_agendaRun(ws,
+                                  spectral_rad,
+                                  spectral_rad_jac,
+                                  ray_path,
+                                  freq_grid,
+                                  jac_targets,
+                                  ray_point.pos,
+                                  los,
+                                  atm_field,
+                                  surf_field,
+                                  subsurf_field,
+                                  spectral_rad_observer_agenda);
+
+  spectral_rad_surface_agendaRun(ws,
+                                 spectral_rad_surface,
+                                 spectral_rad_jac_surface,
+                                 freq_grid,
+                                 jac_targets,
+                                 ray_point,
+                                 surf_field,
+                                 subsurf_field,
+                                 spectral_rad_closed_surface_agenda);
 
 #pragma omp parallel for collapse(2) if (not arts_omp_in_parallel())
   for (Size j = 0; j < NX; j++) {
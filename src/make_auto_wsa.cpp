@@ -132,6 +132,31 @@ void call_operator(std::ostream& os,
              is_header ? " = nullptr"sv : ""sv);
 }
 
+void run_operator(std::ostream& os,
+                  const auto_ag& ag,
+                  const std::string& agname) {
+  const auto is_output = [&ag](auto& v) {
+    return std::find_if(ag.o.begin(), ag.o.end(), [v](auto& o) {
+             return o.second == v;
+           }) != ag.o.end();
+  };
+
+  const std::string spaces(9 + agname.size(), ' ');
+
+  std::print(os, "void {}Run(const Workspace& ws", agname);
+
+  for (auto& [type, name] : ag.o) {
+    std::print(os, ",\n{}{}& {}", spaces, type, name);
+  }
+
+  for (auto& [type, name] : ag.i) {
+    if (not is_output(name))
+      std::print(os, ",\n{}const {}& {}", spaces, type, name);
+  }
+
+  std::print(os, ",\n{0}const Agenda& {1})", spaces, agname);
+}
+
 void header(std::ostream& os) {
   const auto agmap = auto_ags(os);
 
@@ -175,6 +200,16 @@ struct WorkspaceAgendaBoolHandler {{
     header_docstring(os, ag.second, ag.first);
     call_operator(os, ag.second, ag.first, true);
     std::println(os, ";\n");
+
+    std::println(os,
+                 R"(/** As {0}Execute, but without returning the local workspace
+
+  The local workspace is leased from the compiled agenda and reused by the
+  next call, so prefer this when the local workspace is not needed.
+*/)",
+                 ag.first);
+    run_operator(os, ag.second, ag.first);
+    std::println(os, ";\n");
   }
 
   for (auto& [name, ag] : wsa) {
@@ -227,6 +262,33 @@ std::string double_curly(std::string s) {
   return s;
 }
 
+void output_constraints(std::ostream& os, const auto_ag& ag) {
+  for (auto& constraint : ag.output_constraints) {
+    std::println(os,
+                 R"--(
+  if(not ({}))
+    throw std::runtime_error(std::format(R"ERR({})--",
+                 constraint.test,
+                 double_curly(constraint.constraint));
+
+    const Size N = max(constraint.printables,
+                       [](const std::string& x) -> Size { return x.size(); });
+    for (auto& p : constraint.printables) {
+      std::println(os,
+                   R"--(
+{}:{} {{}})--",
+                   double_curly(p),
+                   std::string(N - p.size(), ' '));
+    }
+    if (not constraint.printables.empty()) {
+      std::print(os,
+                 R"--(
+)ERR", {:,}));)--",
+                 constraint.printables);
+    }
+  }
+}
+
 void workspace_setup_and_exec(std::ostream& os,
                               const std::string& name,
                               const auto_ag& ag) {
@@ -278,30 +340,7 @@ void workspace_setup_and_exec(std::ostream& os,
   std::println(
       os, "\n  // Run all the methods\n  {}.execute(_lws);", name);
 
-  for (auto& constraint : ag.output_constraints) {
-    std::println(os,
-                 R"--(
-  if(not ({}))
-    throw std::runtime_error(std::format(R"ERR({})--",
-                 constraint.test,
-                 double_curly(constraint.constraint));
-
-    const Size N = max(constraint.printables,
-                       [](const std::string& x) -> Size { return x.size(); });
-    for (auto& p : constraint.printables) {
-      std::println(os,
-                   R"--(
-{}:{} {{}})--",
-                   double_curly(p),
-                   std::string(N - p.size(), ' '));
-    }
-    if (not constraint.printables.empty()) {
-      std::print(os,
-                 R"--(
-)ERR", {:,}));)--",
-                 constraint.printables);
-    }
-  }
+  output_constraints(os, ag);
 
   std::println(os, R"(
   // Remove the unsafe content (false sharing pointers))");
@@ -319,6 +358,52 @@ void workspace_setup_and_exec(std::ostream& os,
   std::println(os, "\n  return _lws;");
 }
 
+void workspace_frame_and_exec(std::ostream& os,
+                              const std::string& name,
+                              const auto_ag& ag) {
+  const auto input_slot = [&ag](const std::string& v) {
+    return static_cast<Size>(
+        stdr::distance(ag.i.begin(), stdr::find_if(ag.i, [&v](auto& i) {
+                         return i.second == v;
+                       })));
+  };
+
+  std::println(os, R"(
+  // Lease a local workspace with the variable layout of the agenda
+  CompiledAgenda::Frame _frame{{{0}.compiled()}};
+
+  // Always share original data here)",
+               name);
+  for (auto& i : ag.i) {
+    std::println(os,
+                 R"(  _frame.set({0}, const_cast<{1}*>(&{2}));)",
+                 input_slot(i.second),
+                 i.first,
+                 i.second);
+  }
+
+  std::println(os, R"(
+  // Copy and share data from old workspace (this will copy pure inputs that are modified)
+  _frame.share(ws);
+
+  // Modified data must be set here)");
+  Size slot = ag.i.size();
+  for (auto& o : ag.o) {
+    const Size s = input_slot(o.second);
+    std::println(os,
+                 R"(  _frame.set({0}, const_cast<{1}*>(&{2}));)",
+                 s == ag.i.size() ? slot++ : s,
+                 o.first,
+                 o.second);
+  }
+
+  std::println(os,
+               "\n  // Run all the methods\n  {}.execute(_frame.workspace());",
+               name);
+
+  output_constraints(os, ag);
+}
+
 void implementation(std::ostream& os) {
   const auto agmap = auto_ags(os);
 
@@ -329,6 +414,7 @@ void implementation(std::ostream& os) {
 #include <workspace_method_class.h>
 #include <workspace_agenda_creator.h>
 #include <workspace_class.h>
+#include <workspace_compiled_agenda.h>
 #include <time_report.h>
 
 std::unordered_map<std::string, WorkspaceAgendaRecord> get_workspace_agendas() {{
@@ -426,6 +512,20 @@ std::ostream& operator<<(std::ostream& os, const WorkspaceAgendaBoolHandler& wab
                  name);
   }
 
+  for (const auto& [name, ag] : agmap) {
+    run_operator(os, ag, name);
+    std::println(os, " try {{\n  ARTS_TIME_REPORT\n");
+    agenda_checker(os, name);
+    workspace_frame_and_exec(os, name, ag);
+    std::println(os,
+                 R"(}} catch(std::exception& e) {{
+  throw std::runtime_error(std::format(R"--(Error executing agenda "{}":
+{{}})--", e.what()));
+}}
+)",
+                 name);
+  }
+
   for (auto& [name, ag] : wsa) {
     if (ag.enum_options.empty()) continue;
 
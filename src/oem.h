@@ -12,7 +12,9 @@
 #ifndef _ARTS_OEM_H_
 #define _ARTS_OEM_H_
 
+#include <algorithm>
 #include <type_traits>
+#include <vector>
 
 #include "invlib/algebra.h"
 #include "invlib/algebra/precision_matrix.h"
@@ -38,6 +40,45 @@ using MatrixReference = invlib::Matrix<ArtsMatrixReference<::Matrix>>;
 using CovarianceMatrix = invlib::Matrix<ArtsCovarianceMatrixWrapper>;
 using Identity         = invlib::MatrixIdentity<Matrix>;
 
+////////////////////////////////////////////////////////////////////////////////
+// Matrix-free Jacobian
+////////////////////////////////////////////////////////////////////////////////
+
+class MatrixFreeAgendaWrapper;
+
+/** The Jacobian of a state as its products only.
+ *
+ * The products J·v and Jᵀ·w are all that the CG solvers need from the
+ * Jacobian, so these are all that is provided.  The Jacobian is never held:
+ * every product simulates it again, one chunk of obsels at a time, see
+ * MatrixFreeAgendaWrapper.
+ */
+class ArtsJacobianProducts {
+ public:
+  using RealType   = Numeric;
+  using VectorType = ArtsVector;
+  using MatrixType = ArtsMatrix;
+  using ResultType = ArtsMatrix;
+
+  ArtsJacobianProducts() = delete;
+  ArtsJacobianProducts(MatrixFreeAgendaWrapper &aw_) : aw(aw_) {}
+
+  Index rows() const;
+  Index cols() const;
+
+  /** The product J·v */
+  ArtsVector multiply(const ArtsVector &v) const;
+
+  /** The product Jᵀ·w */
+  ArtsVector transpose_multiply(const ArtsVector &w) const;
+
+ private:
+  std::reference_wrapper<MatrixFreeAgendaWrapper> aw;
+};
+
+/** invlib wrapper type for the Jacobian of the matrix-free CG methods.*/
+using JacobianProducts = invlib::Matrix<ArtsJacobianProducts>;
+
 ////////////////////////////////////////////////////////////////////////////////
 // OEM Formulations
 ////////////////////////////////////////////////////////////////////////////////
@@ -526,19 +567,19 @@ class AgendaWrapper {
    */
   MatrixReference Jacobian(const Vector &xi, Vector &yi) {
     if (!reuse_jacobian_) {
-      inversion_iterate_agendaExecute(*ws_,
-                                      *atm,
-                                      *absdata,
-                                      *sensor,
-                                      *surf,
-                                      *subsurf,
-                                      yi_,
-                                      jacobian_,
-                                      *jacs,
-                                      xi,
-                                      1,
-                                      iteration_counter_,
-                                      *inversion_iterate_agenda_);
+      inversion_iterate_agendaRun(*ws_,
+                                  *atm,
+                                  *absdata,
+                                  *sensor,
+                                  *surf,
+                                  *subsurf,
+                                  yi_,
+                                  jacobian_,
+                                  *jacs,
+                                  xi,
+                                  1,
+                                  iteration_counter_,
+                                  *inversion_iterate_agenda_);
       yi                  = yi_;
       iteration_counter_ += 1;
     } else {
@@ -560,26 +601,26 @@ class AgendaWrapper {
   Vector evaluate(const Vector &xi) {
     if (!reuse_jacobian_) {
       Matrix dummy;
-      inversion_iterate_agendaExecute(*ws_,
-                                      *atm,
-                                      *absdata,
-                                      *sensor,
-                                      *surf,
-                                      *subsurf,
-                                      yi_,
-                                      dummy,
-                                      *jacs,
-                                      xi,
-                                      0,
-                                      iteration_counter_,
-                                      *inversion_iterate_agenda_);
+      inversion_iterate_agendaRun(*ws_,
+                                  *atm,
+                                  *absdata,
+                                  *sensor,
+                                  *surf,
+                                  *subsurf,
+                                  yi_,
+                                  dummy,
+                                  *jacs,
+                                  xi,
+                                  0,
+                                  iteration_counter_,
+                                  *inversion_iterate_agenda_);
     } else {
       reuse_jacobian_ = false;
     }
     return yi_;
   }
 
- private:
+ protected:
   /** Pointer to the inversion_iterate_agenda of the workspace. */
   const Agenda *inversion_iterate_agenda_;
   const JacobianTargets *jacs;
@@ -598,6 +639,166 @@ class AgendaWrapper {
   /** Cached simulation result. */
   Vector yi_;
 };
+
+/** Matrix-free Jacobian interface to ARTS inversion_iterate_agenda
+ *
+ * As AgendaWrapper, but the Jacobian is never formed.  Its products are
+ * streamed instead: For each chunk of the obsels of the measurement_sensor,
+ * the Jacobian of the chunk is simulated by one inversion_iterate_agenda
+ * run, its part of the product is added to the result, and it is dropped.
+ * The dense Jacobian of a single chunk is the largest that is ever formed.
+ *
+ * This trades time for memory.  Every product costs the simulation of the
+ * full Jacobian, and the CG solvers take two products per iteration.
+ *
+ * Element i of the measurement vector must be simulated by obsel i, so the
+ * chunks can be put together to the full measurement vector.
+ */
+class MatrixFreeAgendaWrapper : public AgendaWrapper {
+ public:
+  /** Create matrix-free inversion_iterate_agendaExecute wrapper.
+   *
+   * \param[in] obsel_chunk_size The number of obsels per agenda run.
+   *
+   * The other arguments are as for AgendaWrapper, where arts_jacobian
+   * must be empty as it is never used.
+   */
+  MatrixFreeAgendaWrapper(Size obsel_chunk_size,
+                          const Workspace *const ws,
+                          unsigned int measurement_space_dimension,
+                          unsigned int state_space_dimension,
+                          ::Matrix &arts_jacobian,
+                          ::Vector &arts_y,
+                          AtmField *atm_field,
+                          AbsorptionBands *abs_bands,
+                          ArrayOfSensorObsel *measurement_sensor,
+                          SurfaceField *surf_field,
+                          SubsurfaceField *subsurf_field,
+                          const JacobianTargets *jac_targets,
+                          const Agenda *inversion_iterate_agenda)
+      : AgendaWrapper(ws,
+                      measurement_space_dimension,
+                      state_space_dimension,
+                      arts_jacobian,
+                      arts_y,
+                      atm_field,
+                      abs_bands,
+                      measurement_sensor,
+                      surf_field,
+                      subsurf_field,
+                      jac_targets,
+                      inversion_iterate_agenda),
+        chunk_size_(obsel_chunk_size) {}
+
+  /** Evaluate forward model and keep the state for the Jacobian products.
+   *
+   * \param[in] xi The current state vector x.
+   * \param[out] yi The measurement vector y = K(x) for the current state.
+   * \return The products of the Jacobian of the current state.
+   */
+  JacobianProducts Jacobian(const Vector &xi, Vector &yi) {
+    ARTS_USER_ERROR_IF(sensor->size() != m,
+                       "There are {} obsels for a measurement vector of "
+                       "size {}, but the matrix-free Jacobian needs one "
+                       "obsel per element",
+                       sensor->size(),
+                       m)
+
+    yi                  = evaluate(xi);
+    x_                  = xi;
+    iteration_counter_ += 1;
+    return JacobianProducts{*this};
+  }
+
+  /** The product J·v, simulating J one chunk at a time */
+  ArtsVector multiply(const ArtsVector &v) {
+    ArtsVector w;
+    w.resize(m);
+    for_each_chunk([&](Size i0, Size nc) {
+      ::mult(w[Range(i0, nc)], jac_, v);
+    });
+    return w;
+  }
+
+  /** The product Jᵀ·w, simulating J one chunk at a time */
+  ArtsVector transpose_multiply(const ArtsVector &w) {
+    ArtsVector v;
+    v.resize(n);
+    v = 0.0;
+
+    ::Vector dv(n);
+    for_each_chunk([&](Size i0, Size nc) {
+      ::mult(dv, matpack::transpose(jac_), w[Range(i0, nc)]);
+      v += dv;
+    });
+    return v;
+  }
+
+ private:
+  /** Simulates the Jacobian of each chunk at x_ into jac_ and calls f */
+  template <typename F>
+  void for_each_chunk(F &&f) {
+    const Size nobsel = sensor->size();
+
+    for (Size i0 = 0; i0 < nobsel; i0 += chunk_size_) {
+      const Size nc = std::min(chunk_size_, nobsel - i0);
+      chunk_.assign(sensor->begin() + i0, sensor->begin() + i0 + nc);
+
+      inversion_iterate_agendaRun(*ws_,
+                                  *atm,
+                                  *absdata,
+                                  chunk_,
+                                  *surf,
+                                  *subsurf,
+                                  y_,
+                                  jac_,
+                                  *jacs,
+                                  x_,
+                                  1,
+                                  iteration_counter_,
+                                  *inversion_iterate_agenda_);
+
+      ARTS_USER_ERROR_IF(y_.size() != nc or
+                             static_cast<Size>(jac_.nrows()) != nc or
+                             static_cast<Size>(jac_.ncols()) != n,
+                         "The {} obsels from {} simulate a measurement "
+                         "vector of size {} and a {}x{} Jacobian, expected "
+                         "size {} and {}x{}",
+                         nc,
+                         i0,
+                         y_.size(),
+                         jac_.nrows(),
+                         jac_.ncols(),
+                         nc,
+                         nc,
+                         n)
+
+      f(i0, nc);
+    }
+  }
+
+  /** The number of obsels per agenda run. */
+  Size chunk_size_;
+  /** The state of the Jacobian. */
+  ::Vector x_;
+  /** The obsels, measurement vector and Jacobian of the current chunk. */
+  ArrayOfSensorObsel chunk_;
+  ::Vector y_;
+  ::Matrix jac_;
+};
+
+inline Index ArtsJacobianProducts::rows() const { return aw.get().m; }
+
+inline Index ArtsJacobianProducts::cols() const { return aw.get().n; }
+
+inline ArtsVector ArtsJacobianProducts::multiply(const ArtsVector &v) const {
+  return aw.get().multiply(v);
+}
+
+inline ArtsVector ArtsJacobianProducts::transpose_multiply(
+    const ArtsVector &w) const {
+  return aw.get().transpose_multiply(w);
+}
 }  // namespace oem
 
 /** Clip Tensor4
@@ -691,6 +892,10 @@ void Tensor4Clip(Tensor4 &x,
  * Checked to be 1 or 0.
  * @param display_progress Whether or not to display iteration progress. Checked
  * to be 1 or 0.
+ * @param sparse_jac_chunk_size The number of obsels per Jacobian simulation
+ * of the sparse CG methods, or 0 for the dense Jacobian.  Checked to be valid
+ * for the method and the Jacobian targets.  The dense Jacobian is not
+ * computed if positive.
  */
 void OEM_checks(const Workspace &ws,
                 Vector &x,
@@ -713,7 +918,8 @@ void OEM_checks(const Workspace &ws,
                 const Numeric &stop_dx,
                 const Vector &lm_ga_settings,
                 const Index &clear_matrices,
-                const Index &display_progress) {
+                const Index &display_progress,
+                const Index &sparse_jac_chunk_size) {
   const Size n = xa.size();
   const Size m = y.size();
 
@@ -807,37 +1013,66 @@ void OEM_checks(const Workspace &ws,
       "Valid options for *display_progress* are 0 and 1. display_progress: {}",
       display_progress);
 
+  ARTS_USER_ERROR_IF(
+      sparse_jac_chunk_size < 0,
+      "The argument *sparse_jac_chunk_size* must be >= 0. "
+      "sparse_jac_chunk_size: {}",
+      sparse_jac_chunk_size);
+
+  if (sparse_jac_chunk_size > 0) {
+    ARTS_USER_ERROR_IF(
+        !(method == "li_cg" || method == "gn_cg" || method == "lm_cg" ||
+          method == "ml_cg"),
+        "A *sparse_jac_chunk_size* > 0 needs one of the methods \"li_cg\", "
+        "\"gn_cg\", \"lm_cg\" or \"ml_cg\". method: {}",
+        method);
+    ARTS_USER_ERROR_IF(
+        !jac_targets.sensor.empty() || !jac_targets.error.empty(),
+        "Sensor and error Jacobian targets refer to all of "
+        "*measurement_sensor* and can not be used with a "
+        "*sparse_jac_chunk_size* > 0");
+    ARTS_USER_ERROR_IF(measurement_sensor.size() != m,
+                       "A *sparse_jac_chunk_size* > 0 needs one obsel per "
+                       "element of *y*. measurement_sensor.size(): {}, "
+                       "y.size(): {}",
+                       measurement_sensor.size(),
+                       y.size());
+  }
+
+  // The sparse CG methods never compute the dense jacobian
+  const Index do_jac = sparse_jac_chunk_size > 0 ? 0 : 1;
+
   // If necessary compute yf and jacobian.
   if (x.size() == 0) {
     x = xa;
-    inversion_iterate_agendaExecute(ws,
-                                    atm_field,
-                                    abs_bands,
-                                    measurement_sensor,
-                                    surf_field,
-                                    subsurf_field,
-                                    yf,
-                                    jacobian,
-                                    jac_targets,
-                                    xa,
-                                    1,
-                                    0,
-                                    inversion_iterate_agenda);
+    inversion_iterate_agendaRun(ws,
+                                atm_field,
+                                abs_bands,
+                                measurement_sensor,
+                                surf_field,
+                                subsurf_field,
+                                yf,
+                                jacobian,
+                                jac_targets,
+                                xa,
+                                do_jac,
+                                0,
+                                inversion_iterate_agenda);
   }
-  if ((yf.size() == 0) || (jacobian.empty())) {
-    inversion_iterate_agendaExecute(ws,
-                                    atm_field,
-                                    abs_bands,
-                                    measurement_sensor,
-                                    surf_field,
-                                    subsurf_field,
-                                    yf,
-                                    jacobian,
-                                    jac_targets,
-                                    x,
-                                    1,
-                                    0,
-                                    inversion_iterate_agenda);
+  if ((yf.size() == 0) || (do_jac && jacobian.empty())) {
+    inversion_iterate_agendaRun(ws,
+                                atm_field,
+                                abs_bands,
+                                measurement_sensor,
+                                surf_field,
+                                subsurf_field,
+                                yf,
+                                jacobian,
+                                jac_targets,
+                                x,
+                                do_jac,
+                                0,
+                                inversion_iterate_agenda);
   }
 }
 
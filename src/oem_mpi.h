@@ -76,7 +76,7 @@ class AgendaWrapperMPI {
    */
   MPIMatrix Jacobian(const OEMVector &xi, OEMVector &yi) {
     yi.resize(m);
-    inversion_iterate_agendaExecute(
+    inversion_iterate_agendaRun(
         *ws_, yi, local_jacobian_, xi, 1, *inversion_iterate_agenda_);
     // Create MPI vector from local results, use conversion to vector
     // to broadcast local results.
@@ -99,7 +99,7 @@ class AgendaWrapperMPI {
     Matrix dummy = local_jacobian_;
     OEMVector yi;
     yi.resize(m);
-    inversion_iterate_agendaExecute(
+    inversion_iterate_agendaRun(
         *ws_, yi, dummy, xi, 0, *inversion_iterate_agenda_);
 
     // Create MPI vector from local results, use conversion to vector
@@ -267,12 +267,12 @@ so Copy(a, out=b) will not even see the b variable.
           "par_tasks",
           [](Agenda& a, Workspace& ws) { return a.par_tasks(ws); },
           "ws"_a,
-          "Returns a list of agendas to show their potential for parallel execution (used by par_execute)")
+          "Returns a list of agendas to show their potential for parallel execution")
       .def(
           "par_execute",
           [](Agenda& a, Workspace& ws) { a.par_execute(ws); },
           "ws"_a,
-          "Executes the agenda on the provided workspace in parallel")
+          "Executes the agenda on the provided workspace, running methods in parallel when they do not depend on each other")
       .def(
           "finalize",
           [](Agenda& a, bool fix) { a.finalize(fix); },
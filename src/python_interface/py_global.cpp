@@ -307,6 +307,50 @@ Parameters
 Return
 ------
 See above, :class:`dict`
+)");
+
+  global.def("time_report_trace",
+             &arts::trace_report,
+             "clear"_a = false,
+             R"(Get the time report in the Chrome trace event format.
+
+The result is a JSON :class:`str` that can be saved to file and opened in
+``chrome://tracing`` or in Perfetto.  Each timed scope is an event on the
+timeline of the thread that ran it.
+
+.. note::
+    This function is only available if ARTS is compiled with profiling enabled.
+
+Parameters
+----------
+    clear : bool
+        Clear the report after getting it.  Default: False.
+
+Return
+------
+:class:`str`
+)");
+
+  global.def("time_report_flame_graph",
+             &arts::flame_graph_report,
+             "clear"_a = false,
+             R"(Get the time report as folded stacks for flame graphs.
+
+Each line of the :class:`str` is a call stack of timed scopes separated by
+``;``, followed by the time in nanoseconds spent in the innermost scope
+itself.  This is the input format of ``flamegraph.pl``.
+
+.. note::
+    This function is only available if ARTS is compiled with profiling enabled.
+
+Parameters
+----------
+    clear : bool
+        Clear the report after getting it.  Default: False.
+
+Return
+------
+:class:`str`
 )");
 } catch (std::exception& e) {
   throw std::runtime_error(
@@ -995,6 +995,30 @@ fmax : ~pyarts3.arts.Numeric
   auto led = py::bind_map<LinemixingEcsData>(m, "LinemixingEcsData");
   generic_interface(led);
 
+  py::class_<LineByLineCache> lbc(m, "LineByLineCache");
+  generic_interface(lbc);
+  lbc.def_prop_ro("active",
+                  &LineByLineCache::active,
+                  "Whether or not anything is ever stored\n\n.. :class:`bool`");
+  lbc.def_prop_ro(
+      "max_entries",
+      [](const LineByLineCache& self) { return self.config().max_entries; },
+      "The maximum number of stored results\n\n.. :class:`int`");
+  lbc.def_prop_ro(
+      "hits",
+      &LineByLineCache::hits,
+      "The number of results found in the cache\n\n.. :class:`int`");
+  lbc.def_prop_ro(
+      "misses",
+      &LineByLineCache::misses,
+      "The number of results not found in the cache\n\n.. :class:`int`");
+  lbc.def_prop_ro("size",
+                  &LineByLineCache::size,
+                  "The number of results currently held\n\n.. :class:`int`");
+  lbc.def("clear",
+          &LineByLineCache::clear,
+          "Drop all results and reset the counters");
+
   lbl.def(
       "equivalent_lines",
       [](const AbsorptionBand& band,
@@ -1054,6 +1078,7 @@ fmax : ~pyarts3.arts.Numeric
                                  spec,
                                  self,
                                  abs_ecs_data,
+                                 LineByLineCache{},
                                  atm,
                                  path_point,
                                  no_negative_absorption);
@@ -34,6 +34,18 @@ void py_lookup(py::module_& m) try {
   alt.def_rw("xsec",
              &AbsorptionLookupTable::xsec,
              "The absorption cross section table\n\n.. :class:`Tensor4`");
+  alt.def_prop_ro(
+      "is_mapped",
+      &AbsorptionLookupTable::is_mapped,
+      "Whether the cross sections view a memory-mapped file, in which case *xsec* is empty\n\n.. :class:`bool`");
+  alt.def_prop_ro(
+      "storage",
+      &AbsorptionLookupTable::storage,
+      "How the cross sections are stored, *xsec* is empty unless this is Double\n\n.. :class:`LookupTableStorage`");
+  alt.def("compress",
+          &AbsorptionLookupTable::compress,
+          "storage"_a,
+          "Change how the cross sections are stored");
 
   auto alts = py::bind_map<AbsorptionLookupTables>(m, "AbsorptionLookupTables");
   generic_interface(alts);
@@ -12,6 +12,37 @@
 #include "hpy_arts.h"
 #include "hpy_numpy.h"
 namespace Python {
+namespace {
+//! A callable that holds the GIL while calling the Python function
+template <typename F>
+F gil_wrap(F f) {
+  return [f = std::move(f)](auto&&... x) {
+    py::gil_scoped_acquire gil{};
+    return f(std::forward<decltype(x)>(x)...);
+  };
+}
+
+/*! Adds the constructor with the opt-in batch signature
+
+  With batch, the same Python function is called with scalars for single
+  points and with arrays of all points by callers that evaluate many points
+  at once, so the GIL is taken once per batch rather than once per point.
+*/
+template <typename Op>
+void batch_init(py::class_<Op>& c, const char* doc) {
+  c.def(
+      "__init__",
+      [](Op* op, const py::callable& f, bool batch) {
+        new (op) Op{.f = gil_wrap(py::cast<typename Op::func_t>(f))};
+        if (batch) op->batch = gil_wrap(py::cast<typename Op::batch_t>(f));
+      },
+      "f"_a,
+      py::kw_only(),
+      "batch"_a,
+      doc);
+}
+}  // namespace
+
 void py_operators(py::module_& m) {
   py::class_<NumericUnaryOperator> nuop(m, "NumericUnaryOperator");
   nuop.def("__init__",
@@ -49,6 +80,13 @@ void py_operators(py::module_& m) {
           "atm_point"_a)
       .doc() =
       "A callback to get [extinction, ssa] from a single scattering albedo and extinction field.";
+  batch_init(esop,
+             R"(The callback of a function of frequency and atm_point.
+
+If batch is true, f must also accept an array of all frequencies and return
+a tuple of the extinction and ssa arrays.  The bulk scattering properties
+then call it once per frequency grid.
+)");
   generic_interface(esop);
   py::implicitly_convertible<ExtSSACallback::func_t, ExtSSACallback>();
 
@@ -90,6 +128,13 @@ void py_operators(py::module_& m) {
           "x"_a,
           "y"_a,
           "z"_a);
+  batch_init(ntop,
+             R"(The operator of a function of x, y, and z.
+
+If batch is true, f must also accept arrays of all x, y, and z and return
+an array of the values.  Functional atmospheric field data is then
+evaluated once for all points of a path or profile.
+)");
   generic_interface(ntop);
   py::implicitly_convertible<NumericTernaryOperator::func_t,
                              NumericTernaryOperator>();
@@ -250,6 +250,10 @@ void py_rtepack(py::module_ &m) try {
   rtepack_array<Propmat, 2, 7>(mpm);
   generic_interface(mpm);
 
+  py::class_<PropmatTensor3> t3pm(m, "PropmatTensor3");
+  rtepack_array<Propmat, 3, 7>(t3pm);
+  generic_interface(t3pm);
+
   py::class_<Muelmat> mm(m, "Muelmat");
   mm.def(py::init_implicit<Numeric>())
       .def(py::init_implicit<std::array<Numeric, 16>>())
@@ -516,6 +520,10 @@ void py_rtepack(py::module_ &m) try {
       "opt",
       &TransmittanceMatrix::option,
       "The option for the transmittance matrix calculations\n\n.. :class:`~pyarts3.arts.TransmittanceOption");
+  tramat.def_rw(
+      "polarized",
+      &TransmittanceMatrix::polarized,
+      "Whether or not the matrices may mix the Stokes components, set this if T, L, P, dT, or dL are changed by hand\n\n.. :class:`bool`");
 
   auto srcvec = py::class_<SourceVector>(m, "SourceVector");
   generic_interface(srcvec);
@@ -528,6 +536,29 @@ void py_rtepack(py::module_ &m) try {
       &SourceVector::dJ,
       "The derivatives of the source vectors; shape [nf, np, nq]\n\n.. :class:`~pyarts3.arts.StokvecTensor3");
 
+  auto sppath = py::class_<SpectralPath>(m, "SpectralPath");
+  generic_interface(sppath);
+  sppath.def_rw(
+      "freq",
+      &SpectralPath::freq,
+      "The frequency grids; shape [nf, np]\n\n.. :class:`~pyarts3.arts.Matrix");
+  sppath.def_rw(
+      "propmat",
+      &SpectralPath::propmat,
+      "The propagation matrices; shape [nf, np]\n\n.. :class:`~pyarts3.arts.PropmatMatrix");
+  sppath.def_rw(
+      "nlte",
+      &SpectralPath::nlte,
+      "The non-LTE source vectors; shape [nf, np]\n\n.. :class:`~pyarts3.arts.StokvecMatrix");
+  sppath.def_rw(
+      "propmat_jac",
+      &SpectralPath::propmat_jac,
+      "The derivatives of the propagation matrices; shape [nf, np, nq]\n\n.. :class:`~pyarts3.arts.PropmatTensor3");
+  sppath.def_rw(
+      "nlte_jac",
+      &SpectralPath::nlte_jac,
+      "The derivatives of the non-LTE source vectors; shape [nf, np, nq]\n\n.. :class:`~pyarts3.arts.StokvecTensor3");
+
   auto rp  = m.def_submodule("rtepack");
   rp.doc() = "Module for RTEPACK functionality";
 
@@ -159,7 +159,7 @@ Numeric zenith_horizon(const Workspace& ws,
                        const Numeric angle_cut) {
   ArrayOfPropagationPathPoint path;
   const auto hits_space = [&](const Numeric za) {
-    ray_path_observer_agendaExecute(
+    ray_path_observer_agendaRun(
         ws, path, observer_pos, {za, aa}, ray_path_observer_agenda);
     return path.back().los_type == PathPositionType::space;
   };
@@ -182,13 +182,13 @@ std::pair<Numeric, bool> beta_angle(const Workspace& ws,
                                     const Agenda& ray_path_observer_agenda,
                                     const SurfaceField& surf_field,
                                     const Numeric& angle_cut) {
-  ray_path_observer_agendaExecute(
+  ray_path_observer_agendaRun(
       ws, sun_path, observer_pos, observer_los, ray_path_observer_agenda);
   if (sun_path.back().los_type != PathPositionType::space) {
     Vector2 horizon_los = observer_los;
     horizon_los[0]      = zenith_horizon(
         ws, observer_pos, observer_los[1], ray_path_observer_agenda, angle_cut);
-    ray_path_observer_agendaExecute(
+    ray_path_observer_agendaRun(
         ws, sun_path, observer_pos, horizon_los, ray_path_observer_agenda);
     ARTS_USER_ERROR_IF(sun_path.back().los_type != PathPositionType::space,
                        "Path above the horizon is not possible")
@@ -0,0 +1,164 @@
+#include <auto_wsa.h>
+#include <workspace.h>
+#include <workspace_agenda_creator.h>
+#include <workspace_compiled_agenda.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <print>
+#include <stdexcept>
+#include <tuple>
+
+namespace {
+//! Nanoseconds per call of f
+template <typename F>
+double per_call(Size n, F&& f) {
+  const auto start = std::chrono::steady_clock::now();
+  for (Size i = 0; i < n; i++) f();
+  const auto end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double, std::nano>(end - start).count() /
+         static_cast<double>(n);
+}
+
+struct outputs {
+  PropmatVector spectral_propmat;
+  StokvecVector spectral_nlte_srcvec;
+  PropmatMatrix spectral_propmat_jac;
+  StokvecMatrix spectral_nlte_srcvec_jac;
+
+  //! Values that the agenda must overwrite
+  void garble() {
+    spectral_propmat.resize(1);
+    spectral_propmat = 1.0;
+    spectral_nlte_srcvec.resize(1);
+    spectral_nlte_srcvec = 1.0;
+    spectral_propmat_jac.resize(1, 1);
+    spectral_propmat_jac = 1.0;
+    spectral_nlte_srcvec_jac.resize(1, 1);
+    spectral_nlte_srcvec_jac = 1.0;
+  }
+};
+
+template <typename T>
+void compare(const T& execute, const T& run, const std::string_view what) {
+  if (execute.shape() != run.shape()) {
+    throw std::runtime_error(
+        std::format("{} has another shape by Execute than by Run", what));
+  }
+
+  if (not std::equal(execute.elem_begin(),
+                     execute.elem_end(),
+                     run.elem_begin(),
+                     [](auto& x, auto& y) { return x.data == y.data; })) {
+    throw std::runtime_error(
+        std::format("{} differs between Execute and Run", what));
+  }
+}
+
+//! Frame::set must refuse a built-in variable of the wrong group
+void wrong_type(const Agenda& agenda, const AscendingGrid& freq_grid) {
+  CompiledAgenda::Frame frame{agenda.compiled()};
+
+  frame.set(0, Wsv{AscendingGrid{freq_grid}});
+
+  try {
+    frame.set(0, Wsv{Numeric{1.0}});
+  } catch (const std::runtime_error&) {
+    return;
+  }
+
+  throw std::runtime_error("Frame::set accepted a Numeric freq_grid");
+}
+}  // namespace
+
+/*! The per-call overhead of executing an agenda
+
+  The agenda only initializes its outputs and ignores the other inputs, so
+  most of the time is spent setting up and tearing down the local
+  workspace.  Both ways of executing it must give the same outputs.
+*/
+int main() try {
+  constexpr Size N = 100'000;
+
+  const Workspace ws;
+
+  AgendaCreator creator("spectral_propmat_agenda");
+  creator.add("spectral_propmatInit");
+  const Agenda agenda = std::move(creator).finalize(true);
+
+  const AscendingGrid freq_grid{1e9, 2e9, 3e9};
+  const Vector3 freq_wind_shift_jac{};
+  const JacobianTargets jac_targets;
+  const SpeciesEnum select_species{};
+  const PropagationPathPoint ray_point;
+  const AtmPoint atm_point;
+
+  outputs ex, run;
+
+  const auto exec = [&]() {
+    std::ignore = spectral_propmat_agendaExecute(ws,
+                                                 ex.spectral_propmat,
+                                                 ex.spectral_nlte_srcvec,
+                                                 ex.spectral_propmat_jac,
+                                                 ex.spectral_nlte_srcvec_jac,
+                                                 freq_grid,
+                                                 freq_wind_shift_jac,
+                                                 jac_targets,
+                                                 select_species,
+                                                 ray_point,
+                                                 atm_point,
+                                                 agenda);
+  };
+
+  const auto exec_run = [&]() {
+    spectral_propmat_agendaRun(ws,
+                               run.spectral_propmat,
+                               run.spectral_nlte_srcvec,
+                               run.spectral_propmat_jac,
+                               run.spectral_nlte_srcvec_jac,
+                               freq_grid,
+                               freq_wind_shift_jac,
+                               jac_targets,
+                               select_species,
+                               ray_point,
+                               atm_point,
+                               agenda);
+  };
+
+  ex.garble();
+  run.garble();
+  exec();
+  exec_run();
+
+  if (run.spectral_propmat.size() != freq_grid.size()) {
+    throw std::runtime_error("Run did not set the outputs");
+  }
+
+  compare(ex.spectral_propmat, run.spectral_propmat, "spectral_propmat");
+  compare(ex.spectral_nlte_srcvec,
+          run.spectral_nlte_srcvec,
+          "spectral_nlte_srcvec");
+  compare(ex.spectral_propmat_jac,
+          run.spectral_propmat_jac,
+          "spectral_propmat_jac");
+  compare(ex.spectral_nlte_srcvec_jac,
+          run.spectral_nlte_srcvec_jac,
+          "spectral_nlte_srcvec_jac");
+
+  wrong_type(agenda, freq_grid);
+
+  const double t_execute = per_call(N, exec);
+  const double t_run     = per_call(N, exec_run);
+
+  std::println("spectral_propmat_agendaExecute: {:.1f} ns/call", t_execute);
+  std::println("spectral_propmat_agendaRun:     {:.1f} ns/call", t_run);
+
+  return EXIT_SUCCESS;
+} catch (const std::exception& e) {
+  std::cerr << "Error: " << e.what() << '\n';
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,123 @@
+#include <atm_path.h>
+#include <math_funcs.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+#include "test_perf.h"
+
+namespace {
+const std::array species{"H2O"_spec,
+                         "CO2"_spec,
+                         "O3"_spec,
+                         "N2O"_spec,
+                         "CO"_spec,
+                         "CH4"_spec,
+                         "O2"_spec,
+                         "N2"_spec,
+                         "HCl"_spec,
+                         "HNO3"_spec};
+
+//! A 1D field of a smooth profile of the species, with builtin isotopologues
+AtmField synthetic_field(Size n) {
+  const AscendingGrid altitudes = nlinspace(0, 100e3, n);
+
+  ArrayOfAtmPoint profile(n);
+  for (Size i = 0; i < n; i++) {
+    const Numeric x        = altitudes[i] / 100e3;
+    profile[i].pressure    = 1e5 * std::exp(-x * 14);
+    profile[i].temperature = 290 - 60 * x + 10 * std::sin(10 * x);
+    for (Size j = 0; j < species.size(); j++) {
+      profile[i][species[j]] = 1e-6 * (j + 1) * (1 + x);
+    }
+  }
+
+  return Atm::atm_from_profile(
+      profile, altitudes, InterpolationExtrapolation::Nearest);
+}
+
+ArrayOfPropagationPathPoint synthetic_path(Size n) {
+  ArrayOfPropagationPathPoint path(n);
+  for (Size i = 0; i < n; i++) {
+    path[i].pos_type = PathPositionType::atm;
+    path[i].pos      = {100e3 * static_cast<Numeric>(i) / (n - 1), 0, 0};
+    path[i].los      = {0, 0};
+  }
+  return path;
+}
+
+/*! The per-point reads of a line-by-line propagation matrix calculation
+
+  The VMR of each species, its isotopologue ratios, and the number density.
+*/
+Numeric propmat_reads(const ArrayOfAtmPoint& atm_path,
+                      const std::vector<SpeciesIsotope>& isots) {
+  Numeric sum = 0.0;
+  for (auto& atm : atm_path) {
+    const Numeric nd = atm.number_density();
+    for (auto& isot : isots) sum += nd * atm[isot.spec] * atm[isot];
+  }
+  return sum;
+}
+
+void atm_point_speed(int N) {
+  const AtmField atm_field                  = synthetic_field(101);
+  const ArrayOfPropagationPathPoint rad_path = synthetic_path(1000);
+
+  std::vector<SpeciesIsotope> isots;
+  for (auto spec : species) {
+    for (auto& isot : Species::isotopologues(spec)) {
+      if (not(isot.is_joker() or isot.is_predefined())) isots.push_back(isot);
+    }
+  }
+
+  ArrayOfAtmPoint atm_path = forward_atm_path(rad_path, atm_field);
+  Numeric sum              = 0.0;
+
+  //! The batched extraction must give the same points as one at a time
+  for (Size i = 0; i < rad_path.size(); i++) {
+    const AtmPoint atm = atm_field.at(rad_path[i].pos);
+    for (auto& key : atm.keys()) {
+      if (std::abs(atm[key] - atm_path[i][key]) >
+          1e-12 * std::abs(atm[key])) {
+        throw std::runtime_error(
+            std::format("Batched {} at point {} is {}, expected {}",
+                        key,
+                        i,
+                        atm_path[i][key],
+                        atm[key]));
+      }
+    }
+  }
+
+  Array<Timing> ts;
+  ts.reserve(3 * N);
+
+  for (int i = 0; i < N; i++) {
+    ts.emplace_back("path-extraction");
+    ts.back()([&] { forward_atm_path(atm_path, rad_path, atm_field); });
+
+    ts.emplace_back("path-copy");
+    ts.back()([&] { sum += ArrayOfAtmPoint(atm_path).back().temperature; });
+
+    ts.emplace_back("propmat-reads");
+    ts.back()([&] { sum += propmat_reads(atm_path, isots); });
+  }
+
+  if (not std::isfinite(sum)) throw std::runtime_error("Bad sum");
+
+  std::cout << "atm-point-speed\n" << ts;
+}
+}  // namespace
+
+int main() try {
+  std::cout << "atm-point-perf-test\n";
+
+  atm_point_speed(5);
+
+  return EXIT_SUCCESS;
+} catch (const std::exception& e) {
+  std::cerr << "Error: " << e.what() << '\n';
+  return EXIT_FAILURE;
+}
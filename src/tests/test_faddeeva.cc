@@ -0,0 +1,102 @@
+#include <lbl_voigt_faddeeva.h>
+
+#include <Faddeeva/Faddeeva.hh>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "test_perf.h"
+
+namespace {
+/*! Arguments spanning the range seen in line-by-line calculations
+
+  Logarithmically distributed |x| and y, and the special cases of the
+  real and imaginary axes, as well as some arguments in the lower half-plane.
+*/
+std::vector<Complex> arguments(Size n) {
+  std::mt19937_64 gen(42);
+  std::uniform_real_distribution<Numeric> lx(-8.0, 6.0), ly(-10.0, 6.0);
+
+  std::vector<Complex> z(n);
+  for (auto& v : z) {
+    const Numeric x = std::pow(10.0, lx(gen)) * (gen() % 2 ? 1.0 : -1.0);
+    const Numeric y = std::pow(10.0, ly(gen));
+    switch (gen() % 16) {
+      case 0:  v = Complex{x, 0.0}; break;
+      case 1:  v = Complex{0.0, y}; break;
+      case 2:  v = Complex{x, -std::min(y, 1.0)}; break;
+      default: v = Complex{x, y};
+    }
+  }
+  return z;
+}
+
+void accuracy() {
+  constexpr Numeric tolerance = 1e-13;
+
+  const std::vector<Complex> z = arguments(1'000'000);
+
+  std::vector<Complex> w(z.size());
+  lbl::voigt::faddeeva::w(w, z);
+
+  Numeric max_rel = 0.0;
+  for (Size i = 0; i < z.size(); i++) {
+    const Complex ref = Faddeeva::w(z[i]);
+    const Numeric rel = std::abs(w[i] - ref) / std::abs(ref);
+    max_rel           = std::max(max_rel, rel);
+
+    if (not(rel <= tolerance)) {
+      throw std::runtime_error(std::format(
+          "w({}) = {}, expected {}, relative error {} above {}",
+          z[i],
+          w[i],
+          ref,
+          rel,
+          tolerance));
+    }
+
+    if (lbl::voigt::faddeeva::w(z[i]) != w[i]) {
+      throw std::runtime_error(std::format(
+          "w({}) differs between single and batched evaluation", z[i]));
+    }
+  }
+
+  std::cout << "faddeeva-accuracy " << max_rel << '\n';
+}
+
+void speed(int N) {
+  const std::vector<Complex> z = arguments(1'000'000);
+  std::vector<Complex> w(z.size());
+
+  Array<Timing> ts;
+  ts.reserve(2 * N);
+
+  for (int i = 0; i < N; i++) {
+    ts.emplace_back("Faddeeva::w");
+    ts.back()([&] {
+      for (Size j = 0; j < z.size(); j++) w[j] = Faddeeva::w(z[j]);
+    });
+
+    ts.emplace_back("batched");
+    ts.back()([&] { lbl::voigt::faddeeva::w(w, z); });
+  }
+
+  std::cout << "faddeeva-speed "
+            << lbl::voigt::faddeeva::simd_target() << '\n'
+            << ts;
+}
+}  // namespace
+
+int main() try {
+  std::cout << "faddeeva-test\n";
+
+  accuracy();
+  speed(5);
+
+  return EXIT_SUCCESS;
+} catch (const std::exception& e) {
+  std::cerr << "Error: " << e.what() << '\n';
+  return EXIT_FAILURE;
+}
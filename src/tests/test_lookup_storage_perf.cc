@@ -0,0 +1,143 @@
+#include <lookup_map.h>
+#include <math_funcs.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <numbers>
+
+#include "test_perf.h"
+
+namespace {
+/*! A synthetic table of pressure broadened lines
+
+  Smooth in all dimensions like a real table, and with cross sections
+  spanning many decades between line centers and the far wings.
+*/
+AbsorptionLookupTable synthetic_table(Index np, Index nt, Index nw, Index nf) {
+  ArrayOfAtmPoint atmref(np);
+  for (Index ip = 0; ip < np; ip++) {
+    const Numeric x        = static_cast<Numeric>(ip) / (np - 1);
+    atmref[ip].pressure    = 1e5 * std::pow(1e-4, x);
+    atmref[ip].temperature = 290 - 60 * x;
+    atmref[ip]["O2"_spec]  = 0.21;
+    atmref[ip]["H2O"_spec] = 1e-2 * atmref[ip].pressure / 1e5;
+  }
+
+  AbsorptionLookupTable t;
+  t.set_grids(atmref,
+              std::make_shared<const AscendingGrid>(nlinspace(50e9, 70e9, nf)),
+              std::make_shared<const AscendingGrid>(nlinspace(-20, 20, nt)),
+              std::make_shared<const AscendingGrid>(nlogspace(0.1, 10, nw)));
+
+  const Vector f0 = nlinspace(50.5e9, 69.5e9, 20);
+
+  t.xsec.resize(t.grid_shape());
+  for (Index it = 0; it < nt; it++) {
+    for (Index iw = 0; iw < nw; iw++) {
+      for (Index ip = 0; ip < np; ip++) {
+        const Numeric T = atmref[ip].temperature + (*t.t_pert)[it];
+        const Numeric G = 1e5 + 2e9 * (atmref[ip].pressure / 1e5) *
+                                    std::pow(296 / T, 0.75) *
+                                    (1 + 0.1 * (*t.w_pert)[iw]);
+        for (Index iv = 0; iv < nf; iv++) {
+          const Numeric f = (*t.f_grid)[iv];
+          Numeric x       = 0.0;
+          for (auto fl : f0) {
+            const Numeric S =
+                1e-25 * std::exp(-std::pow((fl - 60e9) / 5e9, 2));
+            x += S * std::pow(296 / T, 2) * G / std::numbers::pi /
+                 (std::pow(f - fl, 2) + G * G);
+          }
+          t.xsec[it, iw, ip, iv] = x;
+        }
+      }
+    }
+  }
+
+  return t;
+}
+
+ArrayOfAtmPoint synthetic_path(Size n) {
+  ArrayOfAtmPoint path(n);
+  for (Size i = 0; i < n; i++) {
+    const Numeric x     = static_cast<Numeric>(i) / (n - 1);
+    path[i].pressure    = 9e4 * std::pow(1e-3, x);
+    path[i].temperature = 285 - 50 * x + 10 * std::sin(10 * x);
+    path[i]["O2"_spec]  = 0.21;
+    path[i]["H2O"_spec] = 5e-3 * path[i].pressure / 1e5;
+  }
+  return path;
+}
+
+void storage_tradeoff(int N) {
+  const AbsorptionLookupTable ref = synthetic_table(31, 5, 3, 10001);
+  const ArrayOfAtmPoint path      = synthetic_path(100);
+  const AscendingGrid freq_grid   = nlinspace(50.1e9, 69.9e9, 5000);
+
+  const auto calc = [&](const AbsorptionLookupTable& t) {
+    Matrix abs(path.size(), freq_grid.size(), 0.0);
+    t.absorption(abs, "O2"_spec, 5, 3, 2, 3, path, freq_grid, 0.5);
+    return abs;
+  };
+
+  const Matrix abs_ref = calc(ref);
+
+  Array<Timing> ts;
+  ts.reserve(N * enumtyps::LookupTableStorageTypes.size());
+
+  std::cout << "storage-accuracy\n";
+  for (auto storage : enumtyps::LookupTableStorageTypes) {
+    AbsorptionLookupTable t = ref;
+    t.compress(storage);
+
+    const Matrix abs = calc(t);
+    Numeric max_rel  = 0.0;
+    for (Size i = 0; i < path.size(); i++) {
+      for (Size j = 0; j < freq_grid.size(); j++) {
+        max_rel = std::max(max_rel,
+                           std::abs(abs[i, j] - abs_ref[i, j]) / abs_ref[i, j]);
+      }
+    }
+
+    const Size nbytes = t.is_compressed() ? t.xsec_compressed.nbytes()
+                                          : t.xsec.size() * sizeof(Numeric);
+    std::cout << storage << " " << nbytes << " " << max_rel << '\n';
+
+    const Numeric tolerance = [storage]() {
+      switch (storage) {
+        case LookupTableStorage::Double:      return 0.0;
+        case LookupTableStorage::LogFloat32:  return 1e-5;
+        case LookupTableStorage::LogFloat16:  return 2e-2;
+        case LookupTableStorage::ScaledInt16: return 1e-3;
+      }
+      return 0.0;
+    }();
+
+    if (max_rel > tolerance) {
+      throw std::runtime_error(std::format("{} relative error {} above {}",
+                                           storage,
+                                           max_rel,
+                                           tolerance));
+    }
+
+    for (int i = 0; i < N; i++) {
+      ts.emplace_back(toString(storage).data());
+      ts.back()([&] { calc(t); });
+    }
+  }
+
+  std::cout << "storage-speed\n" << ts;
+}
+}  // namespace
+
+int main() try {
+  std::cout << "lookup-storage-perf-test\n";
+
+  storage_tradeoff(5);
+
+  return EXIT_SUCCESS;
+} catch (const std::exception& e) {
+  std::cerr << "Error: " << e.what() << '\n';
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,160 @@
+#include <rtepack.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+constexpr Size np = 6;
+constexpr Size nf = 150;
+constexpr Size nq = 2;
+
+/*! Random propagation matrices
+
+  Every third frequency is unpolarized, and the absorption both grows and
+  shrinks along the path so that both branches of the linear propagation
+  matrix source are used.  The frequencies are not a multiple of the chunk
+  size of the batched code.
+*/
+std::vector<PropmatVector> random_propmats(std::mt19937_64& gen) {
+  std::uniform_real_distribution<Numeric> abs(1e-3, 1.0);
+  std::uniform_real_distribution<Numeric> pol(-1e-1, 1e-1);
+
+  std::vector<PropmatVector> K(np, PropmatVector(nf));
+  for (auto& k : K) {
+    for (Size iv = 0; iv < nf; iv++) {
+      if (iv % 3 == 0) {
+        k[iv] = Propmat{abs(gen)};
+      } else {
+        k[iv] = Propmat{abs(gen),
+                        pol(gen),
+                        pol(gen),
+                        pol(gen),
+                        pol(gen),
+                        pol(gen),
+                        pol(gen)};
+      }
+    }
+  }
+
+  return K;
+}
+
+std::vector<PropmatMatrix> random_propmat_derivs(std::mt19937_64& gen) {
+  std::uniform_real_distribution<Numeric> d(-1e-2, 1e-2);
+
+  std::vector<PropmatMatrix> dK(np, PropmatMatrix(nq, nf));
+  for (auto& dk : dK) {
+    std::for_each(dk.elem_begin(), dk.elem_end(), [&](Propmat& x) {
+      x = Propmat{d(gen), d(gen), d(gen), d(gen), d(gen), d(gen), d(gen)};
+    });
+  }
+
+  return dK;
+}
+
+void compare(const Muelmat& batch,
+             const Muelmat& single,
+             const std::string_view what,
+             const TransmittanceOption option,
+             const Size iv,
+             const Size ip) {
+  for (Size i = 0; i < 4; i++) {
+    for (Size j = 0; j < 4; j++) {
+      const Numeric x = batch[i, j];
+      const Numeric y = single[i, j];
+      if (std::abs(x - y) > 1e-12 * std::max<Numeric>(1.0, std::abs(y))) {
+        throw std::runtime_error(
+            std::format("{} {} at frequency {} point {} [{}, {}] is {}, "
+                        "per-frequency {}",
+                        option,
+                        what,
+                        iv,
+                        ip,
+                        i,
+                        j,
+                        x,
+                        y));
+      }
+    }
+  }
+}
+
+//! The frequency batched transmittance must match the per-frequency one
+void batch_vs_single(const TransmittanceOption option) {
+  std::mt19937_64 gen(42);
+  std::uniform_real_distribution<Numeric> dist(0.1, 2.0);
+
+  const std::vector<PropmatVector> K  = random_propmats(gen);
+  const std::vector<PropmatMatrix> dK = random_propmat_derivs(gen);
+
+  Vector r(np - 1);
+  for (auto& x : r) x = dist(gen);
+
+  Tensor3 dr(2, np - 1, nq);
+  std::for_each(dr.elem_begin(), dr.elem_end(), [&](Numeric& x) {
+    x = 1e-2 * dist(gen);
+  });
+
+  rtepack::TransmittanceMatrix batch;
+  batch.init(K, dK, r, dr, option);
+
+  const bool has_src = option != TransmittanceOption::constant;
+
+  std::vector<Propmat> k(np);
+  std::vector<PropmatVector> dk(np, PropmatVector(nq));
+  rtepack::TransmittanceMatrix single;
+  for (Size iv = 0; iv < nf; iv++) {
+    for (Size ip = 0; ip < np; ip++) {
+      k[ip] = K[ip][iv];
+      for (Size iq = 0; iq < nq; iq++) dk[ip][iq] = dK[ip][iq, iv];
+    }
+
+    single.init(k, dk, r, dr, option);
+
+    for (Size ip = 0; ip < np; ip++) {
+      compare(batch.T[iv, ip], single.T[0, ip], "T", option, iv, ip);
+      if (has_src) {
+        compare(batch.L[iv, ip], single.L[0, ip], "L", option, iv, ip);
+      }
+
+      for (Size it = 0; it < 2; it++) {
+        for (Size iq = 0; iq < nq; iq++) {
+          compare(batch.dT[it, iv, ip, iq],
+                  single.dT[it, 0, ip, iq],
+                  "dT",
+                  option,
+                  iv,
+                  ip);
+          if (has_src) {
+            compare(batch.dL[it, iv, ip, iq],
+                    single.dL[it, 0, ip, iq],
+                    "dL",
+                    option,
+                    iv,
+                    ip);
+          }
+        }
+      }
+    }
+  }
+}
+}  // namespace
+
+int main() try {
+  std::cout << "rtepack-batch-test\n";
+
+  for (auto option : {TransmittanceOption::constant,
+                      TransmittanceOption::linsrc,
+                      TransmittanceOption::linprop}) {
+    batch_vs_single(option);
+  }
+
+  return EXIT_SUCCESS;
+} catch (const std::exception& e) {
+  std::cerr << "Error: " << e.what() << '\n';
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,148 @@
+#include <rtepack.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+constexpr Size np = 5;
+constexpr Size nf = 70;
+constexpr Size nq = 2;
+
+void compare(const Stokvec& scalar,
+             const Stokvec& matrix,
+             const std::string_view what,
+             const TransmittanceOption option) {
+  for (Size i = 0; i < 4; i++) {
+    const Numeric x = scalar[i];
+    const Numeric y = matrix[i];
+    if (std::abs(x - y) > 1e-12 * std::max<Numeric>(1.0, std::abs(y))) {
+      throw std::runtime_error(std::format(
+          "{} {} [{}] is {} by the scalar path, {} by the matrix path",
+          option,
+          what,
+          i,
+          x,
+          y));
+    }
+  }
+}
+
+template <typename T>
+void compare(const T& scalar,
+             const T& matrix,
+             const std::string_view what,
+             const TransmittanceOption option) {
+  auto x = scalar.elem_begin();
+  auto y = matrix.elem_begin();
+  for (; x != scalar.elem_end(); ++x, ++y) compare(*x, *y, what, option);
+}
+
+//! The scalar radiative transfer of unpolarized matrices is that of matrices
+void scalar_vs_matrix(const TransmittanceOption option) {
+  std::mt19937_64 gen(42);
+  std::uniform_real_distribution<Numeric> dist(0.1, 2.0);
+  std::uniform_real_distribution<Numeric> d(-1e-2, 1e-2);
+
+  std::vector<PropmatVector> K(np, PropmatVector(nf));
+  for (auto& k : K) {
+    for (auto& x : k) x = Propmat{dist(gen)};
+  }
+
+  std::vector<PropmatMatrix> dK(np, PropmatMatrix(nq, nf));
+  for (auto& dk : dK) {
+    std::for_each(dk.elem_begin(), dk.elem_end(), [&](Propmat& x) {
+      x = Propmat{d(gen)};
+    });
+  }
+
+  Vector r(np - 1);
+  for (auto& x : r) x = dist(gen);
+
+  Tensor3 dr(2, np - 1, nq);
+  std::for_each(dr.elem_begin(), dr.elem_end(), [&](Numeric& x) {
+    x = 1e-2 * dist(gen);
+  });
+
+  rtepack::TransmittanceMatrix scalar;
+  scalar.init(K, dK, r, dr, option);
+  if (scalar.is_polarized()) {
+    throw std::runtime_error(
+        std::format("{} unpolarized input gives polarized matrices", option));
+  }
+
+  rtepack::TransmittanceMatrix matrix = scalar;
+  matrix.polarized                    = true;
+
+  SourceVector src;
+  src.J.resize(nf, np);
+  src.dJ.resize(nf, np, nq);
+  std::for_each(src.J.elem_begin(), src.J.elem_end(), [&](Stokvec& x) {
+    x = Stokvec{dist(gen), d(gen), d(gen), d(gen)};
+  });
+  std::for_each(src.dJ.elem_begin(), src.dJ.elem_end(), [&](Stokvec& x) {
+    x = Stokvec{d(gen), d(gen), d(gen), d(gen)};
+  });
+
+  StokvecVector I0(nf);
+  for (auto& x : I0) x = Stokvec{dist(gen), d(gen), d(gen), d(gen)};
+
+  {
+    StokvecVector I_s{I0}, I_m{I0};
+    StokvecTensor3 dI_s(nf, np, nq), dI_m(nf, np, nq);
+    dI_s = Stokvec{0.0, 0.0, 0.0, 0.0};
+    dI_m = Stokvec{0.0, 0.0, 0.0, 0.0};
+
+    rte_emission(I_s, dI_s, scalar, src);
+    rte_emission(I_m, dI_m, matrix, src);
+    compare(I_s, I_m, "rte_emission I", option);
+    compare(dI_s, dI_m, "rte_emission dI", option);
+  }
+
+  {
+    StokvecMatrix I_s(nf, np), I_m(nf, np);
+    for (Size iv = 0; iv < nf; iv++) I_s[iv, np - 1] = I0[iv];
+    I_m = I_s;
+
+    rte_emission_path(I_s, scalar, src);
+    rte_emission_path(I_m, matrix, src);
+    compare(I_s, I_m, "rte_emission_path I", option);
+  }
+
+  {
+    StokvecVector I_s(nf), I_m(nf);
+    StokvecTensor3 dI_s(nf, np, nq), dI_m(nf, np, nq);
+
+    rte_transmission(I_s, dI_s, scalar, I0);
+    rte_transmission(I_m, dI_m, matrix, I0);
+    compare(I_s, I_m, "rte_transmission I", option);
+    compare(dI_s, dI_m, "rte_transmission dI", option);
+  }
+
+  // A polarized derivative alone gives polarized derivative matrices
+  dK[1][0, 0] = Propmat{0.0, 1e-2, 0.0, 0.0, 0.0, 0.0, 0.0};
+  scalar.init(K, dK, r, dr, option);
+  if (not scalar.is_polarized()) {
+    throw std::runtime_error(
+        std::format("{} polarized dK gives unpolarized matrices", option));
+  }
+}
+}  // namespace
+
+int main() try {
+  std::cout << "rtepack-polarized-test\n";
+
+  for (auto option : {TransmittanceOption::constant,
+                      TransmittanceOption::linsrc,
+                      TransmittanceOption::linprop}) {
+    scalar_vs_matrix(option);
+  }
+
+  return EXIT_SUCCESS;
+} catch (const std::exception& e) {
+  std::cerr << "Error: " << e.what() << '\n';
+  return EXIT_FAILURE;
+}
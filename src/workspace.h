@@ -11,6 +11,7 @@
 #include "workspace_agenda_class.h"
 #include "workspace_agenda_creator.h"
 #include "workspace_class.h"
+#include "workspace_compiled_agenda.h"
 #include "workspace_method_class.h"
 
 // Autogenerated helpers
@@ -1,12 +1,20 @@
 #include "workspace_agenda_class.h"
 
+#include <arts_omp.h>
 #include <auto_wsa.h>
 #include <auto_wsm.h>
+#include <auto_wsv.h>
 #include <compare.h>
 #include <debug.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
 #include <ranges>
 #include <stdexcept>
 #include <string>
@@ -17,10 +25,13 @@
 #include "enumsWorkspaceInitialization.h"
 #include "time_report.h"
 #include "workspace_class.h"
+#include "workspace_compiled_agenda.h"
 #include "workspace_method_class.h"
 
 void Agenda::add(const Method& method) {
   checked = false;
+  compiled_agenda.reset();
+  level_timings.reset();
   method.add_defaults_to_agenda(*this);
   methods.push_back(method);
 }
@@ -147,7 +158,9 @@ Agenda required output: {:B,}
   copy  = in_then_out;
   share = ins_first;
 
-  checked = true;
+  checked         = true;
+  compiled_agenda = std::make_shared<const CompiledAgenda>(*this);
+  level_timings.reset();
 } catch (std::exception& e) {
   throw std::runtime_error(std::format(R"(Cannot finalize agenda "{}"
 
@@ -372,32 +385,359 @@ std::vector<Agenda> Agenda::par_tasks(Workspace& ws) const try {
                                        e.what()));
 }
 
+namespace {
+bool is_local(const std::string& s) {
+  return s.starts_with(named_input_prefix) or s.starts_with(internal_prefix);
+}
+
+/*! Variables that contributions add to
+
+  The documentation of the spectral_propmat methods with "Add" in their
+  name states that they only add to these variables.  Contributions may
+  thus run on private accumulators that start at zero, and the
+  accumulators are summed into the variables afterwards.
+*/
+constexpr std::array additive_variables{"spectral_propmat"sv,
+                                        "spectral_propmat_jac"sv,
+                                        "spectral_nlte_srcvec"sv,
+                                        "spectral_nlte_srcvec_jac"sv};
+
+bool is_additive(const std::string& var) {
+  return stdr::find(additive_variables, var) != additive_variables.end();
+}
+
+//! Whether the method only adds to its outputs, which it also reads
+bool is_contribution(const Method& method) {
+  const std::string& name = method.get_name();
+  if (not name.starts_with("spectral_propmat") or not name.contains("Add")) {
+    return false;
+  }
+
+  const auto& ins = method.get_ins();
+  return stdr::all_of(method.get_outs(), [&ins](const std::string& out) {
+    return is_additive(out) and stdr::find(ins, out) != ins.end();
+  });
+}
+
+//! Calls f with the value of an additive variable
+template <typename F>
+void visit_additive(const Wsv& x, F&& f) {
+  if (x.holds<PropmatVector>()) {
+    f(x.get_unsafe<PropmatVector>());
+  } else if (x.holds<PropmatMatrix>()) {
+    f(x.get_unsafe<PropmatMatrix>());
+  } else if (x.holds<StokvecVector>()) {
+    f(x.get_unsafe<StokvecVector>());
+  } else if (x.holds<StokvecMatrix>()) {
+    f(x.get_unsafe<StokvecMatrix>());
+  } else {
+    throw std::runtime_error(
+        std::format("Cannot accumulate a {}", x.type_name()));
+  }
+}
+
+//! An accumulator of the same shape as x, set to zero
+Wsv zero_like(const Wsv& x) {
+  Wsv out;
+  visit_additive(x, [&out]<typename T>(const T& v) {
+    T z{v};
+    z   = matpack::value_type<T>{};
+    out = Wsv{std::move(z)};
+  });
+  return out;
+}
+
+/*! A method of the agenda as a node of its dependency graph
+
+  The node runs its methods on a local workspace that shares the variables
+  of the run workspace that the node reads or writes.  Local variables
+  (named inputs and defaults) are set by copies of their setval methods, so
+  they are private to every node that reads them.  The additive variables
+  of a contribution are private accumulators instead of shared.
+*/
+struct method_node {
+  std::vector<const Method*> methods{};
+  std::vector<std::string> shared{};
+  std::vector<std::string> outs{};
+  std::vector<std::string> adds{};
+  Size level{0};
+};
+
+/*! The dependency graph of the methods
+
+  A node depends on the last writer of each variable it reads (read after
+  write), and on the last writer and all readers since of each variable it
+  writes (write after write, and write after read).  A contribution adds to
+  its additive variables rather than writing them, so contributions to the
+  same variable do not depend on each other.  They depend on the last writer
+  and the readers since, and later readers and writers depend on all of
+  them.  The level of a node is one more than the highest level of its
+  dependencies, so the nodes of a level do not depend on each other.
+
+  Outputs that the calling workspace lacks are created in missing, so that
+  the caller is not touched before the graph has run.  Workspace variables
+  and variables set by setval methods can be created.  If any other output
+  is missing, there is no graph and the agenda must run in order.
+*/
+std::optional<std::vector<method_node>> method_graph(
+    const std::vector<Method>& methods,
+    const Workspace& ws,
+    std::unordered_map<std::string, Wsv>& missing) {
+  const auto& wsvs = workspace_variables();
+
+  std::vector<method_node> nodes{};
+  std::unordered_map<std::string, const Method*> local_setval{};
+  std::unordered_map<std::string, Size> last_write{};
+  std::unordered_map<std::string, std::vector<Size>> last_reads{};
+  std::unordered_map<std::string, std::vector<Size>> last_adds{};
+
+  for (auto& method : methods) {
+    const bool setval =
+        method.get_setval().has_value() and not method.is_callback();
+
+    if (setval and is_local(method.get_name())) {
+      local_setval[method.get_name()] = &method;
+      continue;
+    }
+
+    const bool contribution = is_contribution(method);
+
+    const Size i = nodes.size();
+    auto& node   = nodes.emplace_back();
+
+    const auto depend_on = [i, &node, &nodes](Size j) {
+      if (j != i) node.level = std::max(node.level, nodes[j].level + 1);
+    };
+
+    for (auto& in : method.get_ins()) {
+      if (auto ptr = local_setval.find(in); ptr != local_setval.end()) {
+        node.methods.push_back(ptr->second);
+        continue;
+      }
+
+      node.shared.push_back(in);
+      if (contribution and is_additive(in)) continue;
+
+      if (auto ptr = last_write.find(in); ptr != last_write.end()) {
+        depend_on(ptr->second);
+      }
+      for (Size j : last_adds[in]) depend_on(j);
+      last_reads[in].push_back(i);
+    }
+
+    for (auto& out : method.get_outs()) {
+      local_setval.erase(out);
+
+      if (not ws.contains(out) and not missing.contains(out)) {
+        if (auto ptr = wsvs.find(out); ptr != wsvs.end()) {
+          missing[out] = Wsv::from_named_type(ptr->second.type);
+        } else if (setval) {
+          missing[out] = Wsv::from_named_type(method.get_setval()->type_name());
+        } else {
+          return std::nullopt;
+        }
+      }
+
+      node.shared.push_back(out);
+      if (auto ptr = last_write.find(out); ptr != last_write.end()) {
+        depend_on(ptr->second);
+      }
+      auto& reads = last_reads[out];
+      for (Size j : reads) depend_on(j);
+
+      if (contribution) {
+        node.adds.push_back(out);
+        last_adds[out].push_back(i);
+        continue;
+      }
+
+      auto& adds = last_adds[out];
+      for (Size j : adds) depend_on(j);
+      adds.clear();
+      reads.clear();
+
+      node.outs.push_back(out);
+      last_write[out] = i;
+    }
+
+    node.methods.push_back(&method);
+
+    stdr::sort(node.shared);
+    node.shared.erase(stdr::unique(node.shared).begin(), node.shared.end());
+  }
+
+  return nodes;
+}
+}  // namespace
+
+/*! The run times of the levels of the dependency graph of par_execute
+
+  A level of several nodes may run in order, every node with all of the
+  threads, or in parallel, every node with a share of the threads.  Each way
+  is timed the first time the agenda runs, and the faster is used after.
+*/
+struct AgendaLevelTimings {
+  enum way : std::uint8_t { in_order, parallel };
+
+  std::mutex mtx{};
+  std::vector<std::array<Numeric, 2>> levels{};
+};
+
 void Agenda::par_execute(Workspace& ws) const try {
   ARTS_TIME_REPORT
 
-  const auto tasks = par_tasks(ws);
+  // Nested calls run in order, the threads of the team are already busy
+  if (arts_omp_in_parallel()) {
+    execute(ws);
+    return;
+  }
+
+  std::unordered_map<std::string, Wsv> missing{};
+  const auto graph = method_graph(methods, ws, missing);
+  if (not graph) {
+    execute(ws);
+    return;
+  }
+
+  const auto& nodes = graph.value();
+
+  std::vector<std::vector<Size>> levels{};
+  for (Size i = 0; i < nodes.size(); i++) {
+    const Size level = nodes[i].level;
+    if (levels.size() <= level) levels.resize(level + 1);
+    levels[level].push_back(i);
+  }
+
+  // A chain gains nothing from the graph
+  if (stdr::all_of(levels, [](auto& level) { return level.size() < 2; })) {
+    execute(ws);
+    return;
+  }
+
+  // The graph runs on a workspace of its own, so that the variables of the
+  // caller are only created or replaced once all of the methods have run
+  Workspace run_ws{WorkspaceInitialization::Empty};
+  for (auto& node : nodes) {
+    for (auto& str : node.shared) {
+      if (run_ws.contains(str)) continue;
+      if (auto ptr = missing.find(str); ptr != missing.end()) {
+        run_ws.set(str, ptr->second);
+      } else {
+        run_ws.set(str, ws.share(str));
+      }
+    }
+  }
 
   std::string error_message;
+  std::vector<std::vector<Wsv>> accumulators(nodes.size());
+
+  const auto run = [&](Size i) {
+    const method_node& node = nodes[i];
 
-#pragma omp parallel for schedule(dynamic)
-  for (auto& task : tasks) {
     try {
       Workspace local_ws{WorkspaceInitialization::Empty};
-      task.share_workspace(local_ws, ws);
-      task.execute(local_ws);
+      for (auto& str : node.shared) local_ws.set(str, run_ws.share(str));
+      for (auto& str : node.adds) {
+        local_ws.set(str, zero_like(run_ws.share(str)));
+      }
+
+      for (auto* method : node.methods) (*method)(local_ws);
+
+      // Setval methods and callbacks may replace rather than modify
+      for (auto& str : node.outs) {
+        run_ws.wsv.find(str)->second = local_ws.share(str);
+      }
+
+      for (auto& str : node.adds) {
+        accumulators[i].push_back(local_ws.share(str));
+      }
     } catch (std::exception& e) {
 #pragma omp critical
       if (error_message.empty()) {
         error_message = std::format(R"(Failed to execute method "{}":
 
 {})",
-                                    task.get_name(),
+                                    node.methods.back()->get_name(),
                                     e.what());
       }
     }
+  };
+
+  // The threads are split between the nodes of a level.  Their own parallel
+  // loops are nested one level deeper and get the share of their node.
+  const auto run_parallel = [&](const std::vector<Size>& level) {
+    const int nt      = arts_omp_get_max_threads();
+    const int nl      = static_cast<int>(std::min<Size>(level.size(), nt));
+    const int nested  = arts_omp_get_max_active_levels();
+    const int nthread = std::max(1, nt / nl);
+
+    arts_omp_set_max_active_levels(std::max(nested, 2));
+#pragma omp parallel for schedule(dynamic, 1) num_threads(nl)
+    for (Size i = 0; i < level.size(); i++) {
+      arts_omp_set_num_threads(nthread);
+      run(level[i]);
+    }
+    arts_omp_set_max_active_levels(nested);
+  };
+
+  if (not level_timings) level_timings = std::make_shared<AgendaLevelTimings>();
+  AgendaLevelTimings& timings = *level_timings;
+
+  std::vector<std::array<Numeric, 2>> times;
+  {
+    std::scoped_lock lock(timings.mtx);
+    if (timings.levels.size() != levels.size()) {
+      timings.levels.assign(levels.size(), {-1.0, -1.0});
+    }
+    times = timings.levels;
+  }
+
+  // A level of one node runs outside of any parallel region, so that the
+  // parallel loops of its methods get all of the threads
+  for (Size il = 0; il < levels.size(); il++) {
+    auto& level = levels[il];
+
+    if (level.size() == 1) {
+      run(level.front());
+    } else {
+      auto& [in_order_time, parallel_time] = times[il];
+      const auto way = in_order_time < 0.0    ? AgendaLevelTimings::in_order
+                       : parallel_time < 0.0 ? AgendaLevelTimings::parallel
+                       : parallel_time < in_order_time
+                           ? AgendaLevelTimings::parallel
+                           : AgendaLevelTimings::in_order;
+
+      const auto start = std::chrono::steady_clock::now();
+      if (way == AgendaLevelTimings::parallel) {
+        run_parallel(level);
+      } else {
+        for (Size i : level) run(i);
+      }
+      times[il][way] = std::chrono::duration<Numeric>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
+    }
+
+    if (not error_message.empty()) throw std::runtime_error(error_message);
+
+    // The contributions are summed in the order of the methods
+    for (Size i : level) {
+      for (Size j = 0; j < nodes[i].adds.size(); j++) {
+        const Wsv& acc = accumulators[i][j];
+        visit_additive(run_ws.share(nodes[i].adds[j]),
+                       [&acc]<typename T>(T& v) { v += acc.get<T>(); });
+      }
+    }
   }
 
-  if (not error_message.empty()) throw std::runtime_error(error_message);
+  {
+    std::scoped_lock lock(timings.mtx);
+    timings.levels = times;
+  }
+
+  for (auto& node : nodes) {
+    for (auto& str : node.outs) ws.wsv[str] = run_ws.share(str);
+  }
 } catch (std::exception& e) {
   throw std::runtime_error(std::format(R"(Cannot perform parallel execution of:
 
@@ -420,7 +760,22 @@ Agenda::Agenda(std::string n,
                const std::vector<std::string>& s,
                const std::vector<std::string>& c,
                bool check)
-    : name(std::move(n)), methods(m), share(s), copy(c), checked(check) {}
+    : name(std::move(n)), methods(m), share(s), copy(c), checked(check) {
+  if (checked) compiled_agenda = std::make_shared<const CompiledAgenda>(*this);
+}
+
+const CompiledAgenda& Agenda::compiled() const {
+  if (not compiled_agenda) {
+    throw std::runtime_error(
+        std::format(R"(Agenda "{}" is not finalized)", name));
+  }
+  return *compiled_agenda;
+}
+
+void Agenda::set_name(const std::string& v) {
+  name = v;
+  if (checked) compiled_agenda = std::make_shared<const CompiledAgenda>(*this);
+}
 
 std::string Agenda::sphinx_list(const std::string_view prep) const {
   std::string out{};
@@ -3,8 +3,11 @@
 #include <array.h>
 #include <xml.h>
 
+#include <memory>
 #include <vector>
 
+struct AgendaLevelTimings;
+class CompiledAgenda;
 class Method;
 struct Workspace;
 class Wsv;
@@ -15,6 +18,8 @@ class Agenda {
   std::vector<std::string> share{};
   std::vector<std::string> copy{};
   bool checked{false};
+  std::shared_ptr<const CompiledAgenda> compiled_agenda{};
+  mutable std::shared_ptr<AgendaLevelTimings> level_timings{};
 
  public:
   Agenda(std::string name = "not-a-name");
@@ -30,6 +35,9 @@ class Agenda {
   //! Must be called before named agendas, will deal with input and output variables for copy_workspace
   void finalize(bool fix = false);
 
+  //! The resolved local workspace layout, only available for checked agendas
+  [[nodiscard]] const CompiledAgenda& compiled() const;
+
   //! Copies the required workspace variables from the agenda (shares workspace variables not required to be copied)
   void copy_workspace(Workspace& out, const Workspace& in) const;
 
@@ -42,17 +50,27 @@ class Agenda {
   //! Executes the agenda without checks on the current workspace
   void execute(Workspace& ws) const;
 
-  //! Executes the agenda methods in parallel without checks
+  //! Groups consecutive independent methods into tasks (for inspection)
   std::vector<Agenda> par_tasks(Workspace& ws) const;
 
-  //! Executes the agenda methods in parallel without checks
+  /*! Executes the agenda methods in parallel without checks
+
+    Methods run by levels of their dependency graph through their inputs
+    and outputs, the methods of a level in parallel.  Absorption
+    contributions add to private accumulators that are summed after their
+    level, so they do not form a chain.  The threads are split between the
+    methods of a level, unless running the level in order was faster the
+    first time.  Variables are only created or replaced in the workspace
+    once all methods have run.  Runs in order if the graph is a chain or if
+    called from a parallel region.
+  */
   void par_execute(Workspace& ws) const;
 
   [[nodiscard]] bool is_checked() const { return checked; }
 
   [[nodiscard]] const std::string& get_name() const { return name; }
 
-  void set_name(const std::string& v) { name = v; }
+  void set_name(const std::string& v);
 
   [[nodiscard]] bool has_method(const std::string& method) const;
 
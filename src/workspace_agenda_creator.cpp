@@ -100,6 +100,7 @@ Agenda get_spectral_rad_observer_agenda(const std::string_view option) {
       agenda.add("atm_pathFromPath");
       agenda.add("freq_grid_pathFromPath");
       agenda.add("spectral_propmat_pathAdaptiveHalfPath");
+      agenda.add("spectral_pathFromPropmatPath");
       agenda.add("spectral_radSetToBackground");
       agenda.add("spectral_radSinglePathEmissionFrequencyLoop");
       agenda.add("spectral_rad_jacAddSensorJacobianPerturbations");
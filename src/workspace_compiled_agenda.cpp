@@ -0,0 +1,173 @@
+#include "workspace_compiled_agenda.h"
+
+#include <array_algo.h>
+#include <auto_wsa.h>
+#include <auto_wsv.h>
+
+#include <algorithm>
+#include <format>
+#include <stdexcept>
+
+#include "workspace_agenda_class.h"
+#include "workspace_method_class.h"
+
+CompiledAgenda::CompiledAgenda(const Agenda& agenda)
+    : name(agenda.get_name()), share(agenda.get_share()) {
+  const auto& wsa = workspace_agendas();
+
+  std::vector<std::string> outs{};
+  if (auto ptr = wsa.find(name); ptr != wsa.end()) {
+    args = ptr->second.input;
+    for (auto& o : ptr->second.output) {
+      if (stdr::find(args, o) == args.end()) {
+        args.push_back(o);
+        outs.push_back(o);
+      }
+    }
+  }
+
+  // Output-only arguments overwrite their copies before anything runs
+  for (auto& c : agenda.get_copy()) {
+    if (stdr::find(outs, c) == outs.end()) copy.push_back(c);
+  }
+
+  // Built-in variables may only hold their own group
+  const auto& wsv = workspace_variables();
+  types.reserve(args.size());
+  for (auto& a : args) {
+    auto ptr = wsv.find(a);
+    types.push_back(ptr == wsv.end() ? std::string{} : ptr->second.type);
+  }
+
+  nslots = args.size() + share.size() + copy.size();
+  for (auto& m : agenda.get_methods()) nslots += m.get_outs().size();
+}
+
+CompiledAgenda::~CompiledAgenda() = default;
+
+std::unique_ptr<CompiledAgenda::frame_data> CompiledAgenda::lease() const {
+  {
+    std::scoped_lock lock{mtx};
+    if (not pool.empty()) {
+      auto data = std::move(pool.back());
+      pool.pop_back();
+      return data;
+    }
+  }
+
+  auto data = std::make_unique<frame_data>();
+  data->ws.wsv.reserve(nslots);
+  data->spare.reserve(nslots);
+  return data;
+}
+
+void CompiledAgenda::release(std::unique_ptr<frame_data> data) const {
+  static const Wsv none{};
+
+  auto& wsv = data->ws.wsv;
+  while (not wsv.empty()) {
+    auto node     = wsv.extract(wsv.begin());
+    node.mapped() = none;
+    data->spare.push_back(std::move(node));
+  }
+
+  std::scoped_lock lock{mtx};
+  pool.push_back(std::move(data));
+}
+
+CompiledAgenda::Frame::Frame(const CompiledAgenda& ag)
+    : agenda(&ag), data(ag.lease()) {}
+
+CompiledAgenda::Frame::~Frame() { agenda->release(std::move(data)); }
+
+void CompiledAgenda::Frame::insert(const std::string& key, Wsv&& value) {
+  auto& wsv = data->ws.wsv;
+
+  if (auto ptr = wsv.find(key); ptr != wsv.end()) {
+    ptr->second = std::move(value);
+    return;
+  }
+
+  if (data->spare.empty()) {
+    wsv.emplace(key, std::move(value));
+    return;
+  }
+
+  node_type node = std::move(data->spare.back());
+  data->spare.pop_back();
+  node.key()    = key;
+  node.mapped() = std::move(value);
+  wsv.insert(std::move(node));
+}
+
+void CompiledAgenda::Frame::set(Size slot, Wsv&& value) {
+  const std::string& type = agenda->types[slot];
+  if (not type.empty() and type != value.type_name()) {
+    throw std::runtime_error(std::format(
+        R"(Cannot set built-in workspace variable "{}" of workspace group "{}" to type "{}")",
+        agenda->args[slot],
+        type,
+        value.type_name()));
+  }
+
+  insert(agenda->args[slot], std::move(value));
+}
+
+void CompiledAgenda::Frame::share(const Workspace& in) try {
+  auto& wsv = data->ws.wsv;
+
+  for (auto& str : agenda->share) insert(str, Wsv{in.share(str)});
+
+  for (auto& str : agenda->copy) {
+    if (auto ptr = wsv.find(str); ptr != wsv.end()) {
+      ptr->second = ptr->second.copied();
+    } else {
+      insert(str, in.copy(str));
+    }
+  }
+
+  // Nested agendas share what they need, as Agenda::share_workspace
+  WorkspaceAgendaBoolHandler handle;
+  handle.set(agenda->name);
+
+  std::vector<const Agenda*> nested;
+  for (auto& [key, value] : wsv) {
+    if (value.holds<Agenda>() and not handle.has(key)) {
+      handle.set(key);
+      nested.push_back(&value.get_unsafe<Agenda>());
+    }
+  }
+
+  const auto share_nested = [&](const std::vector<std::string>& names) {
+    for (auto& str : names) {
+      if (wsv.contains(str)) continue;
+
+      const Wsv& value = in.share(str);
+      insert(str, Wsv{value});
+      if (value.holds<Agenda>() and not handle.has(str)) {
+        handle.set(str);
+        nested.push_back(&value.get_unsafe<Agenda>());
+      }
+    }
+  };
+
+  while (not nested.empty()) {
+    const Agenda* ag = nested.back();
+    nested.pop_back();
+
+    share_nested(ag->get_share());
+    share_nested(ag->get_copy());
+  }
+} catch (std::exception& e) {
+  throw std::runtime_error(std::format(
+      R"(
+Cannot share workspace for "{}"
+
+Workspace contains:
+{:s}
+
+{})",
+      agenda->name,
+      in,
+      e.what()));
+}
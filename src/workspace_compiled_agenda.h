@@ -0,0 +1,93 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "workspace_class.h"
+
+class Agenda;
+
+/*! The local workspace layout of a finalized agenda
+
+  Executing an agenda needs a local workspace that holds the agenda
+  arguments, the variables shared and copied from the calling workspace,
+  and the variables shared into any nested agendas.  The names of these are
+  resolved when the agenda is finalized: The arguments are numbered in the
+  order of the agenda record (inputs, then the outputs that are not inputs),
+  and copies that are overwritten by an output argument anyway are dropped.
+
+  A slot is only the index of an argument name.  The local workspace is
+  still the name-keyed map that the methods look their arguments up in, so
+  setting a slot inserts by name.  Slot-indexed storage would need every
+  method wrapper to resolve its arguments to slots instead of names.
+
+  Local workspaces are pooled.  A frame leases one, fills it, and when the
+  frame goes out of scope the map nodes are kept for the next call, so a
+  call does not allocate the local workspace, its buckets, or the nodes of
+  the variables set by the frame.
+*/
+class CompiledAgenda {
+  using node_type = std::unordered_map<std::string, Wsv>::node_type;
+
+  struct frame_data {
+    Workspace ws{WorkspaceInitialization::Empty};
+    std::vector<node_type> spare{};
+  };
+
+  std::string name{};
+  std::vector<std::string> args{};
+  std::vector<std::string> types{};
+  std::vector<std::string> share{};
+  std::vector<std::string> copy{};
+  Size nslots{0};
+
+  mutable std::mutex mtx{};
+  mutable std::vector<std::unique_ptr<frame_data>> pool{};
+
+  [[nodiscard]] std::unique_ptr<frame_data> lease() const;
+  void release(std::unique_ptr<frame_data> data) const;
+
+ public:
+  explicit CompiledAgenda(const Agenda& agenda);
+
+  CompiledAgenda(const CompiledAgenda&)            = delete;
+  CompiledAgenda(CompiledAgenda&&)                 = delete;
+  CompiledAgenda& operator=(const CompiledAgenda&) = delete;
+  CompiledAgenda& operator=(CompiledAgenda&&)      = delete;
+
+  ~CompiledAgenda();
+
+  //! The agenda arguments, inputs first, then the outputs that are not inputs
+  [[nodiscard]] const std::vector<std::string>& get_args() const {
+    return args;
+  }
+
+  //! A leased local workspace, returned to the pool on destruction
+  class Frame {
+    const CompiledAgenda* agenda;
+    std::unique_ptr<frame_data> data;
+
+    void insert(const std::string& key, Wsv&& value);
+
+   public:
+    explicit Frame(const CompiledAgenda& agenda);
+
+    Frame(const Frame&)            = delete;
+    Frame(Frame&&)                 = delete;
+    Frame& operator=(const Frame&) = delete;
+    Frame& operator=(Frame&&)      = delete;
+
+    ~Frame();
+
+    //! Sets the argument of the slot, type-checked as Workspace::overwrite
+    void set(Size slot, Wsv&& value);
+
+    //! Shares and copies from the calling workspace, and shares nested agendas
+    void share(const Workspace& in);
+
+    [[nodiscard]] Workspace& workspace() { return data->ws; }
+  };
+};
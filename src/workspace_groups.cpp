@@ -238,6 +238,15 @@ Both the data and the grid may be named.  The grids are not sorted.
       .value_type = true,
   };
 
+  wsg_data["LineByLineCache"] = {
+      .file = "lbl.h",
+      .desc = R"--(A bounded cache of line-by-line absorption
+
+Keyed on the atmospheric state and the frequency grid.  Copies share the
+same cache.
+)--",
+  };
+
   wsg_data["LinemixingEcsData"] = {
       .file = "lbl.h",
       .desc =
@@ -863,6 +872,15 @@ of this term multiplied by a negative distance.
 )--",
   };
 
+  wsg_data["SpectralPath"] = {
+      .file = "rtepack.h",
+      .desc = R"--(Frequency-major propagation matrices and source vectors along a path.
+
+The same data as the point-major path variables, with the path point as the
+inner dimension, so that each frequency is a contiguous row.
+)--",
+  };
+
   wsg_data["TransmittanceMatrix"] = {
       .file = "rtepack.h",
       .desc = R"--(Transmittance matrix and derivatives.
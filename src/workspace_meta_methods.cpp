@@ -188,7 +188,7 @@ This method simply is a convenience wrapper for that use case.
                   "spectral_rad_bkgAgendasAtEndOfPath",
                   "atm_pathFromPath",
                   "freq_grid_pathFromPath",
-                  "spectral_propmat_pathFromPath",
+                  "spectral_pathFromPath",
                   "spectral_radSetToBackground",
                   "spectral_radSinglePathEmissionFrequencyLoop"},
       .out     = {"spectral_rad", "spectral_rad_jac"},
@@ -15,6 +15,11 @@
 
 namespace {
 static const auto& wsms = workspace_methods();
+
+const WorkspaceMethodRecord* find_record(const std::string& name) {
+  auto ptr = wsms.find(name);
+  return ptr == wsms.end() ? nullptr : &ptr->second;
+}
 }  // namespace
 
 Method::Method() : name("this-is-not-a-method") {}
@@ -22,7 +27,10 @@ Method::Method() : name("this-is-not-a-method") {}
 Method::Method(const std::string& n,
                const std::vector<std::string>& a,
                const std::unordered_map<std::string, std::string>& kw) try
-    : name(n), outargs(wsms.at(name).out), inargs(wsms.at(name).in) {
+    : name(n),
+      outargs(wsms.at(name).out),
+      inargs(wsms.at(name).in),
+      record(&wsms.at(name)) {
   const std::size_t nargout = outargs.size();
   const std::size_t nargin  = inargs.size();
 
@@ -171,7 +179,7 @@ void Method::operator()(Workspace& ws) const try {
       }
     }
   } else {
-    wsms.at(name).func(ws, outargs, inargs);
+    (record ? *record : wsms.at(name)).func(ws, outargs, inargs);
   }
 } catch (std::out_of_range&) {
   throw std::runtime_error(std::format("No method named \"{}\"", name));
@@ -209,7 +217,8 @@ Method::Method(const std::string& n,
       outargs(outs),
       inargs(ins),
       setval(wsv),
-      overwrite_setval(overwrite) {}
+      overwrite_setval(overwrite),
+      record(setval ? nullptr : find_record(name)) {}
 
 std::string std::formatter<Wsv>::to_string(const Wsv& wsv) const {
   return wsv.vformat("{}"sv);
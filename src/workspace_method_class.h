@@ -9,6 +9,8 @@
 #include <unordered_map>
 #include <vector>
 
+struct WorkspaceMethodRecord;
+
 inline constexpr char named_input_prefix = '@';
 inline constexpr char internal_prefix    = '_';
 
@@ -19,6 +21,9 @@ class Method {
   std::optional<Wsv> setval{std::nullopt};
   bool overwrite_setval{false};
 
+  //! The method record, resolved on construction (nullptr for set values)
+  const WorkspaceMethodRecord* record{nullptr};
+
  public:
   Method();
   Method(const std::string& name,
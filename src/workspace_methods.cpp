@@ -1090,6 +1090,43 @@ This is based on the work of :cite:t:`Rodrigues1997`.
       .out    = {"abs_ecs_data"},
   };
 
+  wsm_data["abs_lbl_cacheInit"] = {
+      .desc      = R"--(Sets up the line-by-line absorption cache.
+
+The cache keeps the results of *spectral_propmatAddLines* for up to
+``max_entries`` atmospheric states.  States are considered equal if they
+differ by less than the tolerances.  A zero tolerance requires identical
+values.  The frequency grid must always be identical.
+
+Set ``max_entries`` to 0 to turn the cache off.  The hit and miss counters
+of the cache are available on *abs_lbl_cache*.
+
+The cache identifies *abs_bands* and *abs_ecs_data* by their memory
+locations.  Call this method again if these are changed.
+)--",
+      .author    = {"Richard Larsson"},
+      .out       = {"abs_lbl_cache"},
+      .gin       = {"max_entries",
+                    "pressure_tolerance",
+                    "temperature_tolerance",
+                    "vmr_tolerance",
+                    "magnetic_tolerance",
+                    "los_tolerance"},
+      .gin_type  = {"Index", "Numeric", "Numeric", "Numeric", "Numeric", "Numeric"},
+      .gin_value = {Index{1000},
+                    Numeric{0.0},
+                    Numeric{0.0},
+                    Numeric{0.0},
+                    Numeric{0.0},
+                    Numeric{0.0}},
+      .gin_desc  = {"The maximum number of stored results",
+                    "Relative tolerance of the pressure [-]",
+                    "Absolute tolerance of the temperature [K]",
+                    "Relative tolerance of VMRs, isotopologue ratios, and NLTE values [-]",
+                    "Absolute tolerance of the magnetic field [T]",
+                    "Absolute tolerance of the line-of-sight [deg]"},
+  };
+
   wsm_data["abs_ecs_dataAddMeanAir"] = {
       .desc =
           R"--(Combines ECS data from specified species using VMR weights to create air (bath gas) broadening parameters.
@@ -1179,6 +1216,43 @@ Also outputs the *freq_grid_path* as a side effect (of wind).
       .pass_workspace = true,
   };
 
+  wsm_data["spectral_pathFromPath"] = {
+      .desc =
+          R"--(Gets the propagation matrix and non-LTE source term along the path.
+
+As *spectral_propmat_pathFromPath* but the output is frequency-major.  Each
+path point is written to *spectral_path* as soon as it is computed, so the
+point-major path variables are never formed.
+
+The calculations are in parallel if the program is not in parallel already.
+)--",
+      .author         = {"Richard Larsson"},
+      .out            = {"spectral_path"},
+      .in             = {"spectral_propmat_agenda",
+                         "freq_grid_path",
+                         "freq_wind_shift_jac_path",
+                         "jac_targets",
+                         "ray_path",
+                         "atm_path"},
+      .pass_workspace = true,
+  };
+
+  wsm_data["spectral_pathFromPropmatPath"] = {
+      .desc =
+          R"--(Sets *spectral_path* from the point-major path variables.
+
+For paths from methods like *spectral_propmat_pathAdaptiveHalfPath*.  Prefer
+*spectral_pathFromPath* otherwise, it does not need the point-major copy.
+)--",
+      .author = {"Richard Larsson"},
+      .out    = {"spectral_path"},
+      .in     = {"freq_grid_path",
+                 "spectral_propmat_path",
+                 "spectral_nlte_srcvec_path",
+                 "spectral_propmat_jac_path",
+                 "spectral_nlte_srcvec_jac_path"},
+  };
+
   wsm_data["spectral_propmat_pathAdaptiveHalfPath"] = {
       .desc =
           R"--(Same as *spectral_propmat_pathFromPath* but with adaptive path.
@@ -2302,6 +2376,9 @@ The Jacobian variable is all 0s, the background is [1 0 0 0] everywhere
   wsm_data["spectral_radSinglePathEmissionFrequencyLoop"] = {
       .desc =
           R"--(Computes the spectral radiance by looping over frequencies for a single path.
+
+The spectral variables along the path are read from *spectral_path*, see
+*spectral_pathFromPath*.
 )--",
       .author    = {"Richard Larsson"},
       .out       = {"spectral_rad", "spectral_rad_jac"},
@@ -2309,12 +2386,8 @@ The Jacobian variable is all 0s, the background is [1 0 0 0] everywhere
                     "spectral_rad_jac",
                     "jac_targets",
                     "ray_path",
-                    "freq_grid_path",
                     "atm_path",
-                    "spectral_propmat_path",
-                    "spectral_nlte_srcvec_path",
-                    "spectral_propmat_jac_path",
-                    "spectral_nlte_srcvec_jac_path",
+                    "spectral_path",
                     "surf_field",
                     "atm_field"},
       .gin       = {"hse_derivative"},
@@ -2569,6 +2642,9 @@ matrix to be calculated will work.
       .desc      = R"--(Add line-by-line absorption to the propagation matrix.
 
 See :doc:`concept.absorption.lbl` for details.
+
+If *abs_lbl_cache* is active, results are reused for repeated atmospheric
+states.  Calculations with Jacobian targets never use the cache.
 )--",
       .author    = {"Richard Larsson"},
       .out       = {"spectral_propmat",
@@ -2584,6 +2660,7 @@ See :doc:`concept.absorption.lbl` for details.
                     "select_species",
                     "abs_bands",
                     "abs_ecs_data",
+                    "abs_lbl_cache",
                     "atm_point",
                     "ray_point"},
       .gin       = {"no_negative_absorption"},
@@ -2724,6 +2801,50 @@ See :doc:`concept.absorption.lookup` for details.
            "Extrapolation factor"},
   };
 
+  wsm_data["spectral_propmat_pathAddLookup"] = {
+      .desc     = R"--(Add lookup table absorption along the whole path.
+
+This is the path-level version of *spectral_propmatAddLookup*.  All points
+of *atm_path* share *freq_grid*, so the frequency interpolation weights are
+computed only once, and the interpolation itself is performed over all points
+and frequencies at once.  This is considerably faster than calling
+*spectral_propmatAddLookup* per path point.
+
+Note that Doppler shifts are not considered since all points share a single
+frequency grid.  Use *spectral_propmatAddLookup* in the *spectral_propmat_agenda*
+if wind is important.
+
+The output must already be sized to the path and the frequency grid.
+
+See :doc:`concept.absorption.lookup` for details.
+)--",
+      .author   = {"Richard Larsson"},
+      .out      = {"spectral_propmat_path", "spectral_propmat_jac_path"},
+      .in       = {"spectral_propmat_path",
+                   "spectral_propmat_jac_path",
+                   "freq_grid",
+                   "jac_targets",
+                   "select_species",
+                   "abs_lookup_data",
+                   "atm_path"},
+      .gin      = {"no_negative_absorption",
+                   "p_interp_order",
+                   "t_interp_order",
+                   "water_interp_order",
+                   "f_interp_order",
+                   "extpolfac"},
+      .gin_type = {"Index", "Index", "Index", "Index", "Index", "Numeric"},
+      .gin_value =
+          {Index{1}, Index{7}, Index{7}, Index{7}, Index{7}, Numeric{0.5}},
+      .gin_desc =
+          {"Turn off to allow individual absorbers to have negative absorption",
+           "Interpolation order for pressure",
+           "Interpolation order for temperature",
+           "Interpolation order for water vapor",
+           "Interpolation order for frequency",
+           "Extrapolation factor"},
+  };
+
   wsm_data["jac_targetsToggleRelativeHumidityAtmTarget"] = {
       .desc   = R"--(Toggles relative humidity or absolute retrievals.
 
@@ -3249,6 +3370,12 @@ exceeded.
 The optional parameter ``einstein_coefficient`` is used to indicate if it is to
 be computed from the line strength, or simply read from the Hitran data.
 
+The file is parsed on multiple threads.  If a ``cache_file`` is given, all
+records of the HITRAN file are stored there in a binary format, together with
+a hash of the content of the HITRAN file.  Later calls read the records from the
+cache instead of parsing the HITRAN file, as long as the hash matches.  Only the
+records in the frequency range and of the selected species are then read.
+
 .. warning::
    Several HITRAN lines has Einstein coefficients that will not reproduce the results
    of pure line strength simulations.  If the option is set to read the Einstein
@@ -3269,20 +3396,32 @@ be computed from the line strength, or simply read from the Hitran data.
                     "frequency_range",
                     "file_formatter",
                     "line_strength_option",
-                    "compute_zeeman_parameters"},
-      .gin_type  = {"String", "Vector2", "ArrayOfString", "String", "Index"},
+                    "compute_zeeman_parameters",
+                    "species",
+                    "cache_file"},
+      .gin_type  = {"String",
+                    "Vector2",
+                    "ArrayOfString",
+                    "String",
+                    "Index",
+                    "ArrayOfSpeciesEnum",
+                    "String"},
       .gin_value = {std::nullopt,
                     Vector2{-std::numeric_limits<Numeric>::infinity(),
                             std::numeric_limits<Numeric>::infinity()},
                     ArrayOfString{"par"},
                     String{"S"},
-                    Index{1}},
+                    Index{1},
+                    ArrayOfSpeciesEnum{},
+                    String{}},
       .gin_desc =
           {"Filename",
            "Frequency range selection",
            "The order of file format types.  See *HitranFileFormatType* for valid options",
            "Whether the Hitran line strength or the Hitran Einstein coefficient is used, the latter has historically been less reliable",
-           "Compute the Zeeman parameters from the HITRAN data (will not activate Zeeman calculations, this must be done manually afterwards)"},
+           "Compute the Zeeman parameters from the HITRAN data (will not activate Zeeman calculations, this must be done manually afterwards)",
+           "Species selection, all species are read if empty",
+           "Binary cache of the HITRAN file, not used if empty"},
   };
 
   wsm_data["abs_bandsReadJPL"] = {
@@ -3391,9 +3530,63 @@ If ``line`` is positive, also keep only the line of this index
       .out    = {"abs_lookup_data"},
   };
 
+  wsm_data["abs_lookup_dataReadMapped"] = {
+      .desc =
+          R"--(Read *abs_lookup_data* from a memory-mapped binary file.
+
+The file must have been written by *abs_lookup_dataWriteMapped*.
+
+Only the grids are copied into memory.  The cross sections are
+viewed read-only directly in the mapped file.  Several processes that
+read the same file thus share a single copy of the cross sections in
+the page cache of the operating system, and reading a table takes
+the same time regardless of its size.
+
+Tables read this way are read-only.  Recomputing or writing them to
+XML will copy their data into memory.
+)--",
+      .author    = {"Richard Larsson"},
+      .out       = {"abs_lookup_data"},
+      .gin       = {"filename"},
+      .gin_type  = {"String"},
+      .gin_value = {std::nullopt},
+      .gin_desc  = {"Name of the binary lookup table file"},
+  };
+
+  wsm_data["abs_lookup_dataWriteMapped"] = {
+      .desc =
+          R"--(Write *abs_lookup_data* to a memory-mappable binary file.
+
+See *abs_lookup_dataReadMapped* for reading the file.
+
+The file is written in the native byte-order of the machine and is
+versioned.  The cross section data is page-aligned.
+)--",
+      .author    = {"Richard Larsson"},
+      .in        = {"abs_lookup_data"},
+      .gin       = {"filename"},
+      .gin_type  = {"String"},
+      .gin_value = {std::nullopt},
+      .gin_desc  = {"Name of the binary lookup table file"},
+  };
+
   wsm_data["abs_lookup_dataPrecompute"] = {
       .desc =
           R"--(Precompute the lookup table for a single species, adding it to the map.
+
+The cross sections are computed in blocks of ``frequency_block_size`` frequencies.
+This bounds the memory each thread needs for the line-by-line calculations.
+A zero block size computes all frequencies at once.
+
+If ``filename`` is given, each finished block is written straight to a
+memory-mappable binary file (see *abs_lookup_dataReadMapped*) and the table
+is never fully held in memory.  The progress is recorded next to the file,
+so that an interrupted computation resumes after the last finished block
+when called again with the same input.  The output table is mapped from the file.
+
+The ``storage`` of the cross sections may be reduced from double precision
+to save memory, see *LookupTableStorage*.  This is only possible for tables
+that are kept in memory.
 )--",
       .author    = {"Richard Larsson"},
       .out       = {"abs_lookup_data"},
@@ -3403,12 +3596,24 @@ If ``line`` is positive, also keep only the line of this index
                     "abs_bands",
                     "abs_ecs_data",
                     "select_species"},
-      .gin       = {"temperature_perturbation", "water_perturbation"},
-      .gin_type  = {"AscendingGrid", "AscendingGrid"},
-      .gin_value = {AscendingGrid{}, AscendingGrid{}},
+      .gin       = {"temperature_perturbation",
+                    "water_perturbation",
+                    "frequency_block_size",
+                    "filename",
+                    "storage"},
+      .gin_type  = {
+          "AscendingGrid", "AscendingGrid", "Index", "String", "String"},
+      .gin_value = {AscendingGrid{},
+                    AscendingGrid{},
+                    Index{0},
+                    String{},
+                    String{"Double"}},
       .gin_desc =
           {"Temperature perturbation to use for the lookup table",
-           "Water vapor perturbation to use for the lookup table (makes the species nonlinear)"},
+           "Water vapor perturbation to use for the lookup table (makes the species nonlinear)",
+           "Number of frequencies computed at a time (0 for all)",
+           "Binary file to stream the table to (empty to keep it in memory)",
+           "How the cross sections are stored.  See *LookupTableStorage* for valid options"},
   };
 
   wsm_data["abs_lookup_dataPrecomputeAll"] = {
@@ -3417,6 +3622,9 @@ If ``line`` is positive, also keep only the line of this index
 
 Wraps *abs_lookup_dataPrecompute* for each species, passing ``water_perturbation`` along
 for those species that are ``water_affected_species``.
+
+See *abs_lookup_dataPrecompute* for ``frequency_block_size``, ``filename``,
+and ``storage``.  All species are streamed to the same file.
 )--",
       .author    = {"Richard Larsson"},
       .out       = {"abs_lookup_data"},
@@ -3427,13 +3635,29 @@ for those species that are ``water_affected_species``.
                     "abs_ecs_data"},
       .gin       = {"temperature_perturbation",
                     "water_perturbation",
-                    "water_affected_species"},
-      .gin_type  = {"AscendingGrid", "AscendingGrid", "ArrayOfSpeciesEnum"},
-      .gin_value = {AscendingGrid{}, AscendingGrid{}, ArrayOfSpeciesEnum{}},
+                    "water_affected_species",
+                    "frequency_block_size",
+                    "filename",
+                    "storage"},
+      .gin_type  = {"AscendingGrid",
+                    "AscendingGrid",
+                    "ArrayOfSpeciesEnum",
+                    "Index",
+                    "String",
+                    "String"},
+      .gin_value = {AscendingGrid{},
+                    AscendingGrid{},
+                    ArrayOfSpeciesEnum{},
+                    Index{0},
+                    String{},
+                    String{"Double"}},
       .gin_desc =
           {"Temperature perturbation to use for the lookup table",
            "Water vapor perturbation to use for the lookup table",
-           "A list of absorption species that are affected by water vapor perturbations nonlinearly"},
+           "A list of absorption species that are affected by water vapor perturbations nonlinearly",
+           "Number of frequencies computed at a time (0 for all)",
+           "Binary file to stream the tables to (empty to keep them in memory)",
+           "How the cross sections are stored.  See *LookupTableStorage* for valid options"},
   };
 
   wsm_data["abs_lookup_dataFromProfiles"] = {
@@ -3455,13 +3679,15 @@ Unlike *abs_lookup_dataPrecomputeAll*, this method will initialize
                     "temperature_perturbation",
                     "water_perturbation",
                     "water_affected_species",
-                    "default_isotopologue_ratios"},
+                    "default_isotopologue_ratios",
+                    "storage"},
       .gin_type  = {"DescendingGrid",
                     "Vector",
                     "SpeciesEnumVectors",
                     "AscendingGrid",
                     "AscendingGrid",
                     "ArrayOfSpeciesEnum",
+                    "String",
                     "String"},
       .gin_value = {std::nullopt,
                     std::nullopt,
@@ -3469,7 +3695,8 @@ Unlike *abs_lookup_dataPrecomputeAll*, this method will initialize
                     AscendingGrid{},
                     AscendingGrid{},
                     ArrayOfSpeciesEnum{},
-                    String{"Builtin"}},
+                    String{"Builtin"},
+                    String{"Double"}},
       .gin_desc =
           {"Pressure profile [Pa]",
            "Temperature profile [K]",
@@ -3477,7 +3704,8 @@ Unlike *abs_lookup_dataPrecomputeAll*, this method will initialize
            "Temperature perturbation to use for the lookup table",
            "Water vapor perturbation to use for the lookup table",
            "A list of absorption species that are affected by water vapor perturbations nonlinearly",
-           "Default isotopologue ratio option to initialize the *AtmPoint* with"},
+           "Default isotopologue ratio option to initialize the *AtmPoint* with",
+           "How the cross sections are stored.  See *LookupTableStorage* for valid options"},
   };
 
   wsm_data["abs_lookup_dataSimpleWide"] = {
@@ -4498,7 +4726,9 @@ The core calculations happens inside the *spectral_rad_observer_agenda*.
    startup cost.  If your calculations are slow and requires multiple
    calls to the *spectral_rad_observer_agenda*, consider switching to
    the "High Performance" kernel, which is :math:`O(N+M)` compared to
-   the low-memory option :math:`O(N \times M)`.
+   the low-memory option :math:`O(N \times M)`.  The "Streaming" kernel
+   is also :math:`O(N+M)`, but only keeps a few simulations per core,
+   which suits many channels with large Jacobians.
 )--",
       .author    = {"Richard Larsson"},
       .out       = {"measurement_vec", "measurement_jac"},
@@ -5216,6 +5446,20 @@ Description of the special input arguments:
     - ``display_progress``:
 
       Controls if there is any screen output. The overall report level is ignored by this WSM.
+
+    - ``jac_chunk_size``:
+
+      If positive, the CG methods ("li_cg", "gn_cg" and "lm_cg") are run
+      matrix-free.  The conjugate gradient solver only uses the products
+      of the Jacobian with vectors.  Each product simulates the Jacobian
+      again for this many obsels of *measurement_sensor* at a time, adds
+      the part of the product of these obsels, and drops their Jacobian.
+      So the Jacobian is never held in full, and *measurement_jac* and
+      *measurement_gain_mat* are returned as empty matrices.  This trades
+      time for memory: every product costs a full Jacobian simulation.
+      This needs one obsel per element of *measurement_vec*, and sensor and
+      error Jacobian targets are not supported.  Smaller chunks use less
+      memory but run *inversion_iterate_agenda* more times.
 )",
       .author = {"Patrick Eriksson"},
       .out    = {"model_state_vec",
@@ -5254,7 +5498,8 @@ Description of the special input arguments:
                     "stop_dx",
                     "lm_ga_settings",
                     "clear_matrices",
-                    "display_progress"},
+                    "display_progress",
+                    "jac_chunk_size"},
       .gin_type  = {"String",
                     "Numeric",
                     "Vector",
@@ -5262,6 +5507,7 @@ Description of the special input arguments:
                     "Numeric",
                     "Vector",
                     "Index",
+                    "Index",
                     "Index"},
       .gin_value = {std::nullopt,
                     Numeric{std::numeric_limits<Numeric>::infinity()},
@@ -5270,6 +5516,7 @@ Description of the special input arguments:
                     Numeric{0.01},
                     Vector{},
                     Index{0},
+                    Index{0},
                     Index{0}},
       .gin_desc =
           {"Iteration method. For this and all options below, see further above",
@@ -5279,7 +5526,107 @@ Description of the special input arguments:
            "Stop criterion for iterative inversions",
            "Settings associated with the ga factor of the LM method",
            "An option to save memory",
-           "Flag to control if inversion diagnostics shall be printed on the screen"},
+           "Flag to control if inversion diagnostics shall be printed on the screen",
+           "Obsels per Jacobian simulation of the matrix-free CG methods, 0 for none"},
+      .pass_workspace = true,
+  };
+
+  wsm_data["OEMBatch"] = {
+      .desc      = R"(Many independent inversions by *OEM*.
+
+Each row of ``measurement_vecs`` is a measurement vector that is inverted
+as by *OEM*, starting from *model_state_vec_apriori*, with the same
+covariance matrices, fields, and sensor.  What is shared by the inversions
+is done once: The covariance matrices are inverted, the input is checked,
+and the measurement vector and its Jacobian are simulated at the a priori
+state.  The inversions are then distributed over the threads.  The
+Jacobian is not simulated for the matrix-free CG methods, see
+``jac_chunk_size`` of *OEM*.
+
+The states, fitted measurement vectors, and diagnostics of the inversions
+are returned as the rows of the matrix outputs.  The diagnostics are those
+of *OEM*.  Inversions that fail are flagged with a 9 in the diagnostics and
+their errors are returned, prefixed by the row of the measurement.
+
+If ``checkpoint_file`` is not empty, the results of the inversions that are
+done are appended to that binary file after every ``checkpoint_interval`` of
+them and at the end.  If the file exists at the start, the inversions that
+are done in it are not repeated, so an interrupted batch can be resumed by
+calling this method again with the same input.  The checkpoint holds a hash
+of ``measurement_vecs``, *model_state_vec_apriori*, the covariance matrices,
+the fields, the bands, *measurement_sensor*, *jac_targets*, and the settings
+of the method, and it is an error to resume it with other values of these.
+Rows of inversions that are not done have NaN diagnostics.
+
+The file is a 40 byte header, followed by one record per inversion of its
+row, its 5 diagnostics, its states, and its fits, all as native 64-bit
+floats.  A later record of a row replaces an earlier one.
+)",
+      .author    = {"Patrick Eriksson"},
+      .gout      = {"model_state_vecs",
+                    "measurement_vec_fits",
+                    "oem_diagnostics",
+                    "errors"},
+      .gout_type = {"Matrix", "Matrix", "Matrix", "ArrayOfString"},
+      .gout_desc = {"The model state vector of each inversion",
+                    "The fitted measurement vector of each inversion",
+                    "The diagnostics of each inversion, as by *OEM*",
+                    "Errors encountered during the inversions"},
+      .in        = {"atm_field",
+                    "abs_bands",
+                    "measurement_sensor",
+                    "surf_field",
+                    "subsurf_field",
+                    "jac_targets",
+                    "model_state_vec_apriori",
+                    "model_state_covmat",
+                    "measurement_vec_error_covmat",
+                    "inversion_iterate_agenda"},
+      .gin       = {"measurement_vecs",
+                    "method",
+                    "max_start_cost",
+                    "model_state_covmat_normalization",
+                    "max_iter",
+                    "stop_dx",
+                    "lm_ga_settings",
+                    "checkpoint_file",
+                    "checkpoint_interval",
+                    "display_progress",
+                    "jac_chunk_size"},
+      .gin_type  = {"Matrix",
+                    "String",
+                    "Numeric",
+                    "Vector",
+                    "Index",
+                    "Numeric",
+                    "Vector",
+                    "String",
+                    "Index",
+                    "Index",
+                    "Index"},
+      .gin_value = {std::nullopt,
+                    std::nullopt,
+                    Numeric{std::numeric_limits<Numeric>::infinity()},
+                    Vector{},
+                    Index{10},
+                    Numeric{0.01},
+                    Vector{},
+                    String{},
+                    Index{100},
+                    Index{0},
+                    Index{0}},
+      .gin_desc =
+          {"The measurement vectors, one per row",
+           "Iteration method, see *OEM*",
+           "Maximum allowed value of cost function at start",
+           "Normalization of Sx",
+           "Maximum number of iterations",
+           "Stop criterion for iterative inversions",
+           "Settings associated with the ga factor of the LM method",
+           "File to checkpoint the inversions to, or empty for none",
+           "Number of inversions between the checkpoints",
+           "Flag to control if the progress shall be printed on the screen",
+           "Obsels per Jacobian simulation of the matrix-free CG methods, see *OEM*"},
       .pass_workspace = true,
   };
 
@@ -138,6 +138,15 @@ Used in line-by-line calculations requiring ECS data.
       .default_value = " ",
   };
 
+  wsv_data["abs_lbl_cache"] = {
+      .desc          = R"--(Cache of line-by-line absorption
+
+Inactive by default.  See *abs_lbl_cacheInit* for details.
+)--",
+      .type          = "LineByLineCache",
+      .default_value = " ",
+  };
+
   wsv_data["abs_predef_data"] = {
       .desc =
           R"--(This contains predefined model data.
@@ -378,6 +387,18 @@ The units are *spectral_rad_jac* per meter.
       .type = "ArrayOfStokvecVector",
   };
 
+  wsv_data["spectral_path"] = {
+      .desc = R"--(Frequency-major spectral variables along the propagation path
+
+The dimensions of the internal arrays are:
+
+- Frequency grid: *freq_grid* x *ray_path*
+- Propagation matrix and non-LTE source vector: *freq_grid* x *ray_path*
+- Jacobians: *freq_grid* x *ray_path* x *jac_targets* (target count)
+)--",
+      .type = "SpectralPath",
+  };
+
   wsv_data["spectral_phamat_spectral"] = {
       .desc =
           R"--(The spectral phase matrix of totally random orientation particles at a single point along a path using spectral representation
@@ -22,3 +22,24 @@ assert len(ws.measurement_sensor.unique_freq_grids()) == 2
 
 assert len(run_in_parallel.par_tasks(ws)) == 3
 assert len(create_agenda.par_tasks(ws)) == 1
+
+
+@pyarts.in_parallel(ws=ws)
+def run_with_dependencies(ws: pyarts.Workspace):
+    ws.measurement_sensorInit()
+    ws.abs_speciesSet(species=["O2"])
+    ws.measurement_sensorAddSimple(freq_grid=[1, 2, 3], pos=[3, 4, 5], los=[6, 7])
+
+
+assert ws.abs_species == ["O2"]
+assert len(ws.measurement_sensor.unique_freq_grids()) == 1
+
+
+@pyarts.in_parallel(ws=ws)
+def run_as_chain(ws: pyarts.Workspace):
+    ws.measurement_sensorInit()
+    ws.measurement_sensorAddSimple(freq_grid=[1, 2], pos=[3, 4, 5], los=[6, 7])
+    ws.measurement_sensorAddSimple(freq_grid=[3, 4], pos=[3, 4, 5], los=[6, 7])
+
+
+assert len(ws.measurement_sensor.unique_freq_grids()) == 2
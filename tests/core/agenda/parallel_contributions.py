@@ -0,0 +1,40 @@
+import numpy as np
+import pyarts3 as pyarts
+
+ws = pyarts.Workspace()
+
+ws.abs_speciesSet(species=["O2-66", "H2O-PWR98"])
+ws.ReadCatalogData()
+ws.abs_bandsSelectFrequencyByBand(fmax=120e9)
+
+ws.freq_grid = np.linspace(20e9, 140e9, 1001)
+ws.jac_targetsInit()
+ws.atm_pointInit()
+ws.atm_point.temperature = 295
+ws.atm_point.pressure = 1e5
+ws.atm_point[pyarts.arts.SpeciesEnum("O2")] = 0.21
+ws.atm_point[pyarts.arts.SpeciesEnum("H2O")] = 0.01
+ws.atm_point[pyarts.arts.SpeciesEnum("N2")] = 0.78
+ws.atm_point.mag = [40e-6, 20e-6, 10e-6]
+ws.ray_point
+
+ws.spectral_propmatInit()
+ws.spectral_propmatAddLines()
+ws.spectral_propmatAddPredefined()
+ref = 1.0 * ws.spectral_propmat[:, 0]
+
+
+# The contributions add to their own accumulators, so they run in parallel
+@pyarts.in_parallel(ws=ws)
+def contributions(ws: pyarts.Workspace):
+    ws.spectral_propmatInit()
+    ws.spectral_propmatAddLines()
+    ws.spectral_propmatAddPredefined()
+
+
+assert np.allclose(ws.spectral_propmat[:, 0], ref, rtol=1e-12, atol=0)
+
+# The decorator timed the level in order, the next runs split the threads
+for i in range(2):
+    contributions.par_execute(ws)
+    assert np.allclose(ws.spectral_propmat[:, 0], ref, rtol=1e-12, atol=0)
@@ -0,0 +1,169 @@
+import os
+import tempfile
+
+import pyarts3 as pyarts
+import numpy as np
+
+NFREQ = 101
+NBATCH = 4
+noise = 0.1
+
+ws = pyarts.workspace.Workspace()
+
+# %% Sampled frequency range
+
+line_f0 = 118750348044.712
+ws.freq_grid = np.linspace(-20e6, 20e6, NFREQ) + line_f0
+
+# %% Species and line absorption
+
+ws.abs_speciesSet(species=["O2-66"])
+ws.ReadCatalogData()
+ws.abs_bandsSelectFrequencyByLine(fmin=40e9, fmax=120e9)
+
+# %% Use the automatic agenda setter for propagation matrix calculations
+ws.spectral_propmat_agendaAuto()
+
+# %% Grids and planet
+
+ws.surf_fieldPlanet(option="Earth")
+ws.surf_field[pyarts.arts.SurfaceKey("t")] = 295.0
+ws.atm_fieldRead(
+    toa=120e3, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+)
+
+# %% Checks and settings
+
+ws.spectral_rad_transform_operator = "Tb"
+ws.ray_path_observer_agendaSetGeometric()
+
+# %% Artificial VMR
+
+grid = pyarts.arts.GriddedField3(
+    name="VMR",
+    data=np.ones((3, 1, 1)) * 0.2,
+    grid_names=["Altitude", "Latitude", "Longitude"],
+    grids=[[0, 50e3, 120e3], [0], [0]],
+)
+
+ws.atm_field[pyarts.arts.SpeciesEnum.O2] = grid
+ws.atm_field[pyarts.arts.SpeciesEnum.O2].lat_low = "Nearest"
+ws.atm_field[pyarts.arts.SpeciesEnum.O2].lat_upp = "Nearest"
+ws.atm_field[pyarts.arts.SpeciesEnum.O2].lon_low = "Nearest"
+ws.atm_field[pyarts.arts.SpeciesEnum.O2].lon_upp = "Nearest"
+
+# %% Set up sensor
+
+ws.measurement_sensorSimple(pos=[100e3, 0, 0], los=[180.0, 0.0])
+
+# %% Jacobian
+
+ws.RetrievalInit()
+ws.RetrievalAddSpeciesVMR(species="O2", matrix=np.diag(np.ones((3)) * 5))
+ws.RetrievalFinalizeDiagonal()
+
+# %% The measurements
+
+ws.measurement_vecFromSensor()
+y = np.array(ws.measurement_vec)
+np.random.seed(42)
+ys = y + np.random.normal(0, noise, (NBATCH, NFREQ))
+
+ws.atm_field[pyarts.arts.SpeciesEnum.O2].data += 0.1
+ws.model_state_vec_aprioriFromData()
+ws.measurement_vec_error_covmatConstant(value=noise**2)
+
+# %% The batch must give the same inversions as one at a time
+
+xs = pyarts.arts.Matrix()
+yfs = pyarts.arts.Matrix()
+diags = pyarts.arts.Matrix()
+errors = pyarts.arts.ArrayOfString()
+ws.OEMBatch(
+    model_state_vecs=xs,
+    measurement_vec_fits=yfs,
+    oem_diagnostics=diags,
+    errors=errors,
+    measurement_vecs=ys,
+    method="gn",
+)
+
+assert len(errors) == 0, errors
+
+for i in range(NBATCH):
+    ws.measurement_vec_fit = []
+    ws.model_state_vec = []
+    ws.measurement_jac = [[]]
+    ws.measurement_vec = ys[i]
+    ws.atm_fieldRead(
+        toa=120e3, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+    )
+    ws.atm_field[pyarts.arts.SpeciesEnum.O2] = grid
+    ws.atm_field[pyarts.arts.SpeciesEnum.O2].data += 0.1
+
+    ws.OEM(method="gn")
+
+    assert np.allclose(xs[i], ws.model_state_vec), (i, xs[i])
+    assert np.allclose(yfs[i], ws.measurement_vec_fit), i
+
+# %% Inversions done in the checkpoint are not repeated
+
+with tempfile.TemporaryDirectory() as tmp:
+    checkpoint = os.path.join(tmp, "oem.bin")
+
+    ws.atm_field[pyarts.arts.SpeciesEnum.O2] = grid
+    ws.atm_field[pyarts.arts.SpeciesEnum.O2].data += 0.1
+
+    x1 = pyarts.arts.Matrix()
+    d1 = pyarts.arts.Matrix()
+    ws.OEMBatch(
+        model_state_vecs=x1,
+        oem_diagnostics=d1,
+        measurement_vecs=ys,
+        method="gn",
+        checkpoint_file=checkpoint,
+        checkpoint_interval=1,
+    )
+    assert os.path.exists(checkpoint)
+
+    # One record per inversion after the 40 byte header
+    nrec = 6 + np.array(x1).shape[1] + np.array(ys).shape[1]
+    records = np.fromfile(checkpoint, dtype=np.float64, offset=40)
+    records = records.reshape(-1, nrec)
+    assert sorted(records[:, 0]) == list(range(NBATCH))
+
+    # Mark the first inversion, it is only kept if it is not repeated.  The
+    # appended record replaces the first one, and the record that is cut
+    # short, as by an interruption, is dropped.
+    first = records[records[:, 0] == 0][0].copy()
+    first[6] = 42.0
+    with open(checkpoint, "ab") as f:
+        f.write(first.tobytes())
+        f.write(first[:3].tobytes())
+
+    x2 = pyarts.arts.Matrix()
+    d2 = pyarts.arts.Matrix()
+    ws.OEMBatch(
+        model_state_vecs=x2,
+        oem_diagnostics=d2,
+        measurement_vecs=ys,
+        method="gn",
+        checkpoint_file=checkpoint,
+    )
+
+    assert x2[0, 0] == 42.0
+    assert np.allclose(x1[1:], x2[1:])
+    assert np.allclose(d1, d2, equal_nan=True)
+    assert os.path.getsize(checkpoint) == 40 + 8 * nrec * (NBATCH + 1)
+
+    # A checkpoint of other measurements or settings is not resumed
+    for other in [dict(measurement_vecs=ys + 1.0), dict(stop_dx=0.5)]:
+        kwargs = dict(measurement_vecs=ys, method="gn", checkpoint_file=checkpoint)
+        kwargs.update(other)
+
+        error = ""
+        try:
+            ws.OEMBatch(model_state_vecs=x2, **kwargs)
+        except Exception as e:
+            error = str(e)
+        assert "other input" in error, (other, error)
@@ -0,0 +1,95 @@
+import pyarts3 as pyarts
+import numpy as np
+
+NFREQ = 101
+noise = 0.1
+
+ws = pyarts.workspace.Workspace()
+
+# %% Sampled frequency range
+
+line_f0 = 118750348044.712
+ws.freq_grid = np.linspace(-20e6, 20e6, NFREQ) + line_f0
+
+# %% Species and line absorption
+
+ws.abs_speciesSet(species=["O2-66"])
+ws.ReadCatalogData()
+ws.abs_bandsSelectFrequencyByLine(fmin=40e9, fmax=120e9)
+
+# %% Use the automatic agenda setter for propagation matrix calculations
+ws.spectral_propmat_agendaAuto()
+
+# %% Grids and planet
+
+ws.surf_fieldPlanet(option="Earth")
+ws.surf_field[pyarts.arts.SurfaceKey("t")] = 295.0
+ws.atm_fieldRead(
+    toa=120e3, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+)
+
+# %% Checks and settings
+
+ws.spectral_rad_transform_operator = "Tb"
+ws.ray_path_observer_agendaSetGeometric()
+
+# %% Artificial VMR
+
+grid = pyarts.arts.GriddedField3(
+    name="VMR",
+    data=np.ones((3, 1, 1)) * 0.2,
+    grid_names=["Altitude", "Latitude", "Longitude"],
+    grids=[[0, 50e3, 120e3], [0], [0]],
+)
+
+ws.atm_field[pyarts.arts.SpeciesEnum.O2] = grid
+ws.atm_field[pyarts.arts.SpeciesEnum.O2].lat_low = "Nearest"
+ws.atm_field[pyarts.arts.SpeciesEnum.O2].lat_upp = "Nearest"
+ws.atm_field[pyarts.arts.SpeciesEnum.O2].lon_low = "Nearest"
+ws.atm_field[pyarts.arts.SpeciesEnum.O2].lon_upp = "Nearest"
+
+# %% Set up sensor
+
+ws.measurement_sensorSimple(pos=[100e3, 0, 0], los=[180.0, 0.0])
+
+# %% Jacobian
+
+ws.RetrievalInit()
+ws.RetrievalAddSpeciesVMR(species="O2", matrix=np.diag(np.ones((3)) * 5))
+ws.RetrievalFinalizeDiagonal()
+
+# %% The measurement
+
+ws.measurement_vecFromSensor()
+np.random.seed(42)
+y = np.array(ws.measurement_vec) + np.random.normal(0, noise, NFREQ)
+
+ws.atm_field[pyarts.arts.SpeciesEnum.O2].data += 0.1
+ws.model_state_vec_aprioriFromData()
+ws.measurement_vec_error_covmatConstant(value=noise**2)
+
+# %% The matrix-free inversion must give the same result as the dense one
+
+
+def inversion(jac_chunk_size):
+    ws.measurement_vec_fit = []
+    ws.model_state_vec = []
+    ws.measurement_jac = [[]]
+    ws.measurement_vec = y
+    ws.atm_field[pyarts.arts.SpeciesEnum.O2] = grid
+    ws.atm_field[pyarts.arts.SpeciesEnum.O2].data += 0.1
+
+    ws.OEM(method="gn_cg", jac_chunk_size=jac_chunk_size)
+
+    return np.array(ws.model_state_vec), np.array(ws.measurement_vec_fit)
+
+
+x, yf = inversion(0)
+assert np.array(ws.measurement_jac).size != 0
+
+for jac_chunk_size in [17, NFREQ]:
+    x_mf, yf_mf = inversion(jac_chunk_size)
+
+    assert np.allclose(x, x_mf), (jac_chunk_size, x, x_mf)
+    assert np.allclose(yf, yf_mf), jac_chunk_size
+    assert np.array(ws.measurement_jac).size == 0, jac_chunk_size
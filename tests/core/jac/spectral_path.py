@@ -0,0 +1,72 @@
+import pyarts3 as pyarts
+import numpy as np
+
+ws = pyarts.workspace.Workspace()
+
+# %% Sampled frequency range
+
+line_f0 = 118750348044.712
+ws.freq_grid = np.linspace(-20e6, 20e6, 101) + line_f0
+
+# %% Species and line absorption
+
+ws.abs_speciesSet(species=["O2-66"])
+ws.ReadCatalogData()
+ws.abs_bandsSelectFrequencyByLine(fmin=40e9, fmax=120e9)
+ws.spectral_propmat_agendaAuto()
+
+# %% Grids and planet
+
+ws.surf_fieldPlanet(option="Earth")
+ws.surf_field[pyarts.arts.SurfaceKey("t")] = 295.0
+ws.atm_fieldRead(
+    toa=120e3, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+)
+ws.spectral_rad_transform_operatorSet(option="Tb")
+ws.spectral_rad_space_agendaSet(option="UniformCosmicBackground")
+ws.spectral_rad_surface_agendaSet(option="Blackbody")
+
+# %% Jacobian
+
+ws.jac_targetsInit()
+ws.jac_targetsAddSpeciesVMR(species="O2")
+ws.jac_targetsAddTemperature()
+ws.jac_targetsFinalize()
+
+# %% The path
+
+ws.ray_pathGeometric(pos=[100e3, 0, 0], los=[180.0, 0.0], max_stepsize=1000.0)
+ws.ray_pointBackground()
+ws.spectral_rad_bkgAgendasAtEndOfPath()
+ws.atm_pathFromPath()
+ws.freq_grid_pathFromPath()
+
+# %% Computed straight into the frequency-major layout
+
+ws.spectral_pathFromPath()
+direct = pyarts.arts.SpectralPath(ws.spectral_path)
+
+ws.spectral_radSetToBackground()
+ws.spectral_radSinglePathEmissionFrequencyLoop()
+srad = np.array(ws.spectral_rad)
+jac = np.array(ws.spectral_rad_jac)
+
+# %% Transposed from the point-major layout
+
+ws.spectral_propmat_pathFromPath()
+ws.spectral_pathFromPropmatPath()
+
+npath = len(ws.ray_path)
+nf = len(ws.freq_grid)
+assert np.array(ws.spectral_path.propmat).shape == (nf, npath, 7)
+assert np.array(ws.spectral_path.propmat_jac).shape == (nf, npath, 2, 7)
+
+for key in ["freq", "propmat", "nlte", "propmat_jac", "nlte_jac"]:
+    x = np.array(getattr(direct, key))
+    y = np.array(getattr(ws.spectral_path, key))
+    assert np.array_equal(x, y), key
+
+ws.spectral_radSetToBackground()
+ws.spectral_radSinglePathEmissionFrequencyLoop()
+assert np.array_equal(srad, np.array(ws.spectral_rad))
+assert np.array_equal(jac, np.array(ws.spectral_rad_jac))
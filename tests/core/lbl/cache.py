@@ -0,0 +1,86 @@
+import pyarts3 as pyarts
+import numpy as np
+
+ws = pyarts.Workspace()
+
+# %% Sampled frequency range
+ws.freq_grid = np.linspace(50e9, 70e9, 1001)
+
+# %% Species and line absorption
+ws.abs_speciesSet(species=["O2-66"])
+ws.ReadCatalogData()
+ws.abs_bandsSelectFrequencyByLine(fmin=40e9, fmax=120e9)
+ws.jac_targetsInit()
+
+# %% Set the atmosphere
+ws.atm_point["t"] = 250.0
+ws.atm_point["p"] = 2e4
+ws.atm_point["O2"] = 0.2095
+ws.ray_point.los = [180.0, 0.0]
+
+
+def calc():
+    ws.spectral_propmatInit()
+    ws.spectral_propmatAddLines()
+    return np.array(ws.spectral_propmat)
+
+
+# %% Reference without cache
+
+assert not ws.abs_lbl_cache.active
+ref = calc()
+
+# %% Exact cache
+
+ws.abs_lbl_cacheInit(max_entries=2)
+assert calc().tolist() == ref.tolist()
+assert calc().tolist() == ref.tolist()
+assert ws.abs_lbl_cache.hits == 1
+assert ws.abs_lbl_cache.misses == 1
+
+ws.atm_point["t"] = 251.0
+t251 = calc()
+assert not np.allclose(t251, ref)
+ws.atm_point["t"] = 252.0
+calc()
+assert ws.abs_lbl_cache.misses == 3
+assert ws.abs_lbl_cache.size == 2
+
+# Least recently used entry (250 K) was dropped
+ws.atm_point["t"] = 250.0
+assert calc().tolist() == ref.tolist()
+assert ws.abs_lbl_cache.misses == 4
+
+# %% Tolerant cache
+
+ws.abs_lbl_cacheInit(max_entries=10, temperature_tolerance=1.0)
+calc()
+ws.atm_point["t"] = 250.1
+assert calc().tolist() == ref.tolist()
+assert ws.abs_lbl_cache.hits == 1
+
+# %% Modifying the bands in place is not a hit
+
+ws.abs_lbl_cacheInit(max_entries=10)
+ws.atm_point["t"] = 250.0
+calc()
+bandkey = next(iter(ws.abs_bands))
+ws.abs_bands[bandkey].lineshape = "VP_LTE_MIRROR"
+assert calc().tolist() != ref.tolist()
+assert ws.abs_lbl_cache.hits == 0
+assert ws.abs_lbl_cache.misses == 2
+
+ws.abs_bands[bandkey].lineshape = "VP_LTE"
+assert calc().tolist() == ref.tolist()
+assert ws.abs_lbl_cache.hits == 1
+
+# %% Jacobian calculations bypass the cache
+
+ws.jac_targetsAddTemperature()
+ws.spectral_propmatInit()
+ws.spectral_propmatAddLines()
+assert ws.abs_lbl_cache.hits == 1
+assert ws.abs_lbl_cache.misses == 1
+
+ws.abs_lbl_cache.clear()
+assert ws.abs_lbl_cache.size == 0
@@ -0,0 +1,45 @@
+import pyarts3 as pyarts
+import numpy as np
+
+ws = pyarts.Workspace()
+
+# %% Sampled frequency range
+ws.freq_grid = np.linspace(50e9, 70e9, 1001)
+
+# %% Species and line absorption
+ws.abs_speciesSet(species=["O2-66"])
+ws.ReadCatalogData()
+ws.abs_bandsSelectFrequencyByLine(fmin=40e9, fmax=120e9)
+ws.jac_targetsInit()
+
+# %% Set the atmosphere
+ws.atm_point["t"] = 250.0
+ws.atm_point["p"] = 2e4
+ws.atm_point["O2"] = 0.2095
+ws.ray_point.los = [180.0, 0.0]
+
+
+def calc():
+    ws.spectral_propmatInit()
+    ws.spectral_propmatAddLines()
+    return np.array(ws.spectral_propmat)
+
+
+ref = calc()
+assert calc().tolist() == ref.tolist()
+
+# %% The kept index and its compiled bands follow in-place edits
+
+bandkey = next(iter(ws.abs_bands))
+line = ws.abs_bands[bandkey].lines[0]
+a = line.a
+
+line.a = 2 * a
+doubled = calc()
+assert doubled.tolist() != ref.tolist()
+
+line.a = a
+assert calc().tolist() == ref.tolist()
+
+line.f0 = line.f0 + 1e6
+assert calc().tolist() != ref.tolist()
@@ -0,0 +1,87 @@
+import pyarts3 as pyarts
+import numpy as np
+import os
+
+# %% Setup workspace
+
+ws = pyarts.Workspace()
+
+ws.abs_speciesSet(species=["O2-66", "H2O-161"])
+ws.ReadCatalogData()
+
+ws.freq_grid = np.linspace(50e9, 70e9, 101)
+
+ws.atm_profile = [pyarts.arts.AtmPoint() for _ in range(11)]
+for i, p in enumerate(np.logspace(5, 2, 11)):
+    ws.atm_profile[i].pressure = p
+    ws.atm_profile[i].temperature = 290 - 5 * i
+    ws.atm_profile[i]["O2"] = 0.21
+    ws.atm_profile[i]["H2O"] = 1e-2 * p / 1e5
+
+kwargs = {
+    "temperature_perturbation": np.linspace(-20, 20, 3),
+    "water_perturbation": np.logspace(-1, 1, 3),
+    "water_affected_species": ["H2O"],
+}
+
+# %% Reference, all frequencies at once
+
+ws.abs_lookup_dataInit()
+ws.abs_lookup_dataPrecomputeAll(**kwargs)
+ref = pyarts.arts.AbsorptionLookupTables(ws.abs_lookup_data)
+
+# %% Blocks in memory, with a last block that is shorter than the others
+
+ws.abs_lookup_dataInit()
+ws.abs_lookup_dataPrecomputeAll(**kwargs, frequency_block_size=17)
+for spec in ["O2", "H2O"]:
+    assert np.allclose(ws.abs_lookup_data[spec].xsec, ref[spec].xsec)
+
+# %% Blocks streamed to file
+
+fn = "lookup_chunked_test.bin"
+
+ws.abs_lookup_dataInit()
+ws.abs_lookup_dataPrecomputeAll(**kwargs, frequency_block_size=17, filename=fn)
+assert not os.path.exists(fn + ".progress")
+assert not os.path.exists(fn + ".partial")
+
+atm = ws.atm_profile[4]
+for spec in ["O2", "H2O"]:
+    assert ws.abs_lookup_data[spec].is_mapped
+    x = ref.spectral_propmat(f=ws.freq_grid, atm=atm, spec=spec)
+    y = ws.abs_lookup_data.spectral_propmat(f=ws.freq_grid, atm=atm, spec=spec)
+    assert np.allclose(x, y)
+
+# %% Recomputing the file does not affect tables that have it mapped
+
+old = pyarts.arts.AbsorptionLookupTables(ws.abs_lookup_data)
+
+ws.abs_lookup_dataInit()
+ws.abs_lookup_dataPrecomputeAll(**kwargs, frequency_block_size=17, filename=fn)
+assert not os.path.exists(fn + ".partial")
+
+for spec in ["O2", "H2O"]:
+    assert np.allclose(old[spec].xsec, ref[spec].xsec)
+
+# %% Blocks computed from other inputs are not resumed
+
+bands = pyarts.arts.AbsorptionBands(ws.abs_bands)
+ws.abs_bands = {}
+
+ws.abs_lookup_dataInit()
+ws.abs_lookup_dataPrecomputeAll(**kwargs, frequency_block_size=17, filename=fn)
+
+# Pretend an interrupted run with no bands finished all its blocks
+os.rename(fn, fn + ".partial")
+with open(fn + ".progress", "w") as f:
+    f.write("17 0\nO2 6\nH2O 6\n")
+
+ws.abs_bands = bands
+ws.abs_lookup_dataInit()
+ws.abs_lookup_dataPrecomputeAll(**kwargs, frequency_block_size=17, filename=fn)
+for spec in ["O2", "H2O"]:
+    assert np.allclose(ws.abs_lookup_data[spec].xsec, ref[spec].xsec)
+
+ws.abs_lookup_dataInit()
+os.remove(fn)
@@ -0,0 +1,49 @@
+import pyarts3 as pyarts
+import numpy as np
+import os
+
+# %% Setup workspace
+
+ws = pyarts.Workspace()
+
+ws.abs_speciesSet(species=["O2-66", "H2O-161"])
+ws.ReadCatalogData()
+
+ws.freq_grid = np.linspace(50e9, 70e9, 101)
+
+ws.abs_lookup_dataFromProfiles(
+    pressure_profile=np.logspace(5, 2, 21),
+    temperature_profile=np.linspace(290, 220, 21),
+    vmr_profiles={"O2": np.full(21, 0.21), "H2O": np.logspace(-2, -5, 21)},
+    temperature_perturbation=np.linspace(-20, 20, 5),
+    water_perturbation=np.logspace(-1, 1, 5),
+    water_affected_species=["H2O"],
+)
+
+# %% Round-trip through the memory-mapped format
+
+fn = "lookup_mapped_test.bin"
+ws.abs_lookup_dataWriteMapped(filename=fn)
+
+ws2 = pyarts.Workspace()
+ws2.abs_lookup_dataReadMapped(filename=fn)
+mapped = ws2.abs_lookup_data
+
+assert len(mapped) == len(ws.abs_lookup_data)
+
+atm = pyarts.arts.AtmPoint()
+atm.pressure = 2e4
+atm.temperature = 250.0
+atm["O2"] = 0.21
+atm["H2O"] = 1e-4
+
+for spec in ["O2", "H2O"]:
+    assert mapped[spec].is_mapped
+    assert not ws.abs_lookup_data[spec].is_mapped
+
+    ref = ws.abs_lookup_data.spectral_propmat(f=ws.freq_grid, atm=atm, spec=spec)
+    new = mapped.spectral_propmat(f=ws.freq_grid, atm=atm, spec=spec)
+    assert np.all(np.array(ref) == np.array(new))
+
+del mapped, ws2
+os.remove(fn)
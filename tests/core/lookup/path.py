@@ -0,0 +1,46 @@
+import pyarts3 as pyarts
+from pyarts3.arts import AtmPoint, PropmatVector, PropmatMatrix
+import numpy as np
+
+# %% Setup workspace
+
+ws = pyarts.Workspace()
+
+ws.abs_speciesSet(species=["O2-66", "H2O-161"])
+ws.ReadCatalogData()
+
+ws.freq_grid = np.linspace(50e9, 70e9, 1001)
+nf = len(ws.freq_grid)
+
+ws.abs_lookup_dataFromProfiles(
+    pressure_profile=np.logspace(5, 2, 21),
+    temperature_profile=np.linspace(290, 220, 21),
+    vmr_profiles={"O2": np.full(21, 0.21), "H2O": np.logspace(-2, -5, 21)},
+    temperature_perturbation=np.linspace(-20, 20, 5),
+    water_perturbation=np.logspace(-1, 1, 5),
+    water_affected_species=["H2O"],
+)
+
+# %% A path that revisits levels, as in a limb geometry
+
+p = np.concatenate([np.logspace(4.9, 3, 30), np.logspace(3, 4.9, 30)])
+t = np.concatenate([np.linspace(280, 230, 30), np.linspace(230, 280, 30)])
+
+ws.atm_path = [AtmPoint() for _ in p]
+for i in range(len(p)):
+    ws.atm_path[i].pressure = p[i]
+    ws.atm_path[i].temperature = t[i]
+    ws.atm_path[i]["O2"] = 0.21
+    ws.atm_path[i]["H2O"] = 1e-3 * p[i] / 1e5
+
+ws.spectral_propmat_path = [PropmatVector(np.zeros((nf, 7))) for _ in p]
+ws.spectral_propmat_jac_path = [PropmatMatrix(np.zeros((0, nf, 7))) for _ in p]
+ws.select_species = "Bath"
+
+ws.spectral_propmat_pathAddLookup()
+
+# %% Compare to the per-point method
+
+for i in range(len(p)):
+    ref = ws.abs_lookup_data.spectral_propmat(f=ws.freq_grid, atm=ws.atm_path[i])
+    assert np.allclose(ws.spectral_propmat_path[i], ref, rtol=1e-10, atol=0)
@@ -0,0 +1,63 @@
+import pyarts3 as pyarts
+import numpy as np
+
+# %% Setup workspace
+
+ws = pyarts.Workspace()
+
+ws.abs_speciesSet(species=["O2-66", "H2O-161"])
+ws.ReadCatalogData()
+
+ws.freq_grid = np.linspace(50e9, 70e9, 101)
+
+kwargs = {
+    "pressure_profile": np.logspace(5, 2, 21),
+    "temperature_profile": np.linspace(290, 220, 21),
+    "vmr_profiles": {"O2": np.full(21, 0.21), "H2O": np.logspace(-2, -5, 21)},
+    "temperature_perturbation": np.linspace(-20, 20, 5),
+    "water_perturbation": np.logspace(-1, 1, 5),
+    "water_affected_species": ["H2O"],
+}
+
+ws.abs_lookup_dataFromProfiles(**kwargs)
+ref = pyarts.arts.AbsorptionLookupTables(ws.abs_lookup_data)
+
+atm = pyarts.arts.AtmPoint()
+atm.pressure = 2e4
+atm.temperature = 250.0
+atm["O2"] = 0.21
+atm["H2O"] = 1e-4
+
+# %% Reduced storage agrees with double precision to within its resolution
+
+tolerance = {"LogFloat32": 1e-5, "LogFloat16": 2e-2, "ScaledInt16": 1e-3}
+
+for storage, rtol in tolerance.items():
+    ws.abs_lookup_dataFromProfiles(**kwargs, storage=storage)
+
+    for spec in ["O2", "H2O"]:
+        assert ws.abs_lookup_data[spec].storage == storage
+        assert np.array(ws.abs_lookup_data[spec].xsec).size == 0
+
+        x = ref.spectral_propmat(f=ws.freq_grid, atm=atm, spec=spec)
+        y = ws.abs_lookup_data.spectral_propmat(f=ws.freq_grid, atm=atm, spec=spec)
+        assert np.allclose(x, y, rtol=rtol, atol=0)
+
+# %% Back to double precision
+
+t = pyarts.arts.AbsorptionLookupTable(ws.abs_lookup_data["O2"])
+t.compress("Double")
+assert t.storage == "Double"
+assert np.allclose(t.xsec, ref["O2"].xsec, rtol=1e-3, atol=0)
+
+# %% The storage mode is kept through XML
+
+fn = ws.abs_lookup_data.savexml("lookup_storage_test.xml")
+tables = pyarts.arts.AbsorptionLookupTables.fromxml(fn)
+for spec in ["O2", "H2O"]:
+    assert tables[spec].storage == "ScaledInt16"
+    assert np.array(tables[spec].xsec).size == 0
+
+    x = ws.abs_lookup_data.spectral_propmat(f=ws.freq_grid, atm=atm, spec=spec)
+    y = tables.spectral_propmat(f=ws.freq_grid, atm=atm, spec=spec)
+    assert np.allclose(x, y, rtol=1e-3, atol=0)
@@ -0,0 +1,57 @@
+import pyarts3 as pyarts
+import numpy as np
+
+# %% Functional atmospheric field data, called once per profile
+
+calls = {"scalar": 0, "batch": 0}
+
+
+def temperature(alt, lat, lon):
+    if np.ndim(alt) == 0:
+        calls["scalar"] += 1
+    else:
+        calls["batch"] += 1
+    return 200 + 100 * np.exp(-alt / 20e3) + 0.1 * lat + 0.01 * lon
+
+
+ws = pyarts.Workspace()
+ws.atm_fieldInit(toa=100e3)
+ws.atm_field["p"] = 1e5
+ws.atm_field["t"] = pyarts.arts.NumericTernaryOperator(temperature, batch=True)
+
+ws.alt_grid = np.linspace(0, 100e3, 51)
+ws.lat = 10
+ws.lon = 20
+ws.atm_profileExtract()
+
+assert calls["batch"] == 1, calls
+assert calls["scalar"] == 0, calls
+
+t = [atm.temperature for atm in ws.atm_profile]
+assert np.allclose(t, temperature(np.array(ws.alt_grid), 10, 20))
+
+for alt in [0, 50e3, 100e3]:
+    t = ws.atm_field(alt, 10, 20).temperature
+    assert np.isclose(t, temperature(alt, 10, 20))
+
+# %% Henyey-Greenstein extinction and ssa, called once per frequency grid
+
+f_grid = pyarts.arts.Vector(np.linspace(1e9, 100e9, 11))
+atm = ws.atm_profile[0]
+
+
+def ext_ssa(f, atm):
+    return 1e-4 * f / 1e9, 0.5 + 0 * f
+
+
+hg = pyarts.arts.HenyeyGreensteinScatterer(ext_ssa, 0.5)
+hg_batch = pyarts.arts.HenyeyGreensteinScatterer(
+    pyarts.arts.ExtSSACallback(ext_ssa, batch=True), 0.5
+)
+
+x = hg.get_bulk_scattering_properties_tro_spectral(atm, f_grid, 3)
+y = hg_batch.get_bulk_scattering_properties_tro_spectral(atm, f_grid, 3)
+
+assert np.allclose(x.phase_matrix, y.phase_matrix)
+assert np.allclose(x.extinction_matrix, y.extinction_matrix)
+assert np.allclose(x.absorption_vector, y.absorption_vector)
@@ -59,6 +59,24 @@ ws.measurement_sensorAddSimpleGaussian(
 ws.measurement_vecFromSensor()
 orig = ws.measurement_vec * 1.0
 
+# %% All kernels sum up the same measurement vector and Jacobian
+
+ws.jac_targetsInit()
+ws.jac_targetsAddTemperature()
+ws.jac_targetsFinalize()
+
+ws.measurement_vecFromSensor()
+orig_jac = ws.measurement_jac * 1.0
+assert np.any(orig_jac != 0.0)
+
+for kernel in ["High Performance", "Streaming"]:
+    ws.measurement_vecFromSensor(kernel=kernel)
+    assert np.allclose(ws.measurement_vec, orig), kernel
+    assert np.allclose(ws.measurement_jac, orig_jac), kernel
+
+ws.jac_targetsInit()
+ws.jac_targetsFinalize()
+
 # %% Modify the sensor
 
 DF1 = 1e5
@@ -6,3 +6,25 @@ local_fn = "single_line.par"
 ws = pyarts.Workspace()
 ws.abs_bandsReadHITRAN(file=local_fn, file_formatter=['par', 'statep', 'statepp'])
 ws.abs_bandsSaveSplit(dir=DIR)
+ref = str(ws.abs_bands)
+
+# %% Binary cache, written on the first call and read on the second
+
+cache_fn = "single_line.par.cache"
+for _ in range(2):
+    ws.abs_bandsReadHITRAN(
+        file=local_fn,
+        file_formatter=["par", "statep", "statepp"],
+        cache_file=cache_fn,
+    )
+    assert str(ws.abs_bands) == ref
+
+# %% Species selection
+
+ws.abs_bandsReadHITRAN(
+    file=local_fn,
+    file_formatter=["par", "statep", "statepp"],
+    species=["CO2"],
+    cache_file=cache_fn,
+)
+assert len(ws.abs_bands) == 0